@@ -1,36 +1,55 @@
-#include "pico/stdlib.h"
-#include "hardware/pwm.h"
-#include "hardware/adc.h"
+#include "arm_hal.h"
+#include "arm_servo.h"
+#include "motion_executor.h"
+#include "arm_move.h"
+#include "arm_ik.h"
+#include "arm_reach.h"
+#include "arm_telemetry.h"
+#include "arm_loop_timing.h"
+#include "arm_joystick.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 
 
 // Function declarations
-int angle_to_pulse(int servo_num, int angle);
-void set_servo_angle(uint servo_pin, int servo_num, int angle);
-void move_servo_slow(uint slice, uint channel, int start_pos, int end_pos, int duration_ms);
-bool calculate_2d_ik(float x, float z, float *shoulder_angle, float *elbow_angle);
-void move_servos_coordinated(uint servo_pins[], int servo_nums[], int target_angles[], int num_servos, int duration_ms);
+bool move_to_tip(float x, float y, float z, motion_profile_type_t profile, int duration_ms);
+bool move_arm_joints(float yaw_deg, float shoulder_deg, float elbow_deg, motion_profile_type_t profile, int duration_ms);
+void tip_from_joints(float yaw_deg, float shoulder_deg, float elbow_deg, float *x, float *y, float *z);
 
-/*
-* ARM MEASUREMENTS (mm):
-* - Base height: 97mm
-* - Shoulder offset from base axis: 14mm
-* - Link 1 (shoulder→elbow): 114mm
-* - Link 2 (elbow→wrist roll): 87mm (5mm offset)
-* - Wrist roll→pitch: 37mm
-* - Wrist pitch→pointer tip: 80mm
-* - Total Link2 for IK: 167mm (87 + 37 + 80)
-* - Max reach: ~318mm
-*/
-
-// Link lengths in mm
-#define LINK1 114.0  // Shoulder to elbow
-#define LINK2 204.0  // Elbow to pointer tip (87 + 37 + 80)
-
-// Current positions
-int current_positions[5] = {0, 0, 0, 0, 0};
+int current_config = 0;  // IK branch the arm is on, 0 = unknown
+
+// Input loop period. The loop sleeps to absolute deadlines, so IK and printf
+// time doesn't stretch it; servo output runs on core 1 and never blocks it.
+#define INPUT_PERIOD_MS 50
+
+// Joystick moves last one loop period; the executor blends each increment
+// into the next, so a held stick moves at a steady speed and the loop
+// never waits on motion
+#define JOY_MOVE_MS INPUT_PERIOD_MS
+
+// Background ADC capture rate per joystick axis. Each read averages the
+// last HAL_ADC_CAPTURE_AVERAGE samples (16ms at 1kHz)
+#define JOY_SAMPLE_HZ 1000
+
+// Pointer angle above horizontal, held while the joysticks move the tip
+#define APPROACH_PITCH 0.0f
+
+// Joystick mode. Resolved rate (1): deflection sets the tip velocity; the
+// shoulder/elbow Jacobian drives the wrist point in the arm plane and the
+// base turns at tangential speed / radius. Joint angles are integrated every
+// loop, so there is no position solve and no elbow flip mid-move.
+// Position (0): the old per-loop full-arm IK with boundary sliding.
+#ifndef JOY_RESOLVED_RATE
+#define JOY_RESOLVED_RATE 1
+#endif
+#define JOY_MAX_SPEED 60.0f  // mm/s at full deflection
+
+// Binary telemetry rate (see arm_telemetry.h), decoded on the host with
+// tools/telemetry_decode. 0 for the old once a second printf instead.
+#ifndef JOY_TELEMETRY_HZ
+#define JOY_TELEMETRY_HZ TELEMETRY_DEFAULT_HZ
+#endif
 
 /*
  * JOYSTICK WIRING:
@@ -44,97 +63,143 @@ int current_positions[5] = {0, 0, 0, 0, 0};
  */
 
 int main() {
-    // Pin definitions
-    const uint LED_PIN = 16;
-    const uint BASE = 15;
-    const uint SHOULDER = 14;
-    const uint ELBOW = 13;
-    const uint WRIST_ROLL = 12;
-    const uint WRIST_PITCH = 11;
+    const uint LED_PIN = ARM_LED_PIN;
     
-    stdio_init_all();
-    sleep_ms(2000);  // Wait for serial
+    hal_init();
+    hal_sleep_ms(2000);  // Wait for serial
     
     // LED setup
-    gpio_init(LED_PIN);
-    gpio_set_dir(LED_PIN, GPIO_OUT);
+    hal_gpio_led_init(LED_PIN);
     
     // Blink confirmation
     for (int i = 0; i < 3; i++) {
-        gpio_put(LED_PIN, 1);
-        sleep_ms(200);
-        gpio_put(LED_PIN, 0);
-        sleep_ms(200);
+        hal_gpio_put(LED_PIN, 1);
+        hal_sleep_ms(200);
+        hal_gpio_put(LED_PIN, 0);
+        hal_sleep_ms(200);
     }
     
-    // PWM setup
-    uint servos[] = {BASE, SHOULDER, ELBOW, WRIST_ROLL, WRIST_PITCH};
-    for (int i = 0; i < 5; i++) {
-        gpio_set_function(servos[i], GPIO_FUNC_PWM);
-        uint slice = pwm_gpio_to_slice_num(servos[i]);
-        pwm_set_clkdiv(slice, 64.0f);
-        pwm_set_wrap(slice, 39062);
-        pwm_set_enabled(slice, true);
-    }
-    // Initialize to 90 degrees
-    for (int i = 0; i < 5; i++) {
-        current_positions[i] = angle_to_pulse(i, 90);
-    }
+    // PWM setup, positions start at 90 degrees
+    arm_servos_init();
 
     // ADC setup for joystick
-    adc_init();
-    adc_gpio_init(26);  // Side joystick Y-axis (up/down / Z)
-    adc_gpio_init(27);  // Top joystick Y-axis (left/right / Y)
-    adc_gpio_init(28);  // Side joystick X-axis (forward/back / X)
+    hal_adc_init();
+    hal_adc_gpio_init(26);  // Side joystick Y-axis (up/down / Z)
+    hal_adc_gpio_init(27);  // Top joystick Y-axis (left/right / Y)
+    hal_adc_gpio_init(28);  // Side joystick X-axis (forward/back / X)
+    hal_adc_capture_start(3, JOY_SAMPLE_HZ);
 
     // Set base and wrists to neutral
-    set_servo_angle(BASE, 0, 90);
-    set_servo_angle(WRIST_ROLL, 3, 90);
-    set_servo_angle(WRIST_PITCH, 4, 145);
+    set_servo_angle(0, 90);    // Base
+    set_servo_angle(3, 90);    // Wrist roll
+    set_servo_angle(4, 145);   // Wrist pitch
     
-    // Start at max reach position
+    // Start near max reach, pointer level at shoulder height
     float current_x = 318.0;
     float current_y = 0;
-    float current_z = 0.0;
+    float current_z = BASE_HEIGHT;
 
     // Move to starting position
-    float shoulder_angle, elbow_angle;
-    if (calculate_2d_ik(current_x, current_z, &shoulder_angle, &elbow_angle)) {
-        uint moving_pins[] = {SHOULDER, ELBOW};
-        int moving_nums[] = {1, 2};
-        int target_angles[] = {(int)shoulder_angle, (int)elbow_angle};
-        move_servos_coordinated(moving_pins, moving_nums, target_angles, 2, 1500);
+    if (move_to_tip(current_x, current_y, current_z, MOTION_PROFILE_SCURVE, 0)) {
+        motion_executor_wait_idle();
     }
 
-    sleep_ms(1000);
+#if JOY_RESOLVED_RATE
+    // Joint state: base yaw plus shoulder/elbow in IK-frame degrees
+    float joint_yaw = 0, joint_shoulder = 0, joint_elbow = 0;
+    arm_pose_t start_poses[ARM_IK_MAX_SOLUTIONS];
+    if (calculate_arm_ik(current_x, current_y, current_z, APPROACH_PITCH, start_poses) > 0) {
+        joint_yaw = start_poses[0].base - 90.0f;
+        joint_shoulder = IK_SHOULDER_FROM_SERVO(start_poses[0].shoulder);
+        joint_elbow = IK_ELBOW_FROM_SERVO(start_poses[0].elbow);
+    }
+    bool elbow_up = joint_elbow >= 0;
+    clamp_2link_joints(&joint_shoulder, &joint_elbow, elbow_up);
+    if (move_arm_joints(joint_yaw, joint_shoulder, joint_elbow, MOTION_PROFILE_SCURVE, 0)) {
+        motion_executor_wait_idle();
+    }
+    tip_from_joints(joint_yaw, joint_shoulder, joint_elbow, &current_x, &current_y, &current_z);
+#endif
 
+    hal_sleep_ms(1000);
+
+    // Conditioning (see arm_joystick.h): the side stick as one 2-axis stick
+    // (radial dead zone), the top stick on its own. The first passes measure
+    // the centres, so leave the sticks alone for half a second after the
+    // start move
+    joystick_t side_stick, top_stick;
+    joystick_init(&side_stick, 2, HAL_ADC_BITS, 1000 / INPUT_PERIOD_MS);
+    joystick_init(&top_stick, 1, HAL_ADC_BITS, 1000 / INPUT_PERIOD_MS);
+
+#if JOY_TELEMETRY_HZ
+    // Started here so the setup moves, which nothing drains during, don't
+    // overflow the ring
+    telemetry_start(JOY_TELEMETRY_HZ);
+#else
     uint32_t last_print_time = 0;
+#endif
+    uint64_t next_input_us = hal_time_us();
 
     while (true) {
-        // Read joystick
-        adc_select_input(0);  // GPIO 26 - Side joystick axis 1
-        int side_1_raw = adc_read();
-        adc_select_input(1);  // GPIO 27 - Top joystick (X forward/back)
-        int top_raw = adc_read();
-        adc_select_input(2);  // GPIO 28 - Side joystick axis 2
-        int side_2_raw = adc_read();
+        loop_timing_begin();
+#if JOY_TELEMETRY_HZ
+        telemetry_loop_begin();
+#endif
+        // Read joystick (averaged by the background capture, no conversion wait)
+        int side_1_raw = hal_adc_capture_read(0);  // GPIO 26 - Side joystick axis 1
+        int top_raw = hal_adc_capture_read(1);     // GPIO 27 - Top joystick (X forward/back)
+        int side_2_raw = hal_adc_capture_read(2);  // GPIO 28 - Side joystick axis 2
         
-        // Calculate offset from center
-        int dead_zone = 300;
-        int offset_x = side_2_raw - 2048;    // X (forward/back) - side joystick axis 2
-        int offset_y = top_raw - 2048;      // Y (base rotation) - top joystick
-        int offset_z = side_1_raw - 2048;   // Z (up/down) - side joystick axis 1
+        // Centred, filtered, dead zone and response curve applied, Q15
+        uint16_t side_raw[] = {side_2_raw, side_1_raw};
+        uint16_t top_raw_in[] = {top_raw};
+        int16_t side[2], top[1];
+        joystick_update(&side_stick, side_raw, side);
+        joystick_update(&top_stick, top_raw_in, top);
+        int offset_x = side[0];   // X (forward/back) - side joystick axis 2
+        int offset_y = top[0];    // Y (base rotation) - top joystick
+        int offset_z = side[1];   // Z (up/down) - side joystick axis 1
+        loop_timing_mark(LOOP_STAGE_ADC);
+
+#if JOY_RESOLVED_RATE
+        float v_radial = offset_x * (JOY_MAX_SPEED / JOYSTICK_ONE);
+        float v_tangent = offset_y * (JOY_MAX_SPEED / JOYSTICK_ONE);
+        float v_z = -offset_z * (JOY_MAX_SPEED / JOYSTICK_ONE);
 
-        // Apply dead zone
-        if (abs(offset_x) < dead_zone) offset_x = 0;
-        if (abs(offset_y) < dead_zone) offset_y = 0;
-        if (abs(offset_z) < dead_zone) offset_z = 0;
+        if (v_radial != 0 || v_tangent != 0 || v_z != 0) {
+            float dt = INPUT_PERIOD_MS / 1000.0f;
 
+            // With the pointer angle held, the tip moves with the wrist point
+            float new_shoulder = joint_shoulder;
+            float new_elbow = joint_elbow;
+            step_2link_rates(LINK1, FOREARM_LENGTH, &new_shoulder, &new_elbow, v_radial, v_z, dt, elbow_up);
+
+            float radial = sqrtf(current_x * current_x + current_y * current_y);
+            float new_yaw = joint_yaw;
+            if (radial > 1.0f) {
+                new_yaw += v_tangent / radial * dt * (180.0f / (float)M_PI);
+            }
+            if (new_yaw > 90.0f) new_yaw = 90.0f;
+            if (new_yaw < -90.0f) new_yaw = -90.0f;
+            loop_timing_mark(LOOP_STAGE_IK);
+
+            bool moved = move_arm_joints(new_yaw, new_shoulder, new_elbow, MOTION_PROFILE_LINEAR, JOY_MOVE_MS);
+            loop_timing_mark(LOOP_STAGE_SERVO);
+            if (moved) {
+                joint_yaw = new_yaw;
+                joint_shoulder = new_shoulder;
+                joint_elbow = new_elbow;
+                tip_from_joints(joint_yaw, joint_shoulder, joint_elbow, &current_x, &current_y, &current_z);
+                loop_timing_mark(LOOP_STAGE_IK);
+            }
+        }
+#else
         // Convert to movement speed (mm per update)
-        float speed = 15.0;
-        float delta_x = (offset_x / 2048.0) * speed;       // Radial
-        float delta_y = (offset_y / 2048.0) * speed;       // Base rotation
-        float delta_z = -(offset_z / 2048.0) * speed;       // Vertical
+        // 3mm per 50ms loop = 60mm/s, the same top speed as the old 15mm per blocking 250ms loop
+        float speed = 3.0;
+        float delta_x = offset_x * (speed / JOYSTICK_ONE);       // Radial
+        float delta_y = offset_y * (speed / JOYSTICK_ONE);       // Base rotation
+        float delta_z = -offset_z * (speed / JOYSTICK_ONE);       // Vertical
 
         // Only move if any joystick is being pushed
         if (delta_x != 0 || delta_z != 0 || delta_y != 0) {
@@ -160,172 +225,120 @@ int main() {
             float new_x = new_radial * cos(new_base_angle);
             float new_y = new_radial * sin(new_base_angle);
             
-            float base_angle_deg = new_base_angle * 180.0 / M_PI;
-            
-            // Use 2D IK in the vertical plane (radial distance vs height)
-            float shoulder_angle, elbow_angle;
-            
-            if (calculate_2d_ik(new_radial, new_z, &shoulder_angle, &elbow_angle)) {
+            // Keep the wrist point inside its reachable set (servo limits,
+            // wrist included), sliding to the nearest reachable point. The
+            // map is built for ARM_REACH_WRIST_PITCH; regenerate it with
+            // gen_reach_map if APPROACH_PITCH changes.
+            float pointer_r = POINTER_LENGTH * cos(APPROACH_PITCH * M_PI / 180.0);
+            float pointer_z = POINTER_LENGTH * sin(APPROACH_PITCH * M_PI / 180.0);
+            float wrist_u = new_radial - pointer_r - SHOULDER_OFFSET;
+            float wrist_v = new_z - pointer_z - BASE_HEIGHT;
+            if (!reach_map_contains(&arm_reach_wrist, wrist_u, wrist_v)) {
+                reach_map_project(&arm_reach_wrist, &wrist_u, &wrist_v, ARM_REACH_MARGIN);
+                new_radial = wrist_u + SHOULDER_OFFSET + pointer_r;
+                new_z = wrist_v + BASE_HEIGHT + pointer_z;
+                new_x = new_radial * cos(new_base_angle);
+                new_y = new_radial * sin(new_base_angle);
+            }
+            loop_timing_mark(LOOP_STAGE_BOUNDARY);
+
+            // One full-arm solve for base, shoulder, elbow and wrist pitch
+            bool moved = move_to_tip(new_x, new_y, new_z, MOTION_PROFILE_LINEAR, JOY_MOVE_MS);
+            loop_timing_mark(LOOP_STAGE_SERVO);
+            if (moved) {
                 current_x = new_x;
                 current_y = new_y;
                 current_z = new_z;
-                
-                uint moving_pins[] = {BASE, SHOULDER, ELBOW};
-                int moving_nums[] = {0, 1, 2};
-                int target_angles[] = {(int)(90 + base_angle_deg), (int)shoulder_angle, (int)elbow_angle};
-                move_servos_coordinated(moving_pins, moving_nums, target_angles, 3, 200);
-                
-            } else {
-                // Boundary sliding: scale to reachable sphere
-                float desired_dist = sqrt(new_radial * new_radial + new_z * new_z);
-                
-                if (desired_dist > (LINK1 + LINK2)) {
-                    float scale = (LINK1 + LINK2) / desired_dist;
-                    float clamped_radial = new_radial * scale;
-                    float boundary_z = new_z * scale;
-                    
-                    float boundary_x = clamped_radial * cos(new_base_angle);
-                    float boundary_y = clamped_radial * sin(new_base_angle);
-                    
-                    if (calculate_2d_ik(clamped_radial, boundary_z, &shoulder_angle, &elbow_angle)) {
-                        current_x = boundary_x;
-                        current_y = boundary_y;
-                        current_z = boundary_z;
-                        
-                        uint moving_pins[] = {BASE, SHOULDER, ELBOW};
-                        int moving_nums[] = {0, 1, 2};
-                        int target_angles[] = {(int)(90 + base_angle_deg), (int)shoulder_angle, (int)elbow_angle};
-                        move_servos_coordinated(moving_pins, moving_nums, target_angles, 3, 200);
-                    }
-                }
             }
         }
+#endif
+#if JOY_TELEMETRY_HZ
+        telemetry_set_target(current_x, current_y, current_z);
+        uint16_t loop_adc[] = {side_1_raw, top_raw, side_2_raw};
+        telemetry_record_loop(loop_adc, 3, current_positions);
+        telemetry_loop_end();
+#else
         // Print position once per second
-        uint32_t current_time = to_ms_since_boot(get_absolute_time());
+        uint32_t current_time = hal_time_ms();
         if (current_time - last_print_time >= 1000) {
             printf("ADC0=%d ADC1=%d ADC2=%d | X=%.1f Y=%.1f Z=%.1f\n", side_1_raw, top_raw, side_2_raw, current_x, current_y, current_z);
             last_print_time = current_time;
         }
+#endif
+        loop_timing_poll();
+        loop_timing_mark(LOOP_STAGE_TELEMETRY);
 
-        sleep_ms(50);  // 20Hz update rate
+        // 20Hz update rate. If a pass overran, skip the missed deadlines
+        // rather than running the next ones back to back
+        next_input_us += INPUT_PERIOD_MS * 1000;
+        uint64_t now_us = hal_time_us();
+        if (next_input_us < now_us) next_input_us = now_us;
+#if JOY_TELEMETRY_HZ
+        telemetry_sleep_until_us(next_input_us);
+#else
+        hal_sleep_until_us(next_input_us);
+#endif
     }
     return 0;
 }
 
-int angle_to_pulse(int servo_num, int angle) {
-    int min_pulse, max_pulse;
-    if (servo_num < 3) {
-        min_pulse = 750;
-        max_pulse = 4600;
-    } else {
-        min_pulse = 700;
-        max_pulse = 4550;
-    }
-    return min_pulse + (angle * (max_pulse - min_pulse) / 180);
-}
+// Solves the whole arm for the pointer tip at (x, y, z) and queues the move
+// on the branch closest to where the arm is, with hysteresis. A LINEAR step
+// whose branch is more than a step away (no continuous path) becomes a
+// time-optimal S-curve reconfiguration, waited for here. Returns false if
+// unreachable or the queue is full.
+bool move_to_tip(float x, float y, float z, motion_profile_type_t profile, int duration_ms) {
+    arm_pose_t poses[ARM_IK_MAX_SOLUTIONS];
+    int count = calculate_arm_ik(x, y, z, APPROACH_PITCH, poses);
 
-void set_servo_angle(uint servo_pin, int servo_num, int angle) {
-    uint slice = pwm_gpio_to_slice_num(servo_pin);
-    uint channel = pwm_gpio_to_channel(servo_pin);
-    int target_pulse = angle_to_pulse(servo_num, angle);
-    
-    move_servo_slow(slice, channel, current_positions[servo_num], target_pulse, 1000);
-    current_positions[servo_num] = target_pulse;
-}
+    arm_pose_t current = {pulse_to_angle(0, current_positions[0]), pulse_to_angle(1, current_positions[1]),
+                          pulse_to_angle(2, current_positions[2]), pulse_to_angle(4, current_positions[4]),
+                          current_config};
+    int pick = arm_ik_select_branch(poses, count, &current);
+    loop_timing_mark(LOOP_STAGE_IK);
+    if (pick < 0) return false;
 
-// Slow servo movement
-void move_servo_slow(uint slice, uint channel, int start_pos, int end_pos, int duration_ms) {
-    int steps = 50;
-    int delay = duration_ms / steps;
-    
-    for (int i = 0; i <= steps; i++) {
-        int current_pos = start_pos + ((end_pos - start_pos) * i / steps);
-        pwm_set_chan_level(slice, channel, current_pos);
-        sleep_ms(delay);
+    bool reconfigure = profile == MOTION_PROFILE_LINEAR && arm_pose_travel(&poses[pick], &current) > ARM_IK_CONTINUOUS_DEG;
+    if (reconfigure) {
+        printf("Elbow reconfiguration to config %d\n", poses[pick].config);
+        profile = MOTION_PROFILE_SCURVE;
+        duration_ms = 0;
     }
+
+    int moving_nums[] = {0, 1, 2, 4};
+    float target_angles[] = {poses[pick].base, poses[pick].shoulder, poses[pick].elbow, poses[pick].wrist_pitch};
+    if (!move_servos_coordinated(moving_nums, target_angles, 4, profile, duration_ms)) return false;
+    if (reconfigure) motion_executor_wait_idle();
+
+    current_config = poses[pick].config;
+    return true;
 }
 
-// 2D IK function - returns shoulder and elbow angles
-bool calculate_2d_ik(float x, float z, float *shoulder_angle, float *elbow_angle) {
-    // Calculate distance to target
-    float distance = sqrt(x*x + z*z);
-    
-    // Check reachability
-    if (distance > (LINK1 + LINK2)) {
-        return false;
-    }
-    
-    if (distance < fabs(LINK1 - LINK2)) {
-        return false;
-    }
-    
-    // Calculate base angles using law of cosines
-    float cos_elbow = (LINK1*LINK1 + LINK2*LINK2 - distance*distance) / (2.0 * LINK1 * LINK2);
-    float angle_to_target = atan2(z, x) * 180.0 / M_PI;
-    float cos_shoulder_offset = (LINK1*LINK1 + distance*distance - LINK2*LINK2) / (2.0 * LINK1 * distance);
-    float shoulder_offset = acos(cos_shoulder_offset) * 180.0 / M_PI;
-    
-    // Two possible IK solutions
-    float shoulder_ik_1 = angle_to_target + shoulder_offset;
-    float elbow_ik_1 = 180.0 - (acos(cos_elbow) * 180.0 / M_PI);  // Invert
-    
-    float shoulder_ik_2 = angle_to_target - shoulder_offset;
-    float elbow_ik_2 = -elbow_ik_1;
-    
-    // Apply mounting offset and convert to physical servo angles for both configs
-    int shoulder_physical_1 = 90 - (int)(shoulder_ik_1 + 28);
-    int elbow_physical_1 = 90 - (int)elbow_ik_1;
-    
-    int shoulder_physical_2 = 90 - (int)(shoulder_ik_2 + 28);
-    int elbow_physical_2 = 90 - (int)elbow_ik_2;
-    
-    // Check which configuration has valid servo angles
-    bool config1_valid = (shoulder_physical_1 >= 0 && shoulder_physical_1 <= 180 && elbow_physical_1 >= 0 && elbow_physical_1 <= 180);
-    bool config2_valid = (shoulder_physical_2 >= 0 && shoulder_physical_2 <= 180 && elbow_physical_2 >= 0 && elbow_physical_2 <= 180);
-    
-    // Return the valid configuration (already converted to physical angles)
-    if (config1_valid) {
-        *shoulder_angle = shoulder_physical_1;
-        *elbow_angle = elbow_physical_1;
-        return true;
-    } else if (config2_valid) {
-        *shoulder_angle = shoulder_physical_2;
-        *elbow_angle = elbow_physical_2;
-        return true;
-    } else {
-        return false;
-    }
+// Queues base yaw and shoulder/elbow IK-frame angles at sub-degree
+// resolution, with the wrist holding APPROACH_PITCH. Returns false if the
+// wrist servo can't hold the pitch or the queue is full.
+bool move_arm_joints(float yaw_deg, float shoulder_deg, float elbow_deg, motion_profile_type_t profile, int duration_ms) {
+    float wrist = WRIST_PITCH_STRAIGHT - (shoulder_deg - elbow_deg - APPROACH_PITCH);
+    if (wrist < 0.0f || wrist > 180.0f) return false;
+
+    int nums[] = {0, 1, 2, 4};
+    int pulses[] = {angle_to_pulse_f(0, 90.0f + yaw_deg),
+                    angle_to_pulse_f(1, SERVO_SHOULDER_FROM_IK(shoulder_deg)),
+                    angle_to_pulse_f(2, SERVO_ELBOW_FROM_IK(elbow_deg)),
+                    angle_to_pulse_f(4, wrist)};
+
+    return move_servo_pulses(nums, pulses, 4, profile, duration_ms);
 }
 
-void move_servos_coordinated(uint servo_pins[], int servo_nums[], int target_angles[], int num_servos, int duration_ms) {
-    int steps = 50;
-    int delay = duration_ms / steps;
-    
-    // Get starting pulse values for each servo
-    int start_pulses[num_servos];
-    int end_pulses[num_servos];
-    uint slices[num_servos];
-    uint channels[num_servos];
-    
-    for (int i = 0; i < num_servos; i++) {
-        start_pulses[i] = current_positions[servo_nums[i]];
-        end_pulses[i] = angle_to_pulse(servo_nums[i], target_angles[i]);
-        slices[i] = pwm_gpio_to_slice_num(servo_pins[i]);
-        channels[i] = pwm_gpio_to_channel(servo_pins[i]);
-    }
-    
-    // Move all servos together in small increments
-    for (int step = 0; step <= steps; step++) {
-        for (int i = 0; i < num_servos; i++) {
-            int current_pulse = start_pulses[i] + 
-                              ((end_pulses[i] - start_pulses[i]) * step / steps);
-            pwm_set_chan_level(slices[i], channels[i], current_pulse);
-        }
-        sleep_ms(delay);
-    }
-    
-    // Update tracked positions
-    for (int i = 0; i < num_servos; i++) {
-        current_positions[servo_nums[i]] = end_pulses[i];
-    }
-}
\ No newline at end of file
+// Pointer tip position for a joint state, pointer at APPROACH_PITCH
+void tip_from_joints(float yaw_deg, float shoulder_deg, float elbow_deg, float *x, float *y, float *z) {
+    float u, v;
+    forward_2link(LINK1, FOREARM_LENGTH, shoulder_deg, elbow_deg, &u, &v);
+
+    float pitch = APPROACH_PITCH * (float)M_PI / 180.0f;
+    float radial = SHOULDER_OFFSET + u + POINTER_LENGTH * cosf(pitch);
+    float yaw = yaw_deg * (float)M_PI / 180.0f;
+    *x = radial * cosf(yaw);
+    *y = radial * sinf(yaw);
+    *z = BASE_HEIGHT + v + POINTER_LENGTH * sinf(pitch);
+}
@@ -1,16 +1,28 @@
-#include <Servo.h>
+#include <Arduino.h>
 #include <math.h>
-
-// Pin definitions
-#define BASE_PIN        9
-#define SHOULDER_PIN    11
-#define ELBOW_PIN       12
-#define WRIST_ROLL_PIN  6
-#define WRIST_PITCH_PIN 5
-
-#define JOY_X_PIN A0
-#define JOY_Y_PIN A1
-#define JOY2_Y_PIN A2  // Second joystick - wrist pitch
+#include "arm_hal.h"      // arm_core library (arm_core/library.properties)
+#include "arm_servo.h"
+#include "arm_move.h"
+#include "arm_ik.h"
+#include "arm_joystick.h"
+#include "ik_table.h"  // Generated by tools/gen_ik_table.c
+
+// Uncomment to run the IK benchmark from setup() instead of the joystick loop
+// #define IK_BENCH
+
+// Joystick mode, as on the Pico (ik_js_control.c). Resolved rate (1): the
+// joystick sets the tip velocity, joint rates come from the Jacobian and the
+// integrated angles are streamed to the servos over each loop period.
+// Position (0): per-loop IK with 200ms moves.
+#define JOY_RESOLVED_RATE 1
+#define JOY_MAX_SPEED 60.0f  // mm/s at full deflection
+
+#define LOOP_PERIOD_MS 50  // 20Hz
+
+// Joystick ADC inputs (A0-A2)
+#define JOY_X_INPUT  0
+#define JOY_Y_INPUT  1
+#define JOY2_Y_INPUT 2  // Second joystick - wrist pitch
 
 // Servo indices
 #define BASE        0
@@ -19,156 +31,194 @@
 #define WRIST_ROLL  3
 #define WRIST_PITCH 4
 
-// Link lengths in mm
-#define LINK1 114.0  // Shoulder to elbow
-#define LINK2 204.0  // Elbow to pointer tip (87 + 37 + 80)
-
-Servo servos[5];
-const uint8_t servo_pins[5] = {BASE_PIN, SHOULDER_PIN, ELBOW_PIN, WRIST_ROLL_PIN, WRIST_PITCH_PIN};
-
-// Current positions stored as microseconds
-int current_positions[5] = {0, 0, 0, 0, 0};
-
-// Pulse ranges per servo - matching your Pico calibration
-// Servos 0-2 (base/shoulder/elbow): 750–4600 over 180° on Pico (wrap=39062, clkdiv=64)
-// Servos 3-4 (wrist roll/pitch):    700–4550
-//
-// Pico PWM: period = 39062 * (64/125MHz) = ~20ms
-// So pulse counts map directly to microseconds:
-//   Pico count 750  → 750  * (20000/39062) ≈ 384 µs
-//   Pico count 4600 → 4600 * (20000/39062) ≈ 2355 µs
-//
-// Conversion factor: µs = count * (20000.0 / 39062.0) = count * 0.512
-#define PICO_TO_US(count) ((int)((count) * 20000.0 / 39062.0))
-
-// Pre-computed pulse ranges in microseconds
-// Servos 0-2: 750→384µs, 4600→2355µs
-// Servos 3-4: 700→358µs, 4550→2330µs
-const int min_pulse_us[5] = { PICO_TO_US(750),  PICO_TO_US(750),  PICO_TO_US(750),  PICO_TO_US(700),  PICO_TO_US(700)  };
-const int max_pulse_us[5] = { PICO_TO_US(4600), PICO_TO_US(4600), PICO_TO_US(4600), PICO_TO_US(4550), PICO_TO_US(4550) };
+// Servo pins, link lengths and the servo calibration (in Pico counts, the
+// same tables as the Pico builds) all come from arm_core's arm_config.h.
+// arm_core positions are Pico counts too; the Nano HAL converts them to
+// Timer1 ticks for its servo driver.
 
 // Current arm position in mm
 float current_x = 318.0;
 float current_z = 0.0;
-int wrist_pitch_angle = 145;  // Track wrist pitch angle directly
+float wrist_pitch_angle = 145;  // Track wrist pitch angle directly
+
+joystick_t stick, pitch_stick;
+
+#if JOY_RESOLVED_RATE
+// Joint state in IK-frame degrees: shoulder from horizontal, elbow bend
+float joint_shoulder = 0;
+float joint_elbow = 0;
+bool elbow_up = true;
+unsigned long last_rate_ms = 0;
+#endif
 
 // Function declarations
-int angle_to_us(int servo_num, int angle);
-void set_servo_angle(int servo_num, int angle);
-void move_servo_slow(int servo_num, int end_us, int duration_ms);
-bool calculate_2d_ik(float x, float z, float *shoulder_angle, float *elbow_angle);
-void move_servos_coordinated(int servo_nums[], int target_angles[], int num_servos, int duration_ms);
-
-// Convert angle to microseconds for a given servo
-int angle_to_us(int servo_num, int angle) {
-    return min_pulse_us[servo_num] + ((long)angle * (max_pulse_us[servo_num] - min_pulse_us[servo_num]) / 180);
+bool solve_2d_ik(float x, float z, float *shoulder_angle, float *elbow_angle);
+bool ik_table_lookup(float x, float z, float *shoulder_angle, float *elbow_angle);
+
+// IK via the flash lookup table, falling back to the exact solver near the
+// workspace edges and the config 1/2 border where the table has no data
+bool solve_2d_ik(float x, float z, float *shoulder_angle, float *elbow_angle) {
+    if (ik_table_lookup(x, z, shoulder_angle, elbow_angle)) return true;
+    return calculate_2d_ik_float(x, z, shoulder_angle, elbow_angle);
 }
 
-void set_servo_angle(int servo_num, int angle) {
-    int target_us = angle_to_us(servo_num, angle);
-    move_servo_slow(servo_num, target_us, 1000);
-    current_positions[servo_num] = target_us;
+// Bilinear blend of the 4 table entries around index i.
+// fx/fz are 8-bit fractions; result is in IK_TABLE_SCALE * 256 units per degree.
+static long ik_table_bilinear(const uint16_t *table, int i, long fx, long fz) {
+    long a = pgm_read_word(&table[i]);
+    long b = pgm_read_word(&table[i + 1]);
+    long c = pgm_read_word(&table[i + IK_TABLE_COLS]);
+    long d = pgm_read_word(&table[i + IK_TABLE_COLS + 1]);
+
+    long near_row = a * (256 - fx) + b * fx;
+    long far_row = c * (256 - fx) + d * fx;
+    return (near_row * (256 - fz) + far_row * fz) >> 8;
 }
 
-void move_servo_slow(int servo_num, int end_us, int duration_ms) {
-    int steps = 50;
-    int step_delay = duration_ms / steps;
-    int start_us = current_positions[servo_num];
-
-    for (int i = 0; i <= steps; i++) {
-        int current_us = start_us + ((long)(end_us - start_us) * i / steps);
-        servos[servo_num].writeMicroseconds(current_us);
-        delay(step_delay);
-    }
+// Returns false if (x, z) falls outside the table or in a cell marked invalid
+bool ik_table_lookup(float x, float z, float *shoulder_angle, float *elbow_angle) {
+    // Grid position with 8 fractional bits
+    long gx = (long)((x - IK_TABLE_X0) * (256.0 / IK_TABLE_STEP));
+    long gz = (long)((z - IK_TABLE_Z0) * (256.0 / IK_TABLE_STEP));
+    if (gx < 0 || gz < 0) return false;
+
+    int col = gx >> 8;
+    int row = gz >> 8;
+    if (col >= IK_TABLE_COLS - 1 || row >= IK_TABLE_ROWS - 1) return false;
+
+    int cell = row * (IK_TABLE_COLS - 1) + col;
+    if (!(pgm_read_byte(&ik_table_cell_valid[cell >> 3]) & (1 << (cell & 7)))) return false;
+
+    int i = row * IK_TABLE_COLS + col;
+    long fx = gx & 0xFF;
+    long fz = gz & 0xFF;
+    *shoulder_angle = ik_table_bilinear(ik_table_shoulder, i, fx, fz) * (1.0 / (IK_TABLE_SCALE * 256.0));
+    *elbow_angle = ik_table_bilinear(ik_table_elbow, i, fx, fz) * (1.0 / (IK_TABLE_SCALE * 256.0));
+    return true;
 }
 
-bool calculate_2d_ik(float x, float z, float *shoulder_angle, float *elbow_angle) {
-    float distance = sqrt(x * x + z * z);
-
-    if (distance > (LINK1 + LINK2)) return false;
-    if (distance < fabs(LINK1 - LINK2)) return false;
-
-    float cos_elbow = (LINK1 * LINK1 + LINK2 * LINK2 - distance * distance) / (2.0 * LINK1 * LINK2);
-    float angle_to_target = atan2(z, x) * 180.0 / M_PI;
-    float cos_shoulder_offset = (LINK1 * LINK1 + distance * distance - LINK2 * LINK2) / (2.0 * LINK1 * distance);
-    float shoulder_offset = acos(cos_shoulder_offset) * 180.0 / M_PI;
-
-    // Two IK solutions
-    float shoulder_ik_1 = angle_to_target + shoulder_offset;
-    float elbow_ik_1 = 180.0 - (acos(cos_elbow) * 180.0 / M_PI);
-
-    float shoulder_ik_2 = angle_to_target - shoulder_offset;
-    float elbow_ik_2 = -elbow_ik_1;
-
-    // Apply mounting offset (28°) and convert to physical servo angles
-    int shoulder_physical_1 = 90 - (int)(shoulder_ik_1 + 28);
-    int elbow_physical_1 = 90 - (int)elbow_ik_1;
-
-    int shoulder_physical_2 = 90 - (int)(shoulder_ik_2 + 28);
-    int elbow_physical_2 = 90 - (int)elbow_ik_2;
+#ifdef IK_BENCH
+/*
+ * IK benchmark, same target sweep as ik_bench/ik_bench.c on the Pico.
+ * Timed with micros() (4us resolution at 16MHz), so results are in us
+ * rather than cycles. Samples are uint16_t to fit in the Nano's 2KB of RAM.
+ */
+#define BENCH_ROUNDS 16
+#define BENCH_TARGETS 4
+#define BENCH_SAMPLES (BENCH_ROUNDS * BENCH_TARGETS)
+
+static const char *const bench_case_names[4] = {"config1", "config2", "unreachable", "too_close"};
+static const float bench_targets[4][BENCH_TARGETS][2] = {
+    {{250, 50}, {300, -50}, {0, -250}, {-200, -150}},
+    {{150, 200}, {50, 250}, {-50, 250}, {200, 150}},
+    {{330, 0}, {250, 250}, {0, -330}, {-300, 200}},
+    {{50, 20}, {0, 60}, {-40, -40}, {70, 0}},
+};
+
+static uint16_t bench_samples[BENCH_SAMPLES];
+static volatile float bench_sink;
+
+static int bench_compare(const void *a, const void *b) {
+    uint16_t x = *(const uint16_t *)a;
+    uint16_t y = *(const uint16_t *)b;
+    return (x > y) - (x < y);
+}
 
-    bool config1_valid = (shoulder_physical_1 >= 0 && shoulder_physical_1 <= 180 &&
-                          elbow_physical_1 >= 0 && elbow_physical_1 <= 180);
-    bool config2_valid = (shoulder_physical_2 >= 0 && shoulder_physical_2 <= 180 &&
-                          elbow_physical_2 >= 0 && elbow_physical_2 <= 180);
+static void bench_report(const char *kernel, const char *case_name) {
+    qsort(bench_samples, BENCH_SAMPLES, sizeof(bench_samples[0]), bench_compare);
+    Serial.print(kernel);
+    Serial.print(' ');
+    Serial.print(case_name);
+    Serial.print(" min=");
+    Serial.print(bench_samples[0]);
+    Serial.print(" median=");
+    Serial.print(bench_samples[BENCH_SAMPLES / 2]);
+    Serial.print(" p99=");
+    Serial.print(bench_samples[(BENCH_SAMPLES * 99) / 100]);
+    Serial.println(" us");
+}
 
-    if (config1_valid) {
-        *shoulder_angle = shoulder_physical_1;
-        *elbow_angle = elbow_physical_1;
-        return true;
-    } else if (config2_valid) {
-        *shoulder_angle = shoulder_physical_2;
-        *elbow_angle = elbow_physical_2;
-        return true;
+static void bench_ik(const char *kernel, bool (*ik)(float, float, float *, float *)) {
+    for (int c = 0; c < 4; c++) {
+        int n = 0;
+        for (int round = 0; round < BENCH_ROUNDS; round++) {
+            for (int t = 0; t < BENCH_TARGETS; t++) {
+                float shoulder, elbow;
+                unsigned long start = micros();
+                if (ik(bench_targets[c][t][0], bench_targets[c][t][1], &shoulder, &elbow)) {
+                    bench_sink = shoulder + elbow;
+                }
+                bench_samples[n++] = micros() - start;
+            }
+        }
+        bench_report(kernel, bench_case_names[c]);
     }
-    return false;
 }
 
-void move_servos_coordinated(int servo_nums[], int target_angles[], int num_servos, int duration_ms) {
-    int steps = 50;
-    int step_delay = duration_ms / steps;
-
-    int start_us[5], end_us[5];
-    for (int i = 0; i < num_servos; i++) {
-        start_us[i] = current_positions[servo_nums[i]];
-        end_us[i] = angle_to_us(servo_nums[i], target_angles[i]);
-    }
+// One pass of the loop() body minus the move: 2 ADC reads, joystick
+// conditioning and speed maths, IK, 2 angle_to_pulse_f
+static void bench_joystick_iteration() {
+    for (int c = 0; c < 4; c++) {
+        int n = 0;
+        for (int round = 0; round < BENCH_ROUNDS; round++) {
+            for (int t = 0; t < BENCH_TARGETS; t++) {
+                unsigned long start = micros();
+
+                uint16_t raw[] = {hal_adc_capture_read(JOY_X_INPUT), hal_adc_capture_read(JOY_Y_INPUT)};
+                int16_t joy[2];
+                joystick_update(&stick, raw, joy);
+
+                float new_x = bench_targets[c][t][0] + joy[0] * (15.0f / JOYSTICK_ONE);
+                float new_z = bench_targets[c][t][1] + joy[1] * (15.0f / JOYSTICK_ONE);
+
+                float shoulder_angle, elbow_angle;
+                if (solve_2d_ik(new_x, new_z, &shoulder_angle, &elbow_angle)) {
+                    bench_sink = angle_to_pulse_f(SHOULDER, shoulder_angle) + angle_to_pulse_f(ELBOW, elbow_angle);
+                }
 
-    for (int step = 0; step <= steps; step++) {
-        for (int i = 0; i < num_servos; i++) {
-            int current_us = start_us[i] + ((long)(end_us[i] - start_us[i]) * step / steps);
-            servos[servo_nums[i]].writeMicroseconds(current_us);
+                bench_samples[n++] = micros() - start;
+            }
         }
-        delay(step_delay);
+        bench_report("joystick_iter", bench_case_names[c]);
     }
+}
 
-    for (int i = 0; i < num_servos; i++) {
-        current_positions[servo_nums[i]] = end_us[i];
-    }
+void run_ik_bench() {
+    Serial.println("=== IK Benchmark ===");
+    bench_ik("ik_table", solve_2d_ik);
+    bench_ik("ik_exact", calculate_2d_ik_float);
+    bench_joystick_iteration();
+    Serial.println("Done");
 }
+#endif
 
 void setup() {
-    Serial.begin(115200);
+    hal_init();
     delay(2000);
 
+    // Joystick conditioning (arm_joystick.h): the first passes of loop()
+    // measure the centres, so leave the sticks alone until the arm settles
+    joystick_init(&stick, 2, HAL_ADC_BITS, 1000 / LOOP_PERIOD_MS);
+    joystick_init(&pitch_stick, 1, HAL_ADC_BITS, 1000 / LOOP_PERIOD_MS);
+
     // LED blink confirmation
-    pinMode(LED_BUILTIN, OUTPUT);
+    hal_gpio_led_init(ARM_LED_PIN);
     for (int i = 0; i < 3; i++) {
-        digitalWrite(LED_BUILTIN, HIGH);
+        hal_gpio_put(ARM_LED_PIN, 1);
         delay(200);
-        digitalWrite(LED_BUILTIN, LOW);
+        hal_gpio_put(ARM_LED_PIN, 0);
         delay(200);
     }
 
-    // Attach servos with per-servo pulse ranges
-    for (int i = 0; i < 5; i++) {
-        servos[i].attach(servo_pins[i], min_pulse_us[i], max_pulse_us[i]);
+#ifdef IK_BENCH
+    // Runs before the servos are attached so the arm stays still
+    run_ik_bench();
+    while (true) {
     }
+#endif
 
-    // Initialize tracked positions to 90°
-    for (int i = 0; i < 5; i++) {
-        current_positions[i] = angle_to_us(i, 90);
-    }
+    // Attach servos, positions start at 90 degrees
+    arm_servos_init();
 
     // Set base and wrists to neutral
     set_servo_angle(BASE, 90);
@@ -177,34 +227,69 @@ void setup() {
 
     // Move to starting position (max reach)
     float shoulder_angle, elbow_angle;
-    if (calculate_2d_ik(current_x, current_z, &shoulder_angle, &elbow_angle)) {
+    if (solve_2d_ik(current_x, current_z, &shoulder_angle, &elbow_angle)) {
         int moving_nums[] = {SHOULDER, ELBOW};
-        int target_angles[] = {(int)shoulder_angle, (int)elbow_angle};
-        move_servos_coordinated(moving_nums, target_angles, 2, 1500);
+        float target_angles[] = {shoulder_angle, elbow_angle};
+        move_servos_coordinated(moving_nums, target_angles, 2, MOTION_PROFILE_SCURVE, 1500);
+
+#if JOY_RESOLVED_RATE
+        // Nudge off dead straight so the elbow can fold back
+        joint_shoulder = IK_SHOULDER_FROM_SERVO(shoulder_angle);
+        joint_elbow = IK_ELBOW_FROM_SERVO(elbow_angle);
+        elbow_up = joint_elbow >= 0;
+        clamp_2link_joints(&joint_shoulder, &joint_elbow, elbow_up);
+        forward_2link(LINK1, LINK2, joint_shoulder, joint_elbow, &current_x, &current_z);
+#endif
     }
 
     delay(1000);
+#if JOY_RESOLVED_RATE
+    last_rate_ms = millis();
+#endif
 }
 
 void loop() {
     static unsigned long last_print_time = 0;
+    static uint64_t next_loop_us = hal_time_us();
+
+    // Read joysticks, centred, filtered and dead zoned (Nano ADC is 10-bit)
+    uint16_t raw[] = {hal_adc_capture_read(JOY_X_INPUT), hal_adc_capture_read(JOY_Y_INPUT)};
+    uint16_t pitch_raw[] = {hal_adc_capture_read(JOY2_Y_INPUT)};
+    int16_t joy[2], pitch[1];
+    joystick_update(&stick, raw, joy);
+    joystick_update(&pitch_stick, pitch_raw, pitch);
+
+    // Wrist pitch: up to 1 degree per loop at full deflection
+    if (pitch[0] != 0) {
+        wrist_pitch_angle = constrain(wrist_pitch_angle + pitch[0] * (1.0f / JOYSTICK_ONE), 0.0f, 180.0f);
+    }
 
-    // Read joystick (Nano ADC is 10-bit: 0–1023, center ~512)
-    int joy_x_raw = analogRead(JOY_X_PIN);
-    int joy_y_raw = analogRead(JOY_Y_PIN);
-
-    // Calculate offset from center (10-bit)
-    int dead_zone = 75;  // Scaled from 300/4096 for 10-bit
-    int offset_x = joy_x_raw - 512;
-    int offset_y = joy_y_raw - 512;
+#if JOY_RESOLVED_RATE
+    // Integrate over the real loop time; a move or printing can stretch it
+    unsigned long now_ms = millis();
+    float dt = (now_ms - last_rate_ms) / 1000.0;
+    last_rate_ms = now_ms;
 
-    if (abs(offset_x) < dead_zone) offset_x = 0;
-    if (abs(offset_y) < dead_zone) offset_y = 0;
+    if (joy[0] != 0 || joy[1] != 0) {
+        step_2link_rates(LINK1, LINK2, &joint_shoulder, &joint_elbow, joy[0] * (JOY_MAX_SPEED / JOYSTICK_ONE),
+                         joy[1] * (JOY_MAX_SPEED / JOYSTICK_ONE), dt, elbow_up);
+        forward_2link(LINK1, LINK2, joint_shoulder, joint_elbow, &current_x, &current_z);
+    }
 
+    // Stream the joints over most of the loop period
+    int nums[] = {SHOULDER, ELBOW, WRIST_PITCH};
+    int pulses[] = {angle_to_pulse_f(SHOULDER, SERVO_SHOULDER_FROM_IK(joint_shoulder)),
+                    angle_to_pulse_f(ELBOW, SERVO_ELBOW_FROM_IK(joint_elbow)),
+                    angle_to_pulse_f(WRIST_PITCH, wrist_pitch_angle)};
+    if (pulses[0] != current_positions[SHOULDER] || pulses[1] != current_positions[ELBOW] ||
+        pulses[2] != current_positions[WRIST_PITCH]) {
+        move_servo_pulses(nums, pulses, 3, MOTION_PROFILE_LINEAR, LOOP_PERIOD_MS - 2 * MOTION_TICK_MS);
+    }
+#else
     // Convert to movement speed (mm per update)
     float speed = 15.0;
-    float delta_x = (offset_x / 512.0) * speed;
-    float delta_z = (offset_y / 512.0) * speed;
+    float delta_x = joy[0] * (speed / JOYSTICK_ONE);
+    float delta_z = joy[1] * (speed / JOYSTICK_ONE);
 
     float shoulder_angle, elbow_angle;
 
@@ -212,13 +297,13 @@ void loop() {
         float new_x = current_x + delta_x;
         float new_z = current_z + delta_z;
 
-        if (calculate_2d_ik(new_x, new_z, &shoulder_angle, &elbow_angle)) {
+        if (solve_2d_ik(new_x, new_z, &shoulder_angle, &elbow_angle)) {
             current_x = new_x;
             current_z = new_z;
 
             int moving_nums[] = {SHOULDER, ELBOW};
-            int target_angles[] = {(int)shoulder_angle, (int)elbow_angle};
-            move_servos_coordinated(moving_nums, target_angles, 2, 200);
+            float target_angles[] = {shoulder_angle, elbow_angle};
+            move_servos_coordinated(moving_nums, target_angles, 2, MOTION_PROFILE_LINEAR, 200);
         } else {
             // Slide along boundary
             float distance = sqrt(new_x * new_x + new_z * new_z);
@@ -232,28 +317,24 @@ void loop() {
                 float boundary_x = (LINK1 + LINK2) * cos(new_angle);
                 float boundary_z = (LINK1 + LINK2) * sin(new_angle);
 
-                if (calculate_2d_ik(boundary_x, boundary_z, &shoulder_angle, &elbow_angle)) {
+                if (solve_2d_ik(boundary_x, boundary_z, &shoulder_angle, &elbow_angle)) {
                     current_x = boundary_x;
                     current_z = boundary_z;
 
                     int moving_nums[] = {SHOULDER, ELBOW};
-                    int target_angles[] = {(int)shoulder_angle, (int)elbow_angle};
-                    move_servos_coordinated(moving_nums, target_angles, 2, 200);
+                    float target_angles[] = {shoulder_angle, elbow_angle};
+                    move_servos_coordinated(moving_nums, target_angles, 2, MOTION_PROFILE_LINEAR, 200);
                 }
             }
         }
     }
 
-    // Read second joystick for wrist pitch
-    int joy2_y_raw = analogRead(JOY2_Y_PIN);
-    int offset_pitch = joy2_y_raw - 512;
-    if (abs(offset_pitch) < dead_zone) offset_pitch = 0;
-
-    if (offset_pitch != 0) {
-        wrist_pitch_angle = constrain(wrist_pitch_angle + (offset_pitch > 0 ? 1 : -1), 0, 180);
-        servos[WRIST_PITCH].writeMicroseconds(angle_to_us(WRIST_PITCH, wrist_pitch_angle));
-        current_positions[WRIST_PITCH] = angle_to_us(WRIST_PITCH, wrist_pitch_angle);
+    int pitch_nums[] = {WRIST_PITCH};
+    float pitch_angles[] = {wrist_pitch_angle};
+    if (angle_to_pulse_f(WRIST_PITCH, wrist_pitch_angle) != current_positions[WRIST_PITCH]) {
+        move_servos_coordinated(pitch_nums, pitch_angles, 1, MOTION_PROFILE_LINEAR, 0);
     }
+#endif
 
     // Print position once per second
     unsigned long current_time = millis();
@@ -266,5 +347,9 @@ void loop() {
         last_print_time = current_time;
     }
 
-    delay(50);  // 20Hz update rate
+    // 20Hz, to absolute deadlines; a pass that overran skips ahead
+    next_loop_us += LOOP_PERIOD_MS * 1000UL;
+    uint64_t now_us = hal_time_us();
+    if (next_loop_us < now_us) next_loop_us = now_us;
+    hal_sleep_until_us(next_loop_us);
 }
@@ -0,0 +1,153 @@
+// Generated by tools/gen_ik_table.c - do not edit
+// LINK1=114 LINK2=204, shoulder mount offset 28 deg
+// Bilinear error inside valid cells <= 1.0 deg
+
+#ifndef IK_TABLE_H
+#define IK_TABLE_H
+
+#include <avr/pgmspace.h>
+
+#define IK_TABLE_X0    -252     // mm, first grid column
+#define IK_TABLE_Z0    -300     // mm, first grid row
+#define IK_TABLE_STEP  12       // mm between grid points
+#define IK_TABLE_COLS  47
+#define IK_TABLE_ROWS  51
+#define IK_TABLE_SCALE 64       // Table units per degree
+
+const uint16_t ik_table_shoulder[IK_TABLE_ROWS * IK_TABLE_COLS] PROGMEM = {
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 10187,  9735,  9384,  9087,  8827,  8596,  8391,  8210,  8052,  7917,  7806,  7721,  7664,  7640,  7657,  7733,  7915,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 10879, 10218,  9777,  9412,  9093,  8805,  8543,  8304,  8084,  7884,  7703,  7541,  7398,  7274,  7172,  7093,  7037,  7009,  7011,  7053,  7146,  7323,  7727,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0, 11232, 10479,  9999,  9603,  9253,  8936,  8643,  8372,  8119,  7884,  7665,  7463,  7278,  7110,  6959,  6827,  6714,  6621,  6549,  6500,  6477,  6481,  6518,  6595,  6728,  6953,  7459,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0, 10926, 10362,  9918,  9532,  9183,  8860,  8558,  8275,  8007,  7755,  7518,  7295,  7088,  6897,  6722,  6564,  6424,  6302,  6199,  6116,  6054,  6015,  6001,  6012,  6054,  6132,  6256,  6448,  6770,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0, 10873, 10351,  9918,  9532,  9177,  8846,  8533,  8236,  7953,  7683,  7427,  7185,  6956,  6742,  6543,  6361,  6194,  6046,  5916,  5805,  5713,  5642,  5593,  5566,  5564,  5587,  5639,  5725,  5853,  6039,  6324,  6916,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0, 10921, 10412,  9978,  9587,  9225,  8883,  8558,  8247,  7949,  7662,  7387,  7124,  6874,  6637,  6414,  6206,  6015,  5840,  5683,  5545,  5426,  5328,  5250,  5193,  5158,  5146,  5158,  5196,  5262,  5360,  5499,  5692,  5973,  6468,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0, 11040, 10528, 10089,  9690,  9319,  8967,  8630,  8305,  7991,  7687,  7394,  7111,  6838,  6578,     0,     0,     0,     0,     0,     0,     0,  5056,  4951,  4867,  4805,  4765,  4747,  4752,  4781,  4835,  4918,  5033,  5188,  5395,  5687,  6173,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0, 11216, 10693, 10244,  9836,  9455,  9092,  8743,  8406,  8077,  7757,  7446,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  4378,  4357,  4358,  4383,  4431,  4505,  4607,  4741,  4915,  5142,  5456,  5975,     0,     0,     0,     0,     0,     0,
+        0,     0, 11447, 10902, 10440, 10021,  9630,  9257,  8897,  8547,  8205,  7870,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  3971,  3994,  4039,  4109,  4204,  4328,  4483,  4680,  4933,  5280,  5874,     0,     0,     0,     0,     0,
+        0,     0, 11155, 10675, 10243,  9841,  9458,  9089,  8728,  8374,  8026,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  3609,  3655,  3724,  3817,  3935,  4081,  4261,  4484,  4768,  5161,  5931,     0,     0,     0,     0,
+        0, 11452, 10948, 10501, 10088,  9695,  9316,  8946,  8582,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  3345,  3439,  3556,  3698,  3870,  4076,  4329,  4652,  5113,     0,     0,     0,     0,
+        0, 11259, 10793, 10367,  9964,  9577,  9199,  8826,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  3066,  3186,  3329,  3497,  3695,  3930,  4218,  4591,  5166,     0,     0,     0,
+        0, 11120, 10678, 10265,  9869,  9484,  9105,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  2822,  2968,  3137,  3332,  3559,  3827,  4158,  4602,  5472,     0,     0,
+    11485, 11022, 10595, 10191,  9799,  9415,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  2614,  2787,  2983,  3207,  3465,  3772,  4158,  4719,     0,     0,
+    11399, 10956, 10541, 10143,  9754,  9369,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  2266,  2445,  2646,  2870,  3123,  3417,  3772,  4239,  5119,     0,
+    11347, 10918, 10512, 10118,  9731,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  2110,  2317,  2545,  2798,  3086,  3423,  3843,  4458,     0,
+    11324, 10906, 10507, 10117,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  1997,  2231,  2487,  2773,  3100,  3493,  4017,     0,
+    11326, 10918, 10525, 10138,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  1686,  1927,  2189,  2476,  2798,  3176,  3652,  4427,
+    11353, 10953, 10565,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  1634,  1902,  2193,  2515,  2883,  3333,  3975,
+    11402, 11010, 10627,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  1351,  1627,  1923,  2247,  2612,  3045,  3624,
+    11473, 11088, 10711,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  1078,  1364,  1667,  1995,  2359,  2783,  3327,
+    11565, 11186, 10816,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   818,  1114,  1425,  1758,  2124,  2544,  3067,
+        0, 11305,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   877,  1196,  1535,  1905,  2324,  2836,
+        0, 11443,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   654,   982,  1328,  1703,  2124,  2631,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   446,   783,  1137,  1518,  1943,  2450,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   255,   601,   962,  1350,  1781,  2292,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,    80,   434,   804,  1199,  1638,  2157,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  7282,   286,   664,  1067,  1514,  2046,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  7059,   156,   542,   954,  1412,  1961,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  7118,  6822,    45,   439,   861,  1333,  1904,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  6858,  6572,     0,   356,   789,  1277,  1880,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  6585,  6309,  6013,   294,   740,  1249,  1897,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  6302,  6034,  5743,   255,   717,  1251,  1973,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  6250,  6009,  5747,  5460,   241,   721,  1293,  2155,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  5939,  5705,  5449,  5163,   252,   758,  1386,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  5826,  5619,  5391,  5138,  4850,   294,   835,  1563,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  5670,  5491,  5290,  5066,  4813,  4519,   372,   968,  1967,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  5322,  5149,  4953,  4729,  4471,     0,   496,  1193,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  5114,  4968,  4799,  4604,  4377,  4109,    93,   688,  1699,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  4870,  4750,  4607,  4439,  4241,  4006,  3718,   279,  1010,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  4591,  4497,  4380,  4238,  4066,  3860,  3607,  3284,   564,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  4327,  4281,  4212,  4119,  4001,  3855,  3675,  3452,  3168,   213,  1156,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,    66,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  3965,  3942,  3897,  3827,  3732,  3608,  3453,  3256,  3003,  2656,   708,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   179,   490,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  3558,  3579,  3578,  3553,  3505,  3431,  3329,  3195,  3021,  2794,  2480,   413,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   249,   542,   825,  1098,  1358,     0,     0,     0,     0,     0,     0,     0,  2880,  2985,  3069,  3131,  3171,  3189,  3184,  3155,  3101,  3018,  2903,  2748,  2541,  2249,   215,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   274,   549,   812,  1062,  1299,  1522,  1730,  1921,  2096,  2253,  2391,  2510,  2608,  2686,  2743,  2778,  2790,  2778,  2740,  2674,  2576,  2437,  2244,  1963,   114,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   253,   509,   751,   980,  1194,  1393,  1575,  1742,  1890,  2020,  2131,  2223,  2294,  2343,  2370,  2372,  2349,  2297,  2211,  2083,  1897,  1612,   171,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   181,   418,   641,   848,  1039,  1214,  1372,  1512,  1634,  1737,  1820,  1882,  1921,  1935,  1924,  1882,  1804,  1680,  1488,  1166,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,    52,   271,   473,   658,   826,   977,  1109,  1222,  1315,  1387,  1436,  1459,  1455,  1418,  1341,  1208,   983,   477,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,    52,   233,   395,   538,   662,   764,   843,   899,   927,   925,   883,   790,   613,   209,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,    19,   130,   215,   272,   296,   279,   203,    21,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+};
+
+const uint16_t ik_table_elbow[IK_TABLE_ROWS * IK_TABLE_COLS] PROGMEM = {
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  4706,  4215,  3886,  3645,  3464,  3332,  3241,  3188,  3170,  3188,  3241,  3332,  3464,  3645,  3886,  4215,  4706,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  5098,  4271,  3796,  3445,  3170,  2951,  2775,  2637,  2532,  2459,  2416,  2402,  2416,  2459,  2532,  2637,  2775,  2951,  3170,  3445,  3796,  4271,  5098,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,  5164,  4187,  3645,  3241,  2918,  2652,  2430,  2247,  2096,  1976,  1884,  1819,  1781,  1768,  1781,  1819,  1884,  1976,  2096,  2247,  2430,  2652,  2918,  3241,  3645,  4187,  5164,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,  4391,  3708,  3223,  2838,  2518,  2247,  2016,  1819,  1653,  1516,  1405,  1320,  1259,  1223,  1211,  1223,  1259,  1320,  1405,  1516,  1653,  1819,  2016,  2247,  2518,  2838,  3223,  3708,  4391,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,  4006,  3388,  2918,  2532,  2205,  1923,  1679,  1466,  1283,  1127,   997,   891,   810,   752,   717,   705,   717,   752,   810,   891,   997,  1127,  1283,  1466,  1679,  1923,  2205,  2532,  2918,  3388,  4006,  5098,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,  3773,  3170,  2697,  2303,  1963,  1666,  1405,  1175,   974,   798,   648,   521,   418,   338,   281,   247,   236,   247,   281,   338,   418,   521,   648,   798,   974,  1175,  1405,  1666,  1963,  2303,  2697,  3170,  3773,  4706,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,  3645,  3033,  2547,  2137,  1781,  1466,  1187,   938,   717,   521,   350,   202,    77,     0,     0,     0,     0,     0,     0,     0,     0,     0,    77,   202,   350,   521,   717,   938,  1187,  1466,  1781,  2137,  2547,  3033,  3645,  4556,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,  3604,  2967,  2459,  2029,  1653,  1320,  1021,   752,   510,   293,    99,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,    99,   293,   510,   752,  1021,  1320,  1653,  2029,  2459,  2967,  3604,  4556,     0,     0,     0,     0,     0,     0,
+        0,     0,  3645,  2967,  2430,  1976,  1578,  1223,   903,   613,   350,   111,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   111,   350,   613,   903,  1223,  1578,  1976,  2430,  2967,  3645,  4706,     0,     0,     0,     0,     0,
+        0,     0,  3033,  2459,  1976,  1553,  1175,   833,   521,   236,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   236,   521,   833,  1175,  1553,  1976,  2459,  3033,  3773,  5098,     0,     0,     0,     0,
+        0,  3170,  2547,  2029,  1578,  1175,   810,   475,   168,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   168,   475,   810,  1175,  1578,  2029,  2547,  3170,  4006,     0,     0,     0,     0,
+        0,  2697,  2137,  1653,  1223,   833,   475,   145,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   145,   475,   833,  1223,  1653,  2137,  2697,  3388,  4391,     0,     0,     0,
+        0,  2303,  1781,  1320,   903,   521,   168,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   168,   521,   903,  1320,  1781,  2303,  2918,  3708,  5164,     0,     0,
+     2532,  1963,  1466,  1021,   613,   236,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   236,   613,  1021,  1466,  1963,  2532,  3223,  4187,     0,     0,
+     2205,  1666,  1187,   752,   350,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   350,   752,  1187,  1666,  2205,  2838,  3645,  5098,     0,
+     1923,  1405,   938,   510,   111,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   111,   510,   938,  1405,  1923,  2518,  3241,  4271,     0,
+     1679,  1175,   717,   293,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   293,   717,  1175,  1679,  2247,  2918,  3796,     0,
+     1466,   974,   521,    99,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,    99,   521,   974,  1466,  2016,  2652,  3445,  4706,
+     1283,   798,   350,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   350,   798,  1283,  1819,  2430,  3170,  4215,
+     1127,   648,   202,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   202,   648,  1127,  1653,  2247,  2951,  3886,
+      997,   521,    77,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,    77,   521,   997,  1516,  2096,  2775,  3645,
+      891,   418,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   418,   891,  1405,  1976,  2637,  3464,
+        0,   338,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   338,   810,  1320,  1884,  2532,  3332,
+        0,   281,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   281,   752,  1259,  1819,  2459,  3241,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   247,   717,  1223,  1781,  2416,  3188,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   236,   705,  1211,  1768,  2402,  3170,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,   247,   717,  1223,  1781,  2416,  3188,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11239,   752,  1259,  1819,  2459,  3241,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11182,   810,  1320,  1884,  2532,  3332,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11546, 11102,   891,  1405,  1976,  2637,  3464,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11443, 10999,   997,  1516,  2096,  2775,  3645,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11318, 10872, 10393,  1653,  2247,  2951,  3886,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11170, 10722, 10237,  1819,  2430,  3170,  4215,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11421, 10999, 10546, 10054,  2016,  2652,  3445,  4706,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11227, 10803, 10345,  9841,  2247,  2918,  3796,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11409, 11010, 10582, 10115,  9597,  2518,  3241,  4271,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11546, 11170, 10768, 10333,  9854,  9315,  2838,  3645,  5098,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11284, 10907, 10499, 10054,  9557,  2532,  3223,  4187,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11352, 10999, 10617, 10200,  9739,  9217,  2918,  3708,  5164,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11375, 11045, 10687, 10297,  9867,  9383,  8823,  3388,  4391,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11352, 11045, 10710, 10345,  9942,  9491,  8973,  8350,  4006,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11546, 11284, 10999, 10687, 10345,  9967,  9544,  9061,  8487,  3773,  5098,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11409,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11409, 11170, 10907, 10617, 10297,  9942,  9544,  9090,  8553,  7875,  4706,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11227, 11421,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 11421, 11227, 11010, 10768, 10499, 10200,  9867,  9491,  9061,  8553,  7916,  4556,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 10803, 10999, 11170, 11318, 11443, 11546,     0,     0,     0,     0,     0,     0,     0, 11546, 11443, 11318, 11170, 10999, 10803, 10582, 10333, 10054,  9739,  9383,  8973,  8487,  7875,  4556,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 10546, 10722, 10872, 10999, 11102, 11182, 11239, 11273, 11284, 11273, 11239, 11182, 11102, 10999, 10872, 10722, 10546, 10345, 10115,  9854,  9557,  9217,  8823,  8350,  7747,  4706,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 10237, 10393, 10523, 10629, 10710, 10768, 10803, 10815, 10803, 10768, 10710, 10629, 10523, 10393, 10237, 10054,  9841,  9597,  9315,  8988,  8602,  8132,  7514,  5098,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 10004, 10115, 10200, 10261, 10297, 10309, 10297, 10261, 10200, 10115, 10004,  9867,  9701,  9504,  9273,  9002,  8682,  8297,  7812,  7129,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  9544,  9636,  9701,  9739,  9752,  9739,  9701,  9636,  9544,  9424,  9273,  9090,  8868,  8602,  8279,  7875,  7333,  6356,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  9061,  9104,  9118,  9104,  9061,  8988,  8883,  8745,  8569,  8350,  8075,  7724,  7249,  6422,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  8332,  8279,  8188,  8056,  7875,  7634,  7305,  6814,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+};
+
+// Cell (col, row) is valid if bit (row * 46 + col) is set
+const uint8_t ik_table_cell_valid[288] PROGMEM = {
+    0x00, 0x80, 0xff, 0x07, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x0f, 0x00, 0x00,
+    0xe0, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0xc0,
+    0xff, 0xff, 0xff, 0x0f, 0x00, 0xf8, 0x7f, 0x80, 0xff, 0x07, 0x00, 0xff,
+    0x01, 0x00, 0xfe, 0x03, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xfc, 0x03,
+    0x00, 0x00, 0xff, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x07, 0x00,
+    0x00, 0x80, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0x1e, 0x00, 0x00,
+    0x00, 0xe0, 0xc7, 0x07, 0x00, 0x00, 0x00, 0xf8, 0xf3, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x07, 0x00, 0x00, 0x00,
+    0x80, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x37, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xe0,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0xe0, 0x06, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xc0,
+    0x3f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x40, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0xe0, 0x01, 0xfe, 0x1f, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x03,
+    0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x07, 0x00,
+    0x00, 0x00, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00,
+};
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef ARM_BOARD_H
+#define ARM_BOARD_H
+
+/*
+ * Board the library is being compiled for, picked at compile time so each
+ * firmware gets exactly one HAL backend with no runtime dispatch. Every
+ * arm_core source can be built for any board; backend files compile to
+ * nothing on the others.
+ *   ARM_BOARD_SIM   host simulation, -DARM_HAL_SIM (arm_hal_sim.c)
+ *   ARM_BOARD_AVR   Arduino Nano, via the Arduino toolchain (arm_hal_avr.cpp)
+ *   ARM_BOARD_PICO  RP2040 with the Pico SDK, the default (arm_hal_pico.c)
+ */
+
+#if defined(ARM_HAL_SIM)
+#define ARM_BOARD_SIM 1
+#elif defined(__AVR__)
+#define ARM_BOARD_AVR 1
+#else
+#define ARM_BOARD_PICO 1
+#endif
+
+// Constant tables: on the AVR they stay in flash and need special reads,
+// everywhere else they're ordinary const data
+#if ARM_BOARD_AVR
+#include <avr/pgmspace.h>
+#define ARM_FLASH PROGMEM
+#define ARM_FLASH_READ_U16(p) pgm_read_word(p)
+#else
+#define ARM_FLASH
+#define ARM_FLASH_READ_U16(p) (*(p))
+#endif
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef ARM_CONFIG_H
+#define ARM_CONFIG_H
+
+/*
+ * Compile-time description of the arm: geometry, servo wiring and
+ * calibration. Everything is a constant, so the IK and servo code is
+ * specialised for this arm when the library is compiled.
+ *
+ * For a different arm, put the values that differ in a header and build
+ * with -DARM_CONFIG_FILE='"my_arm.h"' (ARM_CONFIG_FILE in CMake). Anything
+ * it leaves undefined keeps the default below. The generated tables
+ * (servo calibration, reach map, Nano IK table) are built from the same
+ * header by the tools in tools/, so regenerate them with the same flag;
+ * ARM_SERVO_TABLE names the calibration header to use.
+ */
+
+#include "arm_board.h"
+
+#ifdef ARM_CONFIG_FILE
+#include ARM_CONFIG_FILE
+#endif
+
+// Link lengths in mm
+#ifndef LINK1
+#define LINK1 114.0f  // Shoulder to elbow
+#endif
+#ifndef LINK2
+#define LINK2 204.0f  // Elbow to pointer tip (87 + 37 + 80)
+#endif
+
+#ifndef SHOULDER_MOUNT_OFFSET
+#define SHOULDER_MOUNT_OFFSET 28  // Degrees between shoulder servo zero and IK zero
+#endif
+
+// Full-arm geometry in mm, for calculate_arm_ik()
+#ifndef BASE_HEIGHT
+#define BASE_HEIGHT     97.0f   // Table to shoulder axis
+#endif
+#ifndef SHOULDER_OFFSET
+#define SHOULDER_OFFSET 14.0f   // Base axis to shoulder axis, horizontal
+#endif
+#ifndef FOREARM_LENGTH
+#define FOREARM_LENGTH  124.0f  // Elbow to wrist pitch axis (87 + 37)
+#endif
+#ifndef POINTER_LENGTH
+#define POINTER_LENGTH  80.0f   // Wrist pitch axis to pointer tip
+#endif
+
+#ifndef WRIST_PITCH_STRAIGHT
+#define WRIST_PITCH_STRAIGHT 145  // Wrist pitch servo angle with the pointer in line with the forearm
+#endif
+
+// Servos in arm order: base, shoulder, elbow, wrist roll, wrist pitch
+#define ARM_NUM_SERVOS 5
+
+// Per-degree PWM levels for each servo, generated by tools/gen_servo_table.c
+#ifndef ARM_SERVO_TABLE
+#define ARM_SERVO_TABLE "arm_servo_table.h"
+#endif
+
+// Wiring, per board
+#ifndef ARM_SERVO_PINS
+#if ARM_BOARD_AVR
+#define ARM_SERVO_PINS {9, 11, 12, 6, 5}
+#else
+#define ARM_SERVO_PINS {15, 14, 13, 12, 11}
+#endif
+#endif
+
+#ifndef ARM_LED_PIN
+#if ARM_BOARD_AVR
+#define ARM_LED_PIN 13
+#else
+#define ARM_LED_PIN 16
+#endif
+#endif
+
+#endif
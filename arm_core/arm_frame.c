@@ -0,0 +1,94 @@
+#include "arm_frame.h"
+
+uint16_t frame_crc16(const uint8_t *data, int len) {
+    uint16_t crc = 0xFFFF;
+    for (int i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int b = 0; b < 8; b++) {
+            crc = crc & 0x8000 ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+int frame_encode(const uint8_t *payload, int len, uint8_t *out) {
+    uint8_t crc[2];
+    frame_put_u16(crc, frame_crc16(payload, len));
+
+    int o = 0;
+    out[o++] = 0;
+    int code_at = o++;
+    uint8_t code = 1;
+    for (int i = 0; i < len + 2; i++) {
+        uint8_t b = i < len ? payload[i] : crc[i - len];
+        if (b == 0) {
+            out[code_at] = code;
+            code_at = o++;
+            code = 1;
+        } else {
+            out[o++] = b;
+            if (++code == 0xFF) {
+                out[code_at] = code;
+                code_at = o++;
+                code = 1;
+            }
+        }
+    }
+    out[code_at] = code;
+    out[o++] = 0;
+    return o;
+}
+
+void frame_decoder_init(frame_decoder_t *dec) {
+    dec->len = 0;
+    dec->in_frame = false;
+    dec->overflow = false;
+}
+
+// COBS decode and CRC check of the buffered frame
+static int finish_frame(frame_decoder_t *dec) {
+    if (dec->overflow) return FRAME_BAD;
+
+    int i = 0, o = 0;
+    while (i < dec->len) {
+        int code = dec->buf[i++];
+        if (i + code - 1 > dec->len) return FRAME_BAD;
+        for (int k = 1; k < code; k++) {
+            if (o == (int)sizeof(dec->payload)) return FRAME_BAD;
+            dec->payload[o++] = dec->buf[i++];
+        }
+        if (code < 0xFF && i < dec->len) {
+            if (o == (int)sizeof(dec->payload)) return FRAME_BAD;
+            dec->payload[o++] = 0;
+        }
+    }
+
+    if (o < 3) return FRAME_BAD;
+    if (frame_crc16(dec->payload, o - 2) != frame_get_u16(dec->payload + o - 2)) return FRAME_BAD;
+    return o - 2;
+}
+
+int frame_decoder_push(frame_decoder_t *dec, uint8_t byte) {
+    if (byte == 0) {
+        // A zero closes a frame that has data, otherwise it opens one. Two
+        // frames back to back (0 a 0 0 b 0) or a lost opener both resync.
+        if (dec->in_frame && dec->len > 0) {
+            int result = finish_frame(dec);
+            dec->in_frame = false;
+            dec->len = 0;
+            return result;
+        }
+        dec->in_frame = true;
+        dec->len = 0;
+        dec->overflow = false;
+        return FRAME_NONE;
+    }
+
+    if (!dec->in_frame) return FRAME_TEXT;
+    if (dec->len < (int)sizeof(dec->buf)) {
+        dec->buf[dec->len++] = byte;
+    } else {
+        dec->overflow = true;
+    }
+    return FRAME_NONE;
+}
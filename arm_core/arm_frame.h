@@ -0,0 +1,69 @@
+#ifndef ARM_FRAME_H
+#define ARM_FRAME_H
+
+/*
+ * BINARY FRAMING
+ *
+ * Shared by the telemetry stream and the waypoint protocol. A frame is
+ * [payload][CRC-16/CCITT-FALSE of payload, LE], COBS encoded, with a 0x00
+ * delimiter before and after. COBS output has no zeros, so a receiver can
+ * resync on any zero, and printf text on the same port falls between
+ * frames where the decoder reports it as text.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FRAME_MAX_PAYLOAD 128
+#define FRAME_MAX_ENCODED (FRAME_MAX_PAYLOAD + 2 + 1 + 2)  // CRC, COBS overhead, delimiters
+
+uint16_t frame_crc16(const uint8_t *data, int len);
+
+// Writes the complete frame for payload to out (FRAME_MAX_ENCODED bytes)
+// and returns its length
+int frame_encode(const uint8_t *payload, int len, uint8_t *out);
+
+// Byte-at-a-time receiver. frame_decoder_push() returns the payload length
+// once a frame with a good CRC is complete (payload in dec->payload),
+// FRAME_TEXT if the byte isn't part of any frame, FRAME_BAD if a frame
+// failed to decode, and FRAME_NONE otherwise.
+#define FRAME_NONE  0
+#define FRAME_BAD  -1
+#define FRAME_TEXT -2
+
+typedef struct {
+    uint8_t buf[FRAME_MAX_ENCODED];
+    uint8_t payload[FRAME_MAX_PAYLOAD + 2];
+    int len;
+    bool in_frame;
+    bool overflow;
+} frame_decoder_t;
+
+void frame_decoder_init(frame_decoder_t *dec);
+int frame_decoder_push(frame_decoder_t *dec, uint8_t byte);
+
+// Little-endian field helpers
+static inline uint8_t *frame_put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static inline uint8_t *frame_put_u32(uint8_t *p, uint32_t v) {
+    p = frame_put_u16(p, (uint16_t)v);
+    return frame_put_u16(p, (uint16_t)(v >> 16));
+}
+
+static inline uint16_t frame_get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
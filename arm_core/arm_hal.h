@@ -0,0 +1,131 @@
+#ifndef ARM_HAL_H
+#define ARM_HAL_H
+
+/*
+ * HARDWARE ABSTRACTION LAYER
+ *
+ * Thin wrappers around the Pico SDK calls the firmware uses, so the same
+ * firmware source builds against one of three backends (arm_board.h):
+ *   - arm_hal_pico.c:  real RP2040 hardware (default)
+ *   - arm_hal_sim.c:   host simulation, selected with -DARM_HAL_SIM
+ *   - arm_hal_avr.cpp: Arduino Nano, picked when building for AVR
+ *
+ * The simulated backend runs on a virtual clock: hal_sleep_ms() advances
+ * time instantly, every PWM channel write is logged with its virtual
+ * timestamp and ADC reads come from a scripted sample file. See
+ * arm_hal_sim.c for the environment variables it reads.
+ *
+ * Servo PWM is always 50Hz: clkdiv 64, wrap 39062 (~0.512us per count).
+ * On the Pico the pulses come from a PIO engine fed by DMA, unless built
+ * with ARM_SERVO_PWM_SLICES; either way levels are in those counts, and
+ * the slice/channel numbers are just handles from the gpio_to_ calls.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "arm_board.h"
+
+#if ARM_BOARD_PICO
+#include "pico/types.h"
+#else
+typedef unsigned int uint;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HAL_SERVO_CLKDIV 64.0f
+#define HAL_SERVO_WRAP   39062
+
+// Startup
+void hal_init(void);
+
+// GPIO
+void hal_gpio_led_init(uint pin);
+void hal_gpio_put(uint pin, bool value);
+
+// Servo PWM
+void hal_pwm_servo_init(uint pin);
+uint hal_pwm_gpio_to_slice_num(uint pin);
+uint hal_pwm_gpio_to_channel(uint pin);
+void hal_pwm_set_chan_level(uint slice, uint channel, uint16_t level);
+
+// ADC. Readings are HAL_ADC_BITS wide.
+#if ARM_BOARD_AVR
+#define HAL_ADC_BITS 10
+#else
+#define HAL_ADC_BITS 12
+#endif
+void hal_adc_init(void);
+void hal_adc_gpio_init(uint pin);
+void hal_adc_select_input(uint input);
+uint16_t hal_adc_read(void);
+
+// Free-running capture: the ADC converts inputs 0..num_inputs-1 round robin
+// at rate_hz each and DMA streams the results into a ring buffer, with no
+// CPU involvement. hal_adc_capture_read() returns the mean of the newest
+// HAL_ADC_CAPTURE_AVERAGE samples of one input. Don't mix with
+// hal_adc_select_input()/hal_adc_read() once started.
+#define HAL_ADC_CAPTURE_AVERAGE 16
+bool hal_adc_capture_start(uint num_inputs, uint32_t rate_hz);
+uint16_t hal_adc_capture_read(uint input);
+uint16_t hal_adc_capture_latest(uint input);  // Newest sample, not averaged
+
+// Serial (USB CDC on the Pico). Queues as much of data as fits in the
+// transmit buffer without waiting and returns the number of bytes taken,
+// 0 if nothing is connected. Call from core 0 only, like printf.
+uint hal_serial_write_nonblocking(const uint8_t *data, uint len);
+// Reads whatever input is waiting, up to len bytes, without waiting for
+// more. Returns -1 once the input is closed (host builds at end of stdin).
+int hal_serial_read_nonblocking(uint8_t *data, uint len);
+
+// Time
+void hal_sleep_ms(uint32_t ms);
+void hal_sleep_until_us(uint64_t t_us);  // Absolute deadline, for fixed-rate loops
+uint32_t hal_time_ms(void);
+uint64_t hal_time_us(void);
+
+// Free-running cycle counter for benchmarking. Take differences with
+// hal_cycles_between(): the Pico's SysTick is only 24 bits wide. On the
+// host this is the real CPU timestamp counter, not the virtual clock.
+uint32_t hal_cycle_count(void);
+uint32_t hal_cycles_between(uint32_t start, uint32_t end);
+uint32_t hal_cycle_hz(void);
+
+// Repeating timer, called from interrupt context on the Pico. Return false
+// from the callback to stop it. A negative period schedules each call
+// period_us after the previous one started (fixed rate).
+typedef bool (*hal_timer_callback_t)(void *user_data);
+#define HAL_MAX_TIMERS 4
+bool hal_add_repeating_timer_us(int64_t period_us, hal_timer_callback_t callback, void *user_data);
+
+// Same, but the callback runs in a timer interrupt on core 1, so nothing
+// core 0 does (printf, IK, blocking ADC reads) can delay it. Core 1 is
+// started on the first call. Share data with core 0 through lock-free
+// single producer/single consumer structures and hal_memory_barrier().
+// The sim has one core and treats this like hal_add_repeating_timer_us().
+bool hal_add_core1_repeating_timer_us(int64_t period_us, hal_timer_callback_t callback, void *user_data);
+
+// Orders memory accesses around data shared with interrupts/other core
+void hal_memory_barrier(void);
+
+#if ARM_BOARD_AVR
+// Latest any servo pulse has ended (after its due tick) since startup. Only
+// other interrupts running longer than the driver's early wake-up make it
+// more than a few us.
+uint16_t hal_avr_servo_max_late_us(void);
+#endif
+
+#ifdef ARM_HAL_SIM
+// Simulation-only inspection
+uint32_t hal_sim_pwm_write_count(void);
+uint16_t hal_sim_pwm_level(uint pin);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
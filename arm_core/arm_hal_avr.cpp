@@ -0,0 +1,317 @@
+#include "arm_hal.h"
+#if ARM_BOARD_AVR
+#include <Arduino.h>
+
+/*
+ * Arduino Nano backend. Only built by the Arduino toolchain (arm_core as
+ * an Arduino library, see library.properties).
+ *
+ * Servo pulses come from Timer1 (below), not Servo.h. Each
+ * hal_pwm_servo_init() pin is a slot, the "slice" is its index and there is
+ * one channel. Levels stay in Pico counts like everywhere else in arm_core
+ * and are converted to timer ticks on write, so the calibration tables are
+ * shared.
+ *
+ * There is no DMA or second core: the capture reads convert on the spot
+ * (one analogRead, ~110us) and there are no repeating timers (Timer1 is
+ * the servos'), so no motion executor: arm_move.c plays moves out in the
+ * caller.
+ */
+
+/*
+ * Servo driver. Timer1 counts 0.5us ticks and restarts every 20ms. Every
+ * frame starts all the servo pulses together with one write per port, then
+ * output compare A ends them in width order from a schedule of edges worked
+ * out when a level changes, not in the interrupts:
+ *   - Widths count from when the pins actually went high, so the latency of
+ *     the frame interrupt doesn't change them, only the frame length
+ *   - Each compare fires AVR_EDGE_EARLY_TICKS early and spins to the exact
+ *     tick, absorbing up to that much delay from other interrupts (millis,
+ *     Serial); edges less than twice that apart are ended in the same
+ *     interrupt
+ *   - Writes build a spare schedule that the frame interrupt swaps in, so a
+ *     frame never mixes two schedules
+ */
+#define AVR_MAX_SERVOS 8
+#define AVR_MAX_PORTS 3
+#define AVR_FRAME_TICKS 40000      // 20ms at 16MHz / 8
+#define AVR_EDGE_EARLY_TICKS 16    // 8us
+#define AVR_PULSE_MIN_TICKS 600    // 300-2500us, the range Servo.h allowed
+#define AVR_PULSE_MAX_TICKS 5000
+
+typedef struct {
+    uint8_t num_edges;
+    uint8_t start[AVR_MAX_PORTS];                  // Bits set at the frame start
+    uint16_t width[AVR_MAX_SERVOS];                // Ticks from the start, ascending
+    uint8_t clear[AVR_MAX_SERVOS][AVR_MAX_PORTS];  // Bits cleared at each edge
+} servo_schedule_t;
+
+static volatile uint8_t *ports[AVR_MAX_PORTS];
+static uint8_t num_ports = 0;
+
+static uint8_t servo_pins[AVR_MAX_SERVOS];
+static uint8_t servo_port[AVR_MAX_SERVOS];
+static uint8_t servo_bit[AVR_MAX_SERVOS];
+static uint16_t servo_ticks[AVR_MAX_SERVOS];  // 0 = no pulse
+static uint8_t num_servos = 0;
+
+static servo_schedule_t schedules[2];
+static volatile uint8_t active_schedule = 0;
+static volatile bool schedule_pending = false;
+
+// Frame state, interrupts only
+static uint16_t frame_start;
+static uint8_t next_edge;
+static volatile uint16_t max_late_ticks = 0;
+
+ISR(TIMER1_CAPT_vect) {
+    if (schedule_pending) {
+        active_schedule ^= 1;
+        schedule_pending = false;
+    }
+    const servo_schedule_t *s = &schedules[active_schedule];
+
+    for (uint8_t p = 0; p < num_ports; p++) {
+        *ports[p] |= s->start[p];
+    }
+    frame_start = TCNT1;
+    next_edge = 0;
+
+    if (s->num_edges > 0) {
+        OCR1A = frame_start + s->width[0] - AVR_EDGE_EARLY_TICKS;
+        TIFR1 = _BV(OCF1A);
+        TIMSK1 |= _BV(OCIE1A);
+    }
+}
+
+ISR(TIMER1_COMPA_vect) {
+    const servo_schedule_t *s = &schedules[active_schedule];
+    uint8_t i = next_edge;
+
+    do {
+        uint16_t when = frame_start + s->width[i];
+        while ((int16_t)(when - TCNT1) > 0) {
+        }
+        for (uint8_t p = 0; p < num_ports; p++) {
+            *ports[p] &= ~s->clear[i][p];
+        }
+        uint16_t late = TCNT1 - when;
+        if (late > max_late_ticks) max_late_ticks = late;
+        i++;
+        // Anything due before the next compare could safely be set up goes now
+    } while (i < s->num_edges && (int16_t)(frame_start + s->width[i] - TCNT1) < 2 * AVR_EDGE_EARLY_TICKS);
+
+    next_edge = i;
+    if (i < s->num_edges) {
+        OCR1A = frame_start + s->width[i] - AVR_EDGE_EARLY_TICKS;
+    } else {
+        TIMSK1 &= ~_BV(OCIE1A);
+    }
+}
+
+// Sorts the slots by width into the spare schedule and hands it to the
+// next frame. Main context only.
+static void schedule_build(void) {
+    schedule_pending = false;  // The frame interrupt leaves the spare alone now
+    servo_schedule_t *s = &schedules[active_schedule ^ 1];
+
+    uint8_t order[AVR_MAX_SERVOS];
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < num_servos; i++) {
+        if (servo_ticks[i] == 0) continue;
+        uint8_t j = n++;
+        for (; j > 0 && servo_ticks[order[j - 1]] > servo_ticks[i]; j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+    }
+
+    memset(s, 0, sizeof(*s));
+    for (uint8_t k = 0; k < n; k++) {
+        uint8_t i = order[k];
+        if (s->num_edges == 0 || s->width[s->num_edges - 1] != servo_ticks[i]) {
+            s->width[s->num_edges++] = servo_ticks[i];
+        }
+        s->start[servo_port[i]] |= servo_bit[i];
+        s->clear[s->num_edges - 1][servo_port[i]] |= servo_bit[i];
+    }
+
+    schedule_pending = true;
+}
+
+static void timer1_start(void) {
+    TCCR1A = 0;
+    TCCR1B = 0;
+    ICR1 = AVR_FRAME_TICKS - 1;
+    TCNT1 = 0;
+    TIFR1 = _BV(ICF1) | _BV(OCF1A);
+    TIMSK1 = _BV(ICIE1);
+    TCCR1B = _BV(WGM13) | _BV(WGM12) | _BV(CS11);  // CTC up to ICR1, clk/8
+}
+
+static uint8_t adc_input = 0;
+
+static uint32_t last_micros = 0;
+static uint32_t micros_high = 0;
+
+void hal_init(void) {
+    Serial.begin(115200);
+}
+
+void hal_gpio_led_init(uint pin) {
+    pinMode(pin, OUTPUT);
+    digitalWrite(pin, LOW);
+}
+
+void hal_gpio_put(uint pin, bool value) {
+    digitalWrite(pin, value ? HIGH : LOW);
+}
+
+void hal_pwm_servo_init(uint pin) {
+    if (hal_pwm_gpio_to_slice_num(pin) < num_servos || num_servos == AVR_MAX_SERVOS) return;
+
+    volatile uint8_t *port = portOutputRegister(digitalPinToPort(pin));
+    uint8_t p = 0;
+    while (p < num_ports && ports[p] != port) p++;
+    if (p == AVR_MAX_PORTS) return;
+    if (p == num_ports) ports[num_ports++] = port;
+
+    digitalWrite(pin, LOW);
+    pinMode(pin, OUTPUT);
+    servo_pins[num_servos] = pin;
+    servo_port[num_servos] = p;
+    servo_bit[num_servos] = digitalPinToBitMask(pin);
+    servo_ticks[num_servos] = 0;
+    if (num_servos++ == 0) timer1_start();
+}
+
+uint16_t hal_avr_servo_max_late_us(void) {
+    noInterrupts();
+    uint16_t late = max_late_ticks;
+    interrupts();
+    return late / 2;
+}
+
+uint hal_pwm_gpio_to_slice_num(uint pin) {
+    for (uint8_t i = 0; i < num_servos; i++) {
+        if (servo_pins[i] == pin) return i;
+    }
+    return AVR_MAX_SERVOS;
+}
+
+uint hal_pwm_gpio_to_channel(uint pin) {
+    (void)pin;
+    return 0;
+}
+
+// Applies from the next frame. Level 0 stops the pulses, like a PWM
+// channel at 0.
+void hal_pwm_set_chan_level(uint slice, uint channel, uint16_t level) {
+    (void)channel;
+    if (slice >= num_servos) return;
+
+    // 0.512us counts to 0.5us ticks: x 128/125
+    uint16_t ticks = 0;
+    if (level > 0) {
+        uint32_t t = ((uint32_t)level * 128 + 62) / 125;
+        ticks = t < AVR_PULSE_MIN_TICKS ? AVR_PULSE_MIN_TICKS : t > AVR_PULSE_MAX_TICKS ? AVR_PULSE_MAX_TICKS : t;
+    }
+    if (ticks == servo_ticks[slice]) return;
+    servo_ticks[slice] = ticks;
+    schedule_build();
+}
+
+void hal_adc_init(void) {
+}
+
+void hal_adc_gpio_init(uint pin) {
+    (void)pin;  // Analog pins need no setup
+}
+
+void hal_adc_select_input(uint input) {
+    adc_input = input;
+}
+
+uint16_t hal_adc_read(void) {
+    return analogRead(A0 + adc_input);
+}
+
+bool hal_adc_capture_start(uint num_inputs, uint32_t rate_hz) {
+    (void)num_inputs;
+    (void)rate_hz;
+    return true;
+}
+
+uint16_t hal_adc_capture_read(uint input) {
+    return analogRead(A0 + input);
+}
+
+uint16_t hal_adc_capture_latest(uint input) {
+    return analogRead(A0 + input);
+}
+
+uint hal_serial_write_nonblocking(const uint8_t *data, uint len) {
+    int room = Serial.availableForWrite();
+    uint n = room < (int)len ? (uint)room : len;
+    return Serial.write(data, n);
+}
+
+int hal_serial_read_nonblocking(uint8_t *data, uint len) {
+    uint n = 0;
+    while (n < len && Serial.available() > 0) {
+        data[n++] = Serial.read();
+    }
+    return n;
+}
+
+void hal_sleep_ms(uint32_t ms) {
+    delay(ms);
+}
+
+void hal_sleep_until_us(uint64_t t_us) {
+    while (hal_time_us() < t_us) {
+    }
+}
+
+uint32_t hal_time_ms(void) {
+    return millis();
+}
+
+// micros() wraps every ~71 minutes; count the wraps (needs a call at least
+// that often, which any control loop makes)
+uint64_t hal_time_us(void) {
+    uint32_t now = micros();
+    if (now < last_micros) micros_high++;
+    last_micros = now;
+    return ((uint64_t)micros_high << 32) | now;
+}
+
+// No cycle counter: micros() (4us steps at 16MHz) scaled to CPU cycles
+uint32_t hal_cycle_count(void) {
+    return micros() * (F_CPU / 1000000UL);
+}
+
+uint32_t hal_cycles_between(uint32_t start, uint32_t end) {
+    return end - start;
+}
+
+uint32_t hal_cycle_hz(void) {
+    return F_CPU;
+}
+
+bool hal_add_repeating_timer_us(int64_t period_us, hal_timer_callback_t callback, void *user_data) {
+    (void)period_us;
+    (void)callback;
+    (void)user_data;
+    return false;
+}
+
+bool hal_add_core1_repeating_timer_us(int64_t period_us, hal_timer_callback_t callback, void *user_data) {
+    return hal_add_repeating_timer_us(period_us, callback, user_data);
+}
+
+void hal_memory_barrier(void) {
+    __asm__ __volatile__("" ::: "memory");
+}
+
+#endif
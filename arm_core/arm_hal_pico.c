@@ -0,0 +1,394 @@
+#include "arm_hal.h"
+#if ARM_BOARD_PICO
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "hardware/pio.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+#if LIB_PICO_STDIO_USB
+#include "pico/stdio_usb.h"
+#include "tusb.h"
+#endif
+#ifndef ARM_SERVO_PWM_SLICES
+#include "arm_servo.pio.h"
+#endif
+
+#define SYSTICK_MASK 0x00FFFFFF
+
+void hal_init(void) {
+    stdio_init_all();
+
+    // SysTick free-running from the processor clock, no interrupt
+    systick_hw->rvr = SYSTICK_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;
+}
+
+void hal_gpio_led_init(uint pin) {
+    gpio_init(pin);
+    gpio_set_dir(pin, GPIO_OUT);
+}
+
+void hal_gpio_put(uint pin, bool value) {
+    gpio_put(pin, value);
+}
+
+#ifdef ARM_SERVO_PWM_SLICES
+// 50Hz servo PWM: 125MHz / 64 / 39062 = ~50Hz (20ms period)
+void hal_pwm_servo_init(uint pin) {
+    gpio_set_function(pin, GPIO_FUNC_PWM);
+    uint slice = pwm_gpio_to_slice_num(pin);
+    pwm_set_clkdiv(slice, HAL_SERVO_CLKDIV);
+    pwm_set_wrap(slice, HAL_SERVO_WRAP);
+    pwm_set_enabled(slice, true);
+}
+
+uint hal_pwm_gpio_to_slice_num(uint pin) {
+    return pwm_gpio_to_slice_num(pin);
+}
+
+uint hal_pwm_gpio_to_channel(uint pin) {
+    return pwm_gpio_to_channel(pin);
+}
+
+void hal_pwm_set_chan_level(uint slice, uint channel, uint16_t level) {
+    pwm_set_chan_level(slice, channel, level);
+}
+#else
+// PIO servo engine (arm_servo.pio). One state machine plays a frame of
+// (GPIO mask, hold) pairs: each servo's pulse in turn, then low for the rest
+// of the 20ms. A DMA channel feeds the frame to the TX FIFO and a second one
+// restarts it when it ends, so after setup the CPU only writes the frame in
+// RAM. The "slice" is the servo's slot in the frame, there is one channel.
+//
+// Levels stay in HAL counts (0.512us) so the calibration tables still
+// apply; the SM runs 8 clocks per count (64ns). The pulses go out one after
+// another rather than all at once, which also spreads the servo inrush.
+#define SERVO_PIO_SLOTS            6
+#define SERVO_PIO_CYCLES_PER_COUNT 8
+#define SERVO_PIO_FRAME_CYCLES     ((HAL_SERVO_WRAP + 1) * SERVO_PIO_CYCLES_PER_COUNT)
+// Longest pulse that still fits every slot in one frame (3.3ms)
+#define SERVO_PIO_MAX_LEVEL ((HAL_SERVO_WRAP + 1) / SERVO_PIO_SLOTS - 1)
+
+static const PIO servo_pio = pio0;
+static int servo_sm = -1;
+static uint servo_pins[SERVO_PIO_SLOTS];
+static uint servo_slots = 0;
+
+// Mask and hold per slot, then the rest of the frame with every output low.
+// Unused slots and level 0 are mask 0, hold 0.
+static uint32_t servo_frame[2 * SERVO_PIO_SLOTS + 2];
+static const uint32_t *servo_frame_addr = servo_frame;
+
+static void servo_frame_set_rest(void) {
+    uint32_t used = ARM_SERVO_PIO_OVERHEAD;
+    for (int i = 0; i < SERVO_PIO_SLOTS; i++) {
+        used += servo_frame[2 * i + 1] + ARM_SERVO_PIO_OVERHEAD;
+    }
+    servo_frame[2 * SERVO_PIO_SLOTS + 1] = SERVO_PIO_FRAME_CYCLES - used;
+}
+
+static void servo_pio_start(void) {
+    servo_sm = pio_claim_unused_sm(servo_pio, true);
+    uint offset = pio_add_program(servo_pio, &arm_servo_program);
+    arm_servo_program_init(servo_pio, servo_sm, offset, HAL_SERVO_CLKDIV / SERVO_PIO_CYCLES_PER_COUNT);
+    servo_frame_set_rest();
+
+    // Data channel: frame -> TX FIFO, paced by the SM. Control channel:
+    // rewrites the data channel's read address, which starts the next frame.
+    int data_chan = dma_claim_unused_channel(true);
+    int ctrl_chan = dma_claim_unused_channel(true);
+
+    dma_channel_config cfg = dma_channel_get_default_config(data_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, pio_get_dreq(servo_pio, servo_sm, true));
+    channel_config_set_chain_to(&cfg, ctrl_chan);
+    dma_channel_configure(data_chan, &cfg, &servo_pio->txf[servo_sm], servo_frame,
+                          sizeof(servo_frame) / sizeof(servo_frame[0]), false);
+
+    dma_channel_config ctrl = dma_channel_get_default_config(ctrl_chan);
+    channel_config_set_transfer_data_size(&ctrl, DMA_SIZE_32);
+    channel_config_set_read_increment(&ctrl, false);
+    channel_config_set_write_increment(&ctrl, false);
+    dma_channel_configure(ctrl_chan, &ctrl, &dma_hw->ch[data_chan].al3_read_addr_trig,
+                          &servo_frame_addr, 1, false);
+
+    dma_channel_start(data_chan);
+    pio_sm_set_enabled(servo_pio, servo_sm, true);
+}
+
+void hal_pwm_servo_init(uint pin) {
+    if (hal_pwm_gpio_to_slice_num(pin) < servo_slots || servo_slots == SERVO_PIO_SLOTS) return;
+    if (servo_sm < 0) servo_pio_start();
+
+    servo_pins[servo_slots++] = pin;
+    pio_gpio_init(servo_pio, pin);
+
+    // Setting the pin direction runs an instruction on the SM, so pause it
+    pio_sm_set_enabled(servo_pio, servo_sm, false);
+    pio_sm_set_consecutive_pindirs(servo_pio, servo_sm, pin, 1, true);
+    pio_sm_set_enabled(servo_pio, servo_sm, true);
+}
+
+uint hal_pwm_gpio_to_slice_num(uint pin) {
+    for (uint i = 0; i < servo_slots; i++) {
+        if (servo_pins[i] == pin) return i;
+    }
+    return SERVO_PIO_SLOTS;
+}
+
+uint hal_pwm_gpio_to_channel(uint pin) {
+    (void)pin;
+    return 0;
+}
+
+// Takes effect from the next frame the DMA reads. A frame caught halfway
+// through an update can mix old and new values, like any PWM level change
+// racing the counter wrap.
+void hal_pwm_set_chan_level(uint slice, uint channel, uint16_t level) {
+    (void)channel;
+    if (slice >= servo_slots) return;
+    if (level > SERVO_PIO_MAX_LEVEL) level = SERVO_PIO_MAX_LEVEL;
+
+    uint32_t cycles = (uint32_t)level * SERVO_PIO_CYCLES_PER_COUNT;
+    if (cycles < ARM_SERVO_PIO_OVERHEAD) {
+        servo_frame[2 * slice] = 0;
+        servo_frame[2 * slice + 1] = 0;
+    } else {
+        servo_frame[2 * slice + 1] = cycles - ARM_SERVO_PIO_OVERHEAD;
+        servo_frame[2 * slice] = 1u << servo_pins[slice];
+    }
+    servo_frame_set_rest();
+}
+#endif
+
+void hal_adc_init(void) {
+    adc_init();
+}
+
+void hal_adc_gpio_init(uint pin) {
+    adc_gpio_init(pin);
+}
+
+void hal_adc_select_input(uint input) {
+    adc_select_input(input);
+}
+
+uint16_t hal_adc_read(void) {
+    return adc_read();
+}
+
+// ADC capture ring: must be a power of 2 and aligned to its size in bytes
+// for the DMA write address wrap
+#define ADC_RING_BITS    9
+#define ADC_RING_SAMPLES ((1 << ADC_RING_BITS) / sizeof(uint16_t))
+#define ADC_CLOCK_HZ     48000000
+
+static uint16_t adc_ring[ADC_RING_SAMPLES] __attribute__((aligned(1 << ADC_RING_BITS)));
+static uint32_t adc_dma_count;  // Read by the control channel on every re-arm
+static int adc_dma_chan = -1;
+static uint adc_capture_inputs = 0;
+
+bool hal_adc_capture_start(uint num_inputs, uint32_t rate_hz) {
+    if (num_inputs == 0 || num_inputs > 4 || adc_dma_chan >= 0) return false;
+    adc_capture_inputs = num_inputs;
+
+    // The largest count that is a whole number of round robin passes and of
+    // ring laps, so input order and ring slots line up again after a re-arm
+    uint32_t period = ADC_RING_SAMPLES * num_inputs;
+    adc_dma_count = 0xFFFFFFFFu - 0xFFFFFFFFu % period;
+
+    adc_select_input(0);
+    adc_set_round_robin((1u << num_inputs) - 1);
+    adc_fifo_setup(true, true, 1, false, false);  // FIFO on, DREQ at 1 sample, 12-bit results
+    adc_set_clkdiv((float)ADC_CLOCK_HZ / (rate_hz * num_inputs) - 1.0f);
+
+    // Data channel: ADC FIFO -> ring. Its transfer count only says how many
+    // samples have been written; the control channel re-arms it if it ever
+    // runs out (~16 days at 3kHz)
+    adc_dma_chan = dma_claim_unused_channel(true);
+    int ctrl_chan = dma_claim_unused_channel(true);
+
+    dma_channel_config cfg = dma_channel_get_default_config(adc_dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, true);
+    channel_config_set_ring(&cfg, true, ADC_RING_BITS);
+    channel_config_set_dreq(&cfg, DREQ_ADC);
+    channel_config_set_chain_to(&cfg, ctrl_chan);
+    dma_channel_configure(adc_dma_chan, &cfg, adc_ring, &adc_hw->fifo, adc_dma_count, false);
+
+    dma_channel_config ctrl = dma_channel_get_default_config(ctrl_chan);
+    channel_config_set_transfer_data_size(&ctrl, DMA_SIZE_32);
+    channel_config_set_read_increment(&ctrl, false);
+    channel_config_set_write_increment(&ctrl, false);
+    dma_channel_configure(ctrl_chan, &ctrl, &dma_hw->ch[adc_dma_chan].al1_transfer_count_trig,
+                          &adc_dma_count, 1, false);
+
+    adc_fifo_drain();
+    dma_channel_start(adc_dma_chan);
+    adc_run(true);
+
+    // Wait for the first pass, so every input has a sample from the start
+    // (about a millisecond at joystick rates)
+    while (adc_dma_count - dma_hw->ch[adc_dma_chan].transfer_count < num_inputs) tight_loop_contents();
+    return true;
+}
+
+// Sample count of the newest sample of input, false if there is none yet
+static bool capture_newest(uint input, uint32_t *newest) {
+    if (adc_dma_chan < 0 || input >= adc_capture_inputs) return false;
+
+    // Samples land in input order 0,1,..,n-1,0,1.. starting at input 0, so the
+    // number written so far tells which slot holds which input. The count is
+    // a multiple of the inputs and the ring size, so re-arms keep that true.
+    uint32_t written = adc_dma_count - dma_hw->ch[adc_dma_chan].transfer_count;
+    if (written <= input) return false;
+
+    *newest = written - 1 - ((written - 1 - input) % adc_capture_inputs);
+    return true;
+}
+
+// Mid-scale for an input with no samples, which callers take as centred
+#define ADC_NO_SAMPLE (1u << (HAL_ADC_BITS - 1))
+
+uint16_t hal_adc_capture_read(uint input) {
+    uint32_t newest;
+    if (!capture_newest(input, &newest)) return ADC_NO_SAMPLE;
+
+    uint32_t sum = 0;
+    int n = 0;
+    for (uint32_t i = newest; n < HAL_ADC_CAPTURE_AVERAGE; i -= adc_capture_inputs) {
+        sum += adc_ring[i & (ADC_RING_SAMPLES - 1)];
+        n++;
+        if (i < adc_capture_inputs) break;
+    }
+    return (uint16_t)(sum / n);
+}
+
+uint16_t hal_adc_capture_latest(uint input) {
+    uint32_t newest;
+    if (!capture_newest(input, &newest)) return ADC_NO_SAMPLE;
+    return adc_ring[newest & (ADC_RING_SAMPLES - 1)];
+}
+
+// Goes through the stdio driver so its mutex keeps printf and the USB task
+// out; only writes what already fits, so out_chars never waits
+uint hal_serial_write_nonblocking(const uint8_t *data, uint len) {
+#if LIB_PICO_STDIO_USB
+    if (!tud_cdc_connected()) return 0;
+    uint space = tud_cdc_write_available();
+    if (len > space) len = space;
+    if (len > 0) stdio_usb.out_chars((const char *)data, (int)len);
+    return len;
+#else
+    (void)data;
+    (void)len;
+    return 0;
+#endif
+}
+
+int hal_serial_read_nonblocking(uint8_t *data, uint len) {
+    uint n = 0;
+    while (n < len) {
+        int c = getchar_timeout_us(0);
+        if (c < 0) break;
+        data[n++] = (uint8_t)c;
+    }
+    return (int)n;
+}
+
+void hal_sleep_ms(uint32_t ms) {
+    sleep_ms(ms);
+}
+
+void hal_sleep_until_us(uint64_t t_us) {
+    sleep_until(from_us_since_boot(t_us));
+}
+
+uint32_t hal_time_ms(void) {
+    return to_ms_since_boot(get_absolute_time());
+}
+
+uint64_t hal_time_us(void) {
+    return to_us_since_boot(get_absolute_time());
+}
+
+// SysTick counts down; flip it so the count goes up
+uint32_t hal_cycle_count(void) {
+    return SYSTICK_MASK - systick_hw->cvr;
+}
+
+uint32_t hal_cycles_between(uint32_t start, uint32_t end) {
+    return (end - start) & SYSTICK_MASK;
+}
+
+uint32_t hal_cycle_hz(void) {
+    return clock_get_hz(clk_sys);
+}
+
+static repeating_timer_t timers[HAL_MAX_TIMERS];
+static hal_timer_callback_t timer_callbacks[HAL_MAX_TIMERS];
+static void *timer_user_data[HAL_MAX_TIMERS];
+static int num_timers = 0;
+
+static bool timer_trampoline(repeating_timer_t *rt) {
+    int i = (int)(intptr_t)rt->user_data;
+    return timer_callbacks[i](timer_user_data[i]);
+}
+
+bool hal_add_repeating_timer_us(int64_t period_us, hal_timer_callback_t callback, void *user_data) {
+    if (num_timers == HAL_MAX_TIMERS) return false;
+
+    int i = num_timers++;
+    timer_callbacks[i] = callback;
+    timer_user_data[i] = user_data;
+    return add_repeating_timer_us(period_us, timer_trampoline, (void *)(intptr_t)i, &timers[i]);
+}
+
+// Core 1 runs its own alarm pool so its timer IRQs fire on core 1. Timers
+// are registered through the multicore FIFO: core 0 pushes the slot index,
+// core 1 adds the timer and pushes back the result.
+#define CORE1_HARDWARE_ALARM 2
+
+static int64_t timer_periods[HAL_MAX_TIMERS];
+static bool core1_started = false;
+
+static void core1_main(void) {
+    alarm_pool_t *pool = alarm_pool_create(CORE1_HARDWARE_ALARM, HAL_MAX_TIMERS);
+
+    while (true) {
+        int i = (int)multicore_fifo_pop_blocking();
+        bool ok = alarm_pool_add_repeating_timer_us(pool, timer_periods[i], timer_trampoline,
+                                                    (void *)(intptr_t)i, &timers[i]);
+        multicore_fifo_push_blocking(ok);
+    }
+}
+
+bool hal_add_core1_repeating_timer_us(int64_t period_us, hal_timer_callback_t callback, void *user_data) {
+    if (num_timers == HAL_MAX_TIMERS) return false;
+
+    if (!core1_started) {
+        multicore_launch_core1(core1_main);
+        core1_started = true;
+    }
+
+    int i = num_timers++;
+    timer_callbacks[i] = callback;
+    timer_user_data[i] = user_data;
+    timer_periods[i] = period_us;
+    multicore_fifo_push_blocking((uint32_t)i);
+    return multicore_fifo_pop_blocking() != 0;
+}
+
+void hal_memory_barrier(void) {
+    __dmb();
+}
+
+#endif
@@ -0,0 +1,368 @@
+#include "arm_hal.h"
+#if ARM_BOARD_SIM
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/*
+ * SIMULATED BACKEND (host build, -DARM_HAL_SIM)
+ *
+ * Environment variables:
+ *   ARM_SIM_ADC_SCRIPT   Text file of ADC samples, one per line:
+ *                          t_ms adc0 adc1 adc2
+ *                        Each line holds from its timestamp until the next.
+ *                        Lines starting with '#' are ignored. Without a
+ *                        script every input reads centre (2048).
+ *                        A line "@align first_read" makes the timestamps
+ *                        count from the first hal_adc_capture_read() instead
+ *                        of boot, so a recorded session (tools/session_replay)
+ *                        lines up with the control loop whatever the setup
+ *                        takes.
+ *   ARM_SIM_PWM_LOG      CSV file receiving every PWM write:
+ *                          t_us,gpio,level
+ *   ARM_SIM_SERIAL_LOG   File receiving the binary serial stream
+ *                        (hal_serial_write_nonblocking), e.g. telemetry
+ *                        for tools/telemetry_decode. Discarded otherwise.
+ *   ARM_SIM_DURATION_MS  Virtual run time. The process exits cleanly once
+ *                        the clock passes it. Defaults to the last script
+ *                        timestamp + 1000ms (from the first read when
+ *                        aligned), or 60000ms without a script.
+ *
+ * Virtual time only moves in hal_sleep_ms(), so the firmware runs as fast
+ * as the host allows. Repeating timers fire inside hal_sleep_ms() at their
+ * virtual deadlines, in order, as if they had interrupted the sleep.
+ */
+
+#define SIM_ADC_INPUTS 4
+#define SIM_ADC_CENTRE 2048
+#define SIM_NUM_GPIO   30
+
+typedef struct {
+    uint32_t t_ms;
+    uint16_t value[SIM_ADC_INPUTS];
+} sim_adc_sample_t;
+
+static uint64_t sim_time_us = 0;
+static uint64_t sim_end_us = 0;
+
+static sim_adc_sample_t *adc_script = NULL;
+static int adc_script_len = 0;
+static int adc_script_pos = 0;
+static bool adc_script_align = false;   // Timestamps from the first read
+static bool adc_script_started = false;
+static uint64_t adc_script_start_us = 0;
+static bool sim_end_from_script = false;
+static uint adc_input = 0;
+
+typedef struct {
+    hal_timer_callback_t callback;
+    void *user_data;
+    uint64_t period_us;
+    uint64_t next_us;
+    bool active;
+} sim_timer_t;
+
+static sim_timer_t timers[HAL_MAX_TIMERS];
+static int num_timers = 0;
+
+static FILE *serial_log = NULL;
+static FILE *pwm_log = NULL;
+static uint32_t pwm_writes = 0;
+static uint16_t pwm_levels[SIM_NUM_GPIO];
+
+static void load_adc_script(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "sim: cannot open ADC script %s\n", path);
+        exit(1);
+    }
+
+    int capacity = 256;
+    adc_script = malloc(capacity * sizeof(sim_adc_sample_t));
+
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        if (strncmp(line, "@align first_read", 17) == 0) {
+            adc_script_align = true;
+            continue;
+        }
+
+        unsigned t;
+        unsigned v[SIM_ADC_INPUTS] = {SIM_ADC_CENTRE, SIM_ADC_CENTRE, SIM_ADC_CENTRE, SIM_ADC_CENTRE};
+        if (sscanf(line, "%u %u %u %u", &t, &v[0], &v[1], &v[2]) < 2) continue;
+
+        if (adc_script_len == capacity) {
+            capacity *= 2;
+            adc_script = realloc(adc_script, capacity * sizeof(sim_adc_sample_t));
+        }
+        sim_adc_sample_t *s = &adc_script[adc_script_len++];
+        s->t_ms = t;
+        for (int i = 0; i < SIM_ADC_INPUTS; i++) {
+            s->value[i] = (uint16_t)(v[i] > 4095 ? 4095 : v[i]);
+        }
+    }
+    fclose(f);
+}
+
+static void sim_finish(void) {
+    if (pwm_log) {
+        fclose(pwm_log);
+        pwm_log = NULL;
+    }
+    if (serial_log) {
+        fclose(serial_log);
+        serial_log = NULL;
+    }
+}
+
+void hal_init(void) {
+    const char *script = getenv("ARM_SIM_ADC_SCRIPT");
+    const char *log = getenv("ARM_SIM_PWM_LOG");
+    const char *serial = getenv("ARM_SIM_SERIAL_LOG");
+    const char *duration = getenv("ARM_SIM_DURATION_MS");
+
+    if (script) load_adc_script(script);
+
+    if (serial) {
+        serial_log = fopen(serial, "wb");
+        if (!serial_log) {
+            fprintf(stderr, "sim: cannot open serial log %s\n", serial);
+            exit(1);
+        }
+    }
+
+    if (log) {
+        pwm_log = fopen(log, "w");
+        if (!pwm_log) {
+            fprintf(stderr, "sim: cannot open PWM log %s\n", log);
+            exit(1);
+        }
+        fprintf(pwm_log, "t_us,gpio,level\n");
+    }
+
+    if (duration) {
+        sim_end_us = strtoull(duration, NULL, 10) * 1000;
+    } else if (adc_script_len > 0 && adc_script_align) {
+        // Until the first read moves it to the end of the script
+        sim_end_us = 60000ull * 1000;
+        sim_end_from_script = true;
+    } else if (adc_script_len > 0) {
+        sim_end_us = ((uint64_t)adc_script[adc_script_len - 1].t_ms + 1000) * 1000;
+    } else {
+        sim_end_us = 60000ull * 1000;
+    }
+
+    atexit(sim_finish);
+}
+
+void hal_gpio_led_init(uint pin) {
+    (void)pin;
+}
+
+void hal_gpio_put(uint pin, bool value) {
+    (void)pin;
+    (void)value;
+}
+
+void hal_pwm_servo_init(uint pin) {
+    (void)pin;
+}
+
+// RP2040 mapping: GPIO n drives slice (n >> 1) & 7, channel n & 1
+uint hal_pwm_gpio_to_slice_num(uint pin) {
+    return (pin >> 1) & 7;
+}
+
+uint hal_pwm_gpio_to_channel(uint pin) {
+    return pin & 1;
+}
+
+void hal_pwm_set_chan_level(uint slice, uint channel, uint16_t level) {
+    // Slices 0-6 map back to a unique pin; that covers every servo pin used
+    uint pin = slice * 2 + channel;
+    if (pin < SIM_NUM_GPIO) pwm_levels[pin] = level;
+    pwm_writes++;
+
+    if (pwm_log) {
+        fprintf(pwm_log, "%llu,%u,%u\n", (unsigned long long)sim_time_us, pin, level);
+    }
+}
+
+void hal_adc_init(void) {
+}
+
+void hal_adc_gpio_init(uint pin) {
+    (void)pin;
+}
+
+void hal_adc_select_input(uint input) {
+    adc_input = input < SIM_ADC_INPUTS ? input : 0;
+}
+
+uint16_t hal_adc_read(void) {
+    return hal_adc_capture_read(adc_input);
+}
+
+bool hal_adc_capture_start(uint num_inputs, uint32_t rate_hz) {
+    (void)rate_hz;
+    return num_inputs > 0 && num_inputs <= SIM_ADC_INPUTS;
+}
+
+static uint16_t script_value(uint input) {
+    if (adc_script_len == 0 || input >= SIM_ADC_INPUTS) return SIM_ADC_CENTRE;
+    if (adc_script_align && !adc_script_started) return SIM_ADC_CENTRE;
+
+    // Samples are time-ordered and time only moves forward
+    uint32_t now_ms = (uint32_t)((sim_time_us - adc_script_start_us) / 1000);
+    while (adc_script_pos + 1 < adc_script_len && adc_script[adc_script_pos + 1].t_ms <= now_ms) {
+        adc_script_pos++;
+    }
+    if (adc_script[adc_script_pos].t_ms > now_ms) return SIM_ADC_CENTRE;
+    return adc_script[adc_script_pos].value[input];
+}
+
+// The script is noise free, so the average is just the current sample
+uint16_t hal_adc_capture_read(uint input) {
+    if (adc_script_align && !adc_script_started) {
+        adc_script_started = true;
+        adc_script_start_us = sim_time_us;
+        if (sim_end_from_script) {
+            sim_end_us = adc_script_start_us + ((uint64_t)adc_script[adc_script_len - 1].t_ms + 1000) * 1000;
+        }
+    }
+    return script_value(input);
+}
+
+// Peeking (telemetry) doesn't start an aligned script
+uint16_t hal_adc_capture_latest(uint input) {
+    return script_value(input);
+}
+
+// Never full: the host takes the whole write
+uint hal_serial_write_nonblocking(const uint8_t *data, uint len) {
+    if (serial_log) fwrite(data, 1, len, serial_log);
+    return len;
+}
+
+// Input is stdin. A pipe or file is read as it comes; the virtual clock
+// doesn't move while the host waits on it. A terminal is only read when
+// something is typed, so an interactive run doesn't stop for input.
+int hal_serial_read_nonblocking(uint8_t *data, uint len) {
+    if (isatty(STDIN_FILENO)) {
+        struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
+        if (poll(&pfd, 1, 0) <= 0) return 0;
+    }
+    ssize_t n = read(STDIN_FILENO, data, len);
+    return n > 0 ? (int)n : -1;
+}
+
+// Earliest active timer due at or before deadline_us, or NULL
+static sim_timer_t *next_due_timer(uint64_t deadline_us) {
+    sim_timer_t *next = NULL;
+    for (int i = 0; i < num_timers; i++) {
+        if (timers[i].active && timers[i].next_us <= deadline_us &&
+            (!next || timers[i].next_us < next->next_us)) {
+            next = &timers[i];
+        }
+    }
+    return next;
+}
+
+void hal_sleep_ms(uint32_t ms) {
+    hal_sleep_until_us(sim_time_us + (uint64_t)ms * 1000);
+}
+
+void hal_sleep_until_us(uint64_t wake_us) {
+    if (wake_us < sim_time_us) wake_us = sim_time_us;
+
+    sim_timer_t *t;
+    while ((t = next_due_timer(wake_us)) != NULL) {
+        sim_time_us = t->next_us;
+        t->next_us += t->period_us;
+        if (!t->callback(t->user_data)) t->active = false;
+    }
+
+    sim_time_us = wake_us;
+    if (sim_time_us >= sim_end_us) {
+        exit(0);
+    }
+}
+
+uint32_t hal_time_ms(void) {
+    return (uint32_t)(sim_time_us / 1000);
+}
+
+uint64_t hal_time_us(void) {
+    return sim_time_us;
+}
+
+static uint64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+uint32_t hal_cycle_count(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    return (uint32_t)host_ns();
+#endif
+}
+
+uint32_t hal_cycles_between(uint32_t start, uint32_t end) {
+    return end - start;
+}
+
+// Measured once against the monotonic clock
+uint32_t hal_cycle_hz(void) {
+    static uint32_t hz = 0;
+    if (hz == 0) {
+        uint64_t t0 = host_ns();
+        uint32_t c0 = hal_cycle_count();
+        while (host_ns() - t0 < 20000000ull) {
+        }
+        uint32_t cycles = hal_cycles_between(c0, hal_cycle_count());
+        hz = (uint32_t)((uint64_t)cycles * 1000000000ull / (host_ns() - t0));
+    }
+    return hz;
+}
+
+bool hal_add_repeating_timer_us(int64_t period_us, hal_timer_callback_t callback, void *user_data) {
+    if (num_timers == HAL_MAX_TIMERS) return false;
+
+    sim_timer_t *t = &timers[num_timers++];
+    t->callback = callback;
+    t->user_data = user_data;
+    t->period_us = (uint64_t)(period_us < 0 ? -period_us : period_us);
+    if (t->period_us == 0) t->period_us = 1;
+    t->next_us = sim_time_us + t->period_us;
+    t->active = true;
+    return true;
+}
+
+// Single core: core 1 timers are ordinary timers on the virtual clock
+bool hal_add_core1_repeating_timer_us(int64_t period_us, hal_timer_callback_t callback, void *user_data) {
+    return hal_add_repeating_timer_us(period_us, callback, user_data);
+}
+
+void hal_memory_barrier(void) {
+    __sync_synchronize();
+}
+
+uint32_t hal_sim_pwm_write_count(void) {
+    return pwm_writes;
+}
+
+uint16_t hal_sim_pwm_level(uint pin) {
+    return pin < SIM_NUM_GPIO ? pwm_levels[pin] : 0;
+}
+
+#endif
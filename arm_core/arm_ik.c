@@ -0,0 +1,64 @@
+#include "arm_ik.h"
+#include <stdio.h>
+#include <math.h>
+
+#define RAD_TO_DEG 57.2957795f
+
+bool arm_ik_verbose = false;
+
+// 2D IK function - returns shoulder and elbow angles
+bool calculate_2d_ik_float(float x, float z, float *shoulder_angle, float *elbow_angle) {
+    // Calculate distance to target
+    float distance = sqrtf(x*x + z*z);
+
+    // Check reachability
+    if (distance > (LINK1 + LINK2)) {
+        if (arm_ik_verbose) printf("Target unreachable! Distance: %.1f, Max: %.1f\n", distance, LINK1 + LINK2);
+        return false;
+    }
+
+    if (distance < fabsf(LINK1 - LINK2)) {
+        if (arm_ik_verbose) printf("Target too close! Minimum reach: %.1f\n", fabsf(LINK1 - LINK2));
+        return false;
+    }
+
+    // Calculate base angles using law of cosines
+    float cos_elbow = (LINK1*LINK1 + LINK2*LINK2 - distance*distance) / (2.0f * LINK1 * LINK2);
+    float angle_to_target = atan2f(z, x) * RAD_TO_DEG;
+    float cos_shoulder_offset = (LINK1*LINK1 + distance*distance - LINK2*LINK2) / (2.0f * LINK1 * distance);
+    float shoulder_offset = acosf(cos_shoulder_offset) * RAD_TO_DEG;
+
+    // Two possible IK solutions
+    float shoulder_ik_1 = angle_to_target + shoulder_offset;
+    float elbow_ik_1 = 180.0f - (acosf(cos_elbow) * RAD_TO_DEG);  // Invert
+
+    float shoulder_ik_2 = angle_to_target - shoulder_offset;
+    float elbow_ik_2 = -elbow_ik_1;
+
+    // Apply mounting offset and convert to physical servo angles for both configs
+    int shoulder_physical_1 = 90 - (int)(shoulder_ik_1 + SHOULDER_MOUNT_OFFSET);
+    int elbow_physical_1 = 90 - (int)elbow_ik_1;
+
+    int shoulder_physical_2 = 90 - (int)(shoulder_ik_2 + SHOULDER_MOUNT_OFFSET);
+    int elbow_physical_2 = 90 - (int)elbow_ik_2;
+
+    // Check which configuration has valid servo angles
+    bool config1_valid = (shoulder_physical_1 >= 0 && shoulder_physical_1 <= 180 && elbow_physical_1 >= 0 && elbow_physical_1 <= 180);
+    bool config2_valid = (shoulder_physical_2 >= 0 && shoulder_physical_2 <= 180 && elbow_physical_2 >= 0 && elbow_physical_2 <= 180);
+
+    // Return the valid configuration (already converted to physical angles)
+    if (config1_valid) {
+        *shoulder_angle = shoulder_physical_1;
+        *elbow_angle = elbow_physical_1;
+        if (arm_ik_verbose) printf("IK Config 1: Target(%.1f, %.1f) -> Servos S=%d° E=%d°\n", x, z, shoulder_physical_1, elbow_physical_1);
+        return true;
+    } else if (config2_valid) {
+        *shoulder_angle = shoulder_physical_2;
+        *elbow_angle = elbow_physical_2;
+        if (arm_ik_verbose) printf("IK Config 2: Target(%.1f, %.1f) -> Servos S=%d° E=%d°\n", x, z, shoulder_physical_2, elbow_physical_2);
+        return true;
+    } else {
+        if (arm_ik_verbose) printf("No valid servo angles! Config1: S=%d E=%d, Config2: S=%d E=%d\n", shoulder_physical_1, elbow_physical_1, shoulder_physical_2, elbow_physical_2);
+        return false;
+    }
+}
@@ -0,0 +1,159 @@
+#ifndef ARM_IK_H
+#define ARM_IK_H
+
+/*
+ * ARM MEASUREMENTS (mm):
+ * - Base height: 97mm
+ * - Shoulder offset from base axis: 14mm
+ * - Link 1 (shoulder→elbow): 114mm
+ * - Link 2 (elbow→wrist roll): 87mm (5mm offset)
+ * - Wrist roll→pitch: 37mm
+ * - Wrist pitch→pointer tip: 80mm
+ * - Total Link2 for IK: 204mm (87 + 37 + 80)
+ * - Max reach: ~318mm
+ * (the constants are in arm_config.h)
+ *
+ * 2D IK in the arm's vertical plane. Both solvers return physical servo
+ * angles (0-180, shoulder mounting offset applied), truncated to whole
+ * degrees, preferring config 1 and falling back to config 2.
+ *
+ * calculate_2d_ik() is picked at compile time:
+ *   default              calculate_2d_ik_float (single-precision float)
+ *   -DARM_IK_FIXED_POINT calculate_2d_ik_fixed (Q16.16, CORDIC trig)
+ *
+ * Fixed-point error, measured on a 0.5mm grid over the whole reachable
+ * workspace:
+ *   - Joint angles before truncation, vs a double-precision reference:
+ *     < 0.001 degrees, rising to 0.09 degrees within 1mm of full stretch
+ *     or the inner reach limit, where acos is ill-conditioned (the float
+ *     solver degrades the same way)
+ *   - Tip position (forward kinematics of those angles): < 0.001mm
+ *   - Whole-degree outputs match calculate_2d_ik_float on 99.995% of
+ *     targets and differ by 1 degree on the rest
+ *   - Reachability decisions only differ for targets within 0.001mm of
+ *     the inner/outer workspace radius
+ *
+ * calculate_arm_ik() is the full solve: base yaw, shoulder, elbow and wrist
+ * pitch for a pointer tip position plus approach angle, using the real
+ * base height, shoulder offset and link lengths above (the 5mm forearm
+ * offset is ignored). See arm_ik_5dof.c.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "arm_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ARM_IK_MAX_SOLUTIONS 2
+
+// Physical servo angles (0-180, untruncated) for one IK branch
+typedef struct {
+    float base;
+    float shoulder;
+    float elbow;
+    float wrist_pitch;
+    int config;  // 1 = elbow up, 2 = elbow down, same as the 2D solvers
+} arm_pose_t;
+
+// Q16.16 fixed point
+typedef int32_t q16_t;
+#define Q16_ONE ((q16_t)1 << 16)
+#define FLOAT_TO_Q16(f) ((q16_t)((f) * 65536.0f))
+#define INT_TO_Q16(i) ((q16_t)(i) * Q16_ONE)  // Negative i too, so no shift
+
+// Prints the chosen config or the reason for failure when set
+extern bool arm_ik_verbose;
+
+bool calculate_2d_ik_float(float x, float z, float *shoulder_angle, float *elbow_angle);
+
+// Fixed-point kernel: x/z in Q16.16 mm, whole-degree physical angles out
+bool calculate_2d_ik_q16(q16_t x, q16_t z, int *shoulder_angle, int *elbow_angle);
+bool calculate_2d_ik_fixed(float x, float z, float *shoulder_angle, float *elbow_angle);
+
+// Pointer tip at (x, y, z): x forward, y left, z up from the table, origin
+// on the base axis. pitch_deg is the pointer's angle above horizontal
+// (-90 points straight down). Writes every valid branch to solutions[],
+// config 1 first, and returns how many there are (0 if unreachable).
+int calculate_arm_ik(float x, float y, float z, float pitch_deg, arm_pose_t solutions[ARM_IK_MAX_SOLUTIONS]);
+
+// Batched 2D solve over structure-of-arrays inputs, for planning and
+// workspace sweeps. Vectorised with AVX or SSE2 when the compiler targets
+// them, scalar otherwise. Never prints.
+//   y/base: optional (NULL). With y, each target is (x, y, z) in 3D: the
+//           solve uses the radial distance and base[] gets 90 + yaw degrees
+//           like 2_js, with the yaw folded into the base's 0-180 and the
+//           radius negated for targets behind (x < 0), as calculate_arm_ik
+//           does. Without it x is the radial distance.
+//   shoulder/elbow: whole-degree physical angles, 0 where invalid
+//   valid: 1 if the target solved (config 1 preferred, as above)
+// Returns the number of valid targets. Agrees with calculate_2d_ik_float
+// except where its polynomial trig lands on the other side of a
+// whole-degree truncation.
+int calculate_2d_ik_batch(const float x[], const float y[], const float z[], int n,
+                          float base[], float shoulder[], float elbow[], uint8_t valid[]);
+const char *calculate_2d_ik_batch_isa(void);  // "avx", "sse2" or "scalar"
+
+// Branch selection (arm_ik_branch.c). Instead of always taking config 1,
+// pick the branch with the least joint travel from where the arm is, and
+// only switch branch when the other one wins by ARM_IK_BRANCH_HYSTERESIS.
+// A pick that still needs more than ARM_IK_CONTINUOUS_DEG on some joint
+// has no continuous path from here: the caller should run it as a
+// reconfiguration move (an S-curve at the servo limits) rather than a
+// short streamed step.
+#define ARM_IK_BRANCH_HYSTERESIS 10.0f  // Degrees of travel
+#define ARM_IK_CONTINUOUS_DEG    20.0f  // Largest per-joint jump treated as continuous
+
+// Both 2D branches as poses (base 90, wrist pitch WRIST_PITCH_STRAIGHT).
+// Accepts the same targets as calculate_2d_ik but keeps the sub-degree
+// angles for angle_to_pulse_f. Config 1 first; returns count.
+int calculate_2d_ik_branches(float x, float z, arm_pose_t solutions[ARM_IK_MAX_SOLUTIONS]);
+
+// Largest joint difference between two poses, in degrees
+float arm_pose_travel(const arm_pose_t *a, const arm_pose_t *b);
+
+// Index into solutions[] of the branch to use from current (its config
+// field is the branch the arm is on, 0 if unknown), or -1 if count is 0
+int arm_ik_select_branch(const arm_pose_t solutions[], int count, const arm_pose_t *current);
+
+// Resolved-rate control (arm_ik_rate.c). Angles here are IK-frame degrees:
+// shoulder above horizontal, elbow bend from straight (positive = config 1).
+#define IK_SHOULDER_FROM_SERVO(s) (90.0f - SHOULDER_MOUNT_OFFSET - (s))
+#define IK_ELBOW_FROM_SERVO(e)    (90.0f - (e))
+#define SERVO_SHOULDER_FROM_IK(a) (90.0f - SHOULDER_MOUNT_OFFSET - (a))
+#define SERVO_ELBOW_FROM_IK(b)    (90.0f - (b))
+
+#define ARM_RATE_DAMPING_ZONE 0.15f   // |sin(elbow bend)| below which damping starts (~8.6 deg)
+#define ARM_RATE_DAMPING      40.0f   // mm, damping at the straight-arm singularity
+#define ARM_RATE_MIN_BEND     5.0f    // Degrees; keeps the elbow off dead straight so it can fold back
+
+// Tip position of a 2-link arm
+void forward_2link(float link1, float link2, float shoulder_deg, float elbow_deg, float *x, float *z);
+
+// Joint rates (deg/s) for tip velocity (vx, vz) in mm/s, damped least
+// squares near the straight-arm singularity
+void calculate_2link_rates(float link1, float link2, float shoulder_deg, float elbow_deg,
+                           float vx, float vz, float *shoulder_rate, float *elbow_rate);
+
+// Clamps to the shoulder/elbow servo ranges, keeping the elbow at least
+// ARM_RATE_MIN_BEND on its side of straight (elbow_up = config 1)
+void clamp_2link_joints(float *shoulder_deg, float *elbow_deg, bool elbow_up);
+
+// One resolved-rate step of dt seconds, clamped. An elbow that hits its limit
+// is held there and the shoulder alone tracks what it can of (vx, vz).
+void step_2link_rates(float link1, float link2, float *shoulder_deg, float *elbow_deg,
+                      float vx, float vz, float dt, bool elbow_up);
+
+#ifdef ARM_IK_FIXED_POINT
+#define calculate_2d_ik calculate_2d_ik_fixed
+#else
+#define calculate_2d_ik calculate_2d_ik_float
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,101 @@
+#include "arm_ik.h"
+#include <stdio.h>
+#include <math.h>
+
+/*
+ * Full analytic IK: base yaw, shoulder, elbow, wrist pitch.
+ *
+ * The base yaw puts the target in the arm's vertical plane. Backing the
+ * pointer length off along the approach direction gives the wrist pitch
+ * axis, which the shoulder/elbow pair reach as a 2-link problem from the
+ * shoulder axis (BASE_HEIGHT up, SHOULDER_OFFSET out). The wrist then
+ * takes up whatever angle is left between the forearm and the approach.
+ *
+ * The base only covers 180 degrees, so there is one yaw per target:
+ * targets behind the base axis are reached by leaning back over it, with
+ * the radial coordinate negative. The two elbow branches share the single
+ * atan2/sqrt/2x acos, so a full solve costs about the same as the 2D one
+ * plus one sin/cos pair.
+ */
+
+#define RAD_TO_DEG 57.2957795f
+#define DEG_TO_RAD 0.0174532925f
+
+static bool servo_angle_valid(float angle) {
+    return angle >= 0.0f && angle <= 180.0f;
+}
+
+static float clamp_unit(float c) {
+    return c > 1.0f ? 1.0f : (c < -1.0f ? -1.0f : c);
+}
+
+int calculate_arm_ik(float x, float y, float z, float pitch_deg, arm_pose_t solutions[ARM_IK_MAX_SOLUTIONS]) {
+    // Base yaw, folded into the servo's +/-90 degree range
+    float radial = sqrtf(x*x + y*y);
+    float yaw = radial > 0.0f ? atan2f(y, x) * RAD_TO_DEG : 0.0f;
+    float pitch_rad = pitch_deg * DEG_TO_RAD;
+    float approach_r = cosf(pitch_rad);
+    float approach_z = sinf(pitch_rad);
+    float pointer_angle = pitch_deg;  // Pointer angle in the arm plane
+
+    if (yaw > 90.0f || yaw < -90.0f) {
+        yaw += yaw > 0.0f ? -180.0f : 180.0f;
+        radial = -radial;
+        approach_r = -approach_r;
+        pointer_angle = 180.0f - pitch_deg;
+    }
+
+    // Wrist pitch axis relative to the shoulder axis
+    float u = radial - POINTER_LENGTH * approach_r - SHOULDER_OFFSET;
+    float v = z - POINTER_LENGTH * approach_z - BASE_HEIGHT;
+    float d2 = u*u + v*v;
+    float distance = sqrtf(d2);
+
+    if (distance > LINK1 + FOREARM_LENGTH || distance < fabsf(FOREARM_LENGTH - LINK1) || distance == 0.0f) {
+        if (arm_ik_verbose) printf("Wrist unreachable! Distance from shoulder: %.1f\n", distance);
+        return 0;
+    }
+
+    // Shared by both elbow branches
+    float cos_elbow = clamp_unit((LINK1*LINK1 + FOREARM_LENGTH*FOREARM_LENGTH - d2) / (2.0f * LINK1 * FOREARM_LENGTH));
+    float cos_shoulder_offset = clamp_unit((LINK1*LINK1 + d2 - FOREARM_LENGTH*FOREARM_LENGTH) / (2.0f * LINK1 * distance));
+    float angle_to_wrist = atan2f(v, u) * RAD_TO_DEG;
+    float shoulder_offset = acosf(cos_shoulder_offset) * RAD_TO_DEG;
+    float elbow_bend = 180.0f - acosf(cos_elbow) * RAD_TO_DEG;
+
+    int count = 0;
+    for (int config = 1; config <= 2; config++) {
+        float sign = config == 1 ? 1.0f : -1.0f;
+        float shoulder_ik = angle_to_wrist + sign * shoulder_offset;
+        float elbow_ik = sign * elbow_bend;
+
+        // Wrist bend from the forearm direction to the approach, in (-180, 180]
+        float wrist_ik = shoulder_ik - elbow_ik - pointer_angle;
+        while (wrist_ik > 180.0f) wrist_ik -= 360.0f;
+        while (wrist_ik <= -180.0f) wrist_ik += 360.0f;
+
+        arm_pose_t pose;
+        pose.base = 90.0f + yaw;
+        pose.shoulder = 90.0f - (shoulder_ik + SHOULDER_MOUNT_OFFSET);
+        pose.elbow = 90.0f - elbow_ik;
+        pose.wrist_pitch = WRIST_PITCH_STRAIGHT - wrist_ik;
+        pose.config = config;
+
+        if (servo_angle_valid(pose.base) && servo_angle_valid(pose.shoulder) &&
+            servo_angle_valid(pose.elbow) && servo_angle_valid(pose.wrist_pitch)) {
+            solutions[count++] = pose;
+        }
+    }
+
+    if (arm_ik_verbose) {
+        if (count == 0) {
+            printf("No valid servo angles for Target(%.1f, %.1f, %.1f) pitch %.1f\n", x, y, z, pitch_deg);
+        }
+        for (int i = 0; i < count; i++) {
+            printf("IK Config %d: Target(%.1f, %.1f, %.1f) pitch %.1f -> B=%.1f° S=%.1f° E=%.1f° W=%.1f°\n",
+                   solutions[i].config, x, y, z, pitch_deg, solutions[i].base, solutions[i].shoulder,
+                   solutions[i].elbow, solutions[i].wrist_pitch);
+        }
+    }
+    return count;
+}
@@ -0,0 +1,269 @@
+#include "arm_ik.h"
+#include <stddef.h>
+#include <math.h>
+
+/*
+ * Batched 2D IK for planning and workspace sweeps.
+ *
+ * Same maths and config choice as calculate_2d_ik_float, but atan2 and
+ * acos are polynomial approximations so the whole solve maps onto SIMD
+ * lanes: 8 at a time with AVX, 4 with SSE2, and a scalar loop using the
+ * same polynomials everywhere else (firmware, and the leftover tail), so
+ * a target solves the same whether it lands in a SIMD lane or the tail.
+ *
+ * atan: max error 1e-5 rad. acos: Abramowitz & Stegun 4.4.46, 2e-8 rad.
+ */
+
+#define RAD_TO_DEG 57.2957795f
+#define PI_F       3.14159265f
+#define HALF_PI_F  1.57079633f
+
+#define ATAN_C1  0.99997726f
+#define ATAN_C3 -0.33262347f
+#define ATAN_C5  0.19354346f
+#define ATAN_C7 -0.11643287f
+#define ATAN_C9  0.05265332f
+#define ATAN_C11 -0.01172120f
+
+#define ACOS_C0  1.5707963050f
+#define ACOS_C1 -0.2145988016f
+#define ACOS_C2  0.0889789874f
+#define ACOS_C3 -0.0501743046f
+#define ACOS_C4  0.0308918810f
+#define ACOS_C5 -0.0170881256f
+#define ACOS_C6  0.0066700901f
+#define ACOS_C7 -0.0012624911f
+
+#define MIN_REACH (LINK2 - LINK1)  // LINK2 > LINK1
+#define MAX_REACH (LINK1 + LINK2)
+
+/* ---------------- scalar ---------------- */
+
+static inline float atan2_s(float y, float x) {
+    float ax = fabsf(x), ay = fabsf(y);
+    float hi = ax > ay ? ax : ay;
+    float lo = ax > ay ? ay : ax;
+    float t = hi > 0.0f ? lo / hi : 0.0f;
+    float t2 = t * t;
+    float r = t * (ATAN_C1 + t2 * (ATAN_C3 + t2 * (ATAN_C5 + t2 * (ATAN_C7 + t2 * (ATAN_C9 + t2 * ATAN_C11)))));
+    if (ay > ax) r = HALF_PI_F - r;
+    if (x < 0.0f) r = PI_F - r;
+    return y < 0.0f ? -r : r;
+}
+
+static inline float acos_s(float c) {
+    if (c > 1.0f) c = 1.0f;
+    if (c < -1.0f) c = -1.0f;
+    float a = fabsf(c);
+    float p = ACOS_C0 + a * (ACOS_C1 + a * (ACOS_C2 + a * (ACOS_C3 + a * (ACOS_C4 + a * (ACOS_C5 + a * (ACOS_C6 + a * ACOS_C7))))));
+    float r = sqrtf(1.0f - a) * p;
+    return c < 0.0f ? PI_F - r : r;
+}
+
+static void solve_scalar(const float x[], const float y[], const float z[], int i,
+                         float base[], float shoulder[], float elbow[], uint8_t valid[]) {
+    float r = x[i];
+    if (y) {
+        // Yaw folded into the base servo's +/-90 degrees, reaching behind
+        // with a negative radius, as calculate_arm_ik does
+        r = sqrtf(x[i] * x[i] + y[i] * y[i]);
+        float yaw = atan2_s(y[i], x[i]) * RAD_TO_DEG;
+        if (yaw > 90.0f || yaw < -90.0f) {
+            yaw += yaw > 0.0f ? -180.0f : 180.0f;
+            r = -r;
+        }
+        if (base) base[i] = 90.0f + yaw;
+    }
+
+    float d2 = r * r + z[i] * z[i];
+    float distance = sqrtf(d2);
+    if (distance > MAX_REACH || distance < MIN_REACH) {
+        shoulder[i] = 0.0f;
+        elbow[i] = 0.0f;
+        valid[i] = 0;
+        return;
+    }
+
+    float cos_elbow = (LINK1 * LINK1 + LINK2 * LINK2 - d2) * (1.0f / (2.0f * LINK1 * LINK2));
+    float cos_shoulder_offset = (LINK1 * LINK1 - LINK2 * LINK2 + d2) / (2.0f * LINK1 * distance);
+    float angle_to_target = atan2_s(z[i], r) * RAD_TO_DEG;
+    float shoulder_offset = acos_s(cos_shoulder_offset) * RAD_TO_DEG;
+    float elbow_ik = 180.0f - acos_s(cos_elbow) * RAD_TO_DEG;
+
+    float s1 = 90.0f - (float)(int)(angle_to_target + shoulder_offset + SHOULDER_MOUNT_OFFSET);
+    float s2 = 90.0f - (float)(int)(angle_to_target - shoulder_offset + SHOULDER_MOUNT_OFFSET);
+    float e1 = 90.0f - (float)(int)elbow_ik;
+    float e2 = 90.0f + (float)(int)elbow_ik;
+
+    bool ok1 = s1 >= 0.0f && s1 <= 180.0f && e1 >= 0.0f && e1 <= 180.0f;
+    bool ok2 = s2 >= 0.0f && s2 <= 180.0f && e2 >= 0.0f && e2 <= 180.0f;
+
+    shoulder[i] = ok1 ? s1 : (ok2 ? s2 : 0.0f);
+    elbow[i] = ok1 ? e1 : (ok2 ? e2 : 0.0f);
+    valid[i] = ok1 || ok2;
+}
+
+/* ---------------- SIMD ---------------- */
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define IK_LANES 8
+typedef __m256 vf;
+#define vset1(a)          _mm256_set1_ps(a)
+#define vload(p)          _mm256_loadu_ps(p)
+#define vstore(p, a)      _mm256_storeu_ps(p, a)
+#define vadd(a, b)        _mm256_add_ps(a, b)
+#define vsub(a, b)        _mm256_sub_ps(a, b)
+#define vmul(a, b)        _mm256_mul_ps(a, b)
+#define vdiv(a, b)        _mm256_div_ps(a, b)
+#define vsqrt(a)          _mm256_sqrt_ps(a)
+#define vmin(a, b)        _mm256_min_ps(a, b)
+#define vmax(a, b)        _mm256_max_ps(a, b)
+#define vand(a, b)        _mm256_and_ps(a, b)
+#define vandnot(a, b)     _mm256_andnot_ps(a, b)
+#define vor(a, b)         _mm256_or_ps(a, b)
+#define vgt(a, b)         _mm256_cmp_ps(a, b, _CMP_GT_OQ)
+#define vge(a, b)         _mm256_cmp_ps(a, b, _CMP_GE_OQ)
+#define vle(a, b)         _mm256_cmp_ps(a, b, _CMP_LE_OQ)
+#define vselect(m, a, b)  _mm256_blendv_ps(b, a, m)
+#define vtrunc(a)         _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)
+#define vmask(m)          _mm256_movemask_ps(m)
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define IK_LANES 4
+typedef __m128 vf;
+#define vset1(a)          _mm_set1_ps(a)
+#define vload(p)          _mm_loadu_ps(p)
+#define vstore(p, a)      _mm_storeu_ps(p, a)
+#define vadd(a, b)        _mm_add_ps(a, b)
+#define vsub(a, b)        _mm_sub_ps(a, b)
+#define vmul(a, b)        _mm_mul_ps(a, b)
+#define vdiv(a, b)        _mm_div_ps(a, b)
+#define vsqrt(a)          _mm_sqrt_ps(a)
+#define vmin(a, b)        _mm_min_ps(a, b)
+#define vmax(a, b)        _mm_max_ps(a, b)
+#define vand(a, b)        _mm_and_ps(a, b)
+#define vandnot(a, b)     _mm_andnot_ps(a, b)
+#define vor(a, b)         _mm_or_ps(a, b)
+#define vgt(a, b)         _mm_cmpgt_ps(a, b)
+#define vge(a, b)         _mm_cmpge_ps(a, b)
+#define vle(a, b)         _mm_cmple_ps(a, b)
+#define vselect(m, a, b)  _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#define vtrunc(a)         _mm_cvtepi32_ps(_mm_cvttps_epi32(a))
+#define vmask(m)          _mm_movemask_ps(m)
+#endif
+
+#ifdef IK_LANES
+static inline vf vabs(vf a) {
+    return vandnot(vset1(-0.0f), a);
+}
+
+static inline vf atan2_v(vf y, vf x) {
+    vf ax = vabs(x), ay = vabs(y);
+    vf hi = vmax(ax, ay);
+    vf lo = vmin(ax, ay);
+    vf t = vselect(vgt(hi, vset1(0.0f)), vdiv(lo, hi), vset1(0.0f));
+    vf t2 = vmul(t, t);
+    vf p = vadd(vset1(ATAN_C9), vmul(t2, vset1(ATAN_C11)));
+    p = vadd(vset1(ATAN_C7), vmul(t2, p));
+    p = vadd(vset1(ATAN_C5), vmul(t2, p));
+    p = vadd(vset1(ATAN_C3), vmul(t2, p));
+    p = vadd(vset1(ATAN_C1), vmul(t2, p));
+    vf r = vmul(t, p);
+    r = vselect(vgt(ay, ax), vsub(vset1(HALF_PI_F), r), r);
+    r = vselect(vgt(vset1(0.0f), x), vsub(vset1(PI_F), r), r);
+    return vor(r, vand(y, vset1(-0.0f)));  // Copy y's sign
+}
+
+static inline vf acos_v(vf c) {
+    c = vmin(vmax(c, vset1(-1.0f)), vset1(1.0f));
+    vf a = vabs(c);
+    vf p = vadd(vset1(ACOS_C6), vmul(a, vset1(ACOS_C7)));
+    p = vadd(vset1(ACOS_C5), vmul(a, p));
+    p = vadd(vset1(ACOS_C4), vmul(a, p));
+    p = vadd(vset1(ACOS_C3), vmul(a, p));
+    p = vadd(vset1(ACOS_C2), vmul(a, p));
+    p = vadd(vset1(ACOS_C1), vmul(a, p));
+    p = vadd(vset1(ACOS_C0), vmul(a, p));
+    vf r = vmul(vsqrt(vsub(vset1(1.0f), a)), p);
+    return vselect(vgt(vset1(0.0f), c), vsub(vset1(PI_F), r), r);
+}
+
+static inline vf in_servo_range(vf a) {
+    return vand(vge(a, vset1(0.0f)), vle(a, vset1(180.0f)));
+}
+
+static void solve_lanes(const float x[], const float y[], const float z[], int i,
+                        float base[], float shoulder[], float elbow[], uint8_t valid[]) {
+    vf vx = vload(&x[i]);
+    vf vz = vload(&z[i]);
+    vf r = vx;
+    if (y) {
+        vf vy = vload(&y[i]);
+        r = vsqrt(vadd(vmul(vx, vx), vmul(vy, vy)));
+        vf yaw = vmul(atan2_v(vy, vx), vset1(RAD_TO_DEG));
+        vf behind = vgt(vabs(yaw), vset1(90.0f));
+        vf half_turn = vor(vset1(180.0f), vand(yaw, vset1(-0.0f)));  // 180 with yaw's sign
+        yaw = vselect(behind, vsub(yaw, half_turn), yaw);
+        r = vselect(behind, vsub(vset1(0.0f), r), r);
+        if (base) vstore(&base[i], vadd(vset1(90.0f), yaw));
+    }
+
+    vf d2 = vadd(vmul(r, r), vmul(vz, vz));
+    vf distance = vsqrt(d2);
+    vf reachable = vand(vle(distance, vset1(MAX_REACH)), vge(distance, vset1(MIN_REACH)));
+
+    vf cos_elbow = vmul(vsub(vset1(LINK1 * LINK1 + LINK2 * LINK2), d2), vset1(1.0f / (2.0f * LINK1 * LINK2)));
+    vf cos_shoulder_offset = vdiv(vadd(vset1(LINK1 * LINK1 - LINK2 * LINK2), d2), vmul(vset1(2.0f * LINK1), distance));
+    vf angle_to_target = vmul(atan2_v(vz, r), vset1(RAD_TO_DEG));
+    vf shoulder_offset = vmul(acos_v(cos_shoulder_offset), vset1(RAD_TO_DEG));
+    vf elbow_ik = vtrunc(vsub(vset1(180.0f), vmul(acos_v(cos_elbow), vset1(RAD_TO_DEG))));
+
+    vf mount = vset1((float)SHOULDER_MOUNT_OFFSET);
+    vf s1 = vsub(vset1(90.0f), vtrunc(vadd(vadd(angle_to_target, shoulder_offset), mount)));
+    vf s2 = vsub(vset1(90.0f), vtrunc(vadd(vsub(angle_to_target, shoulder_offset), mount)));
+    vf e1 = vsub(vset1(90.0f), elbow_ik);
+    vf e2 = vadd(vset1(90.0f), elbow_ik);
+
+    vf ok1 = vand(reachable, vand(in_servo_range(s1), in_servo_range(e1)));
+    vf ok2 = vand(reachable, vand(in_servo_range(s2), in_servo_range(e2)));
+
+    vf zero = vset1(0.0f);
+    vstore(&shoulder[i], vselect(ok1, s1, vselect(ok2, s2, zero)));
+    vstore(&elbow[i], vselect(ok1, e1, vselect(ok2, e2, zero)));
+
+    int mask = vmask(vor(ok1, ok2));
+    for (int lane = 0; lane < IK_LANES; lane++) {
+        valid[i + lane] = (mask >> lane) & 1;
+    }
+}
+#endif
+
+int calculate_2d_ik_batch(const float x[], const float y[], const float z[], int n,
+                          float base[], float shoulder[], float elbow[], uint8_t valid[]) {
+    int i = 0;
+#ifdef IK_LANES
+    for (; i + IK_LANES <= n; i += IK_LANES) {
+        solve_lanes(x, y, z, i, base, shoulder, elbow, valid);
+    }
+#endif
+    for (; i < n; i++) {
+        solve_scalar(x, y, z, i, base, shoulder, elbow, valid);
+    }
+
+    int solved = 0;
+    for (i = 0; i < n; i++) {
+        solved += valid[i];
+    }
+    return solved;
+}
+
+const char *calculate_2d_ik_batch_isa(void) {
+#if defined(__AVX__)
+    return "avx";
+#elif defined(__SSE2__)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
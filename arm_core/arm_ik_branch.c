@@ -0,0 +1,67 @@
+#include "arm_ik.h"
+#include <math.h>
+
+/*
+ * IK branch selection with hysteresis.
+ *
+ * The solvers list config 1 first, and taking it blindly means the elbow
+ * swings across its whole range whenever a target crosses the border
+ * where config 1 stops being valid, or back. Here the branch is picked by
+ * joint travel from the current pose: the move that gets there soonest
+ * under the same per-joint speed limits is the one with the smallest
+ * largest-joint change. Staying on the current branch is preferred until
+ * the other one is clearly better, so targets near the point where both
+ * cost the same don't make the elbow chatter.
+ */
+
+#define RAD_TO_DEG 57.2957795f
+
+int calculate_2d_ik_branches(float x, float z, arm_pose_t solutions[ARM_IK_MAX_SOLUTIONS]) {
+    float distance = sqrtf(x*x + z*z);
+    if (distance > LINK1 + LINK2 || distance < fabsf(LINK1 - LINK2) || distance == 0.0f) return 0;
+
+    float cos_elbow = (LINK1*LINK1 + LINK2*LINK2 - distance*distance) / (2.0f * LINK1 * LINK2);
+    float cos_shoulder_offset = (LINK1*LINK1 + distance*distance - LINK2*LINK2) / (2.0f * LINK1 * distance);
+    float angle_to_target = atan2f(z, x) * RAD_TO_DEG;
+    float shoulder_offset = acosf(fminf(1.0f, fmaxf(-1.0f, cos_shoulder_offset))) * RAD_TO_DEG;
+    float elbow_bend = 180.0f - acosf(fminf(1.0f, fmaxf(-1.0f, cos_elbow))) * RAD_TO_DEG;
+
+    int count = 0;
+    for (int config = 1; config <= 2; config++) {
+        float sign = config == 1 ? 1.0f : -1.0f;
+
+        // Validity uses the same whole-degree truncation as
+        // calculate_2d_ik_float, so both accept the same targets
+        float shoulder_ik = angle_to_target + sign * shoulder_offset;
+        float elbow_ik = sign * elbow_bend;
+        int shoulder = 90 - (int)(shoulder_ik + SHOULDER_MOUNT_OFFSET);
+        int elbow = 90 - (int)elbow_ik;
+        if (shoulder < 0 || shoulder > 180 || elbow < 0 || elbow > 180) continue;
+
+        arm_pose_t pose = {90.0f, SERVO_SHOULDER_FROM_IK(shoulder_ik), SERVO_ELBOW_FROM_IK(elbow_ik),
+                           WRIST_PITCH_STRAIGHT, config};
+        solutions[count++] = pose;
+    }
+    return count;
+}
+
+float arm_pose_travel(const arm_pose_t *a, const arm_pose_t *b) {
+    float travel = fabsf(a->base - b->base);
+    travel = fmaxf(travel, fabsf(a->shoulder - b->shoulder));
+    travel = fmaxf(travel, fabsf(a->elbow - b->elbow));
+    return fmaxf(travel, fabsf(a->wrist_pitch - b->wrist_pitch));
+}
+
+int arm_ik_select_branch(const arm_pose_t solutions[], int count, const arm_pose_t *current) {
+    int best = -1;
+    float best_cost = 0.0f;
+    for (int i = 0; i < count; i++) {
+        float cost = arm_pose_travel(&solutions[i], current);
+        if (solutions[i].config != current->config) cost += ARM_IK_BRANCH_HYSTERESIS;
+        if (best < 0 || cost < best_cost) {
+            best = i;
+            best_cost = cost;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,162 @@
+#include "arm_ik.h"
+#include <stdio.h>
+
+/*
+ * Q16.16 fixed-point IK for FPU-less targets (RP2040 Cortex-M0+, AVR).
+ *
+ * Same maths as calculate_2d_ik_float, with the trig done by CORDIC in
+ * vectoring mode working directly in degrees:
+ *   - one CORDIC pass on (x, z) gives angle_to_target and the distance
+ *   - acos(c) is atan2(sqrt(1 - c^2), c), one integer sqrt + one CORDIC pass
+ * Cosines are carried in Q30 so acos stays accurate near +/-1 (full
+ * stretch and the inner reach limit), where its slope blows up.
+ */
+
+#define CORDIC_ITERATIONS 24
+
+// atan(2^-i) in degrees, Q16.16
+static const int32_t cordic_atan_deg[CORDIC_ITERATIONS] = {
+    2949120, 1740967, 919879, 466945, 234379, 117304, 58666, 29335,
+    14668, 7334, 3667, 1833, 917, 458, 229, 115,
+    57, 29, 14, 7, 4, 2, 1, 0
+};
+
+// 1 / CORDIC gain, Q2.30
+#define CORDIC_INV_GAIN_Q30 652032874LL
+
+// Whole millimetres, rounded: the fixed-point kernel works to the nearest mm
+// if ARM_CONFIG_FILE sets fractional links
+#define L1_MM ((int32_t)(LINK1 + 0.5f))
+#define L2_MM ((int32_t)(LINK2 + 0.5f))
+
+// Rotates (x, y) onto the +x axis. Returns atan2(y, x) in degrees (Q16.16)
+// and stores the vector length, in the input units, in *mag.
+static q16_t cordic_vector(int32_t x, int32_t y, int32_t *mag) {
+    q16_t angle = 0;
+
+    // CORDIC only converges within ~99 degrees, so fold the left half plane over
+    if (x < 0) {
+        int32_t t = x;
+        if (y >= 0) {
+            x = y;
+            y = -t;
+            angle = INT_TO_Q16(90);
+        } else {
+            x = -y;
+            y = t;
+            angle = INT_TO_Q16(-90);
+        }
+    }
+
+    for (int i = 0; i < CORDIC_ITERATIONS; i++) {
+        int32_t xs = x >> i;
+        int32_t ys = y >> i;
+        if (y > 0) {
+            x += ys;
+            y -= xs;
+            angle += cordic_atan_deg[i];
+        } else {
+            x -= ys;
+            y += xs;
+            angle -= cordic_atan_deg[i];
+        }
+    }
+
+    if (mag) *mag = (int32_t)(((int64_t)x * CORDIC_INV_GAIN_Q30) >> 30);
+    return angle;
+}
+
+static uint32_t isqrt64(uint64_t v) {
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= result + bit) {
+            v -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+// acos of a Q30 cosine, in degrees (Q16.16)
+static q16_t acos_q30(int32_t c) {
+    const int32_t one = (int32_t)1 << 30;
+    if (c > one) c = one;
+    if (c < -one) c = -one;
+
+    uint32_t s = isqrt64((1ULL << 60) - (uint64_t)((int64_t)c * c));
+
+    // Drop to Q24 to leave CORDIC headroom for its ~1.65x growth
+    return cordic_vector(c >> 6, (int32_t)(s >> 6), NULL);
+}
+
+// (int) cast of a Q16.16 value: truncates toward zero like the float version
+static int q16_trunc(q16_t v) {
+    return v >= 0 ? (int)(v >> 16) : -(int)((-v) >> 16);
+}
+
+bool calculate_2d_ik_q16(q16_t x, q16_t z, int *shoulder_angle, int *elbow_angle) {
+    int32_t distance;
+    q16_t angle_to_target = cordic_vector(x, z, &distance);
+
+    // Check reachability
+    if (distance > INT_TO_Q16(L1_MM + L2_MM)) return false;
+    if (distance < INT_TO_Q16(L2_MM - L1_MM)) return false;
+
+    // Law of cosines with squares in Q32 mm^2, cosines in Q30
+    int64_t d2 = (int64_t)distance * distance;
+    // Multiplies, not shifts: L1 < L2 makes the shoulder term negative
+    int64_t elbow_num = (int64_t)(L1_MM * L1_MM + L2_MM * L2_MM) * ((int64_t)1 << 32) - d2;
+    int32_t cos_elbow = (int32_t)((elbow_num / (2 * L1_MM * L2_MM)) >> 2);
+
+    int64_t shoulder_num = (int64_t)(L1_MM * L1_MM - L2_MM * L2_MM) * ((int64_t)1 << 32) + d2;
+    int32_t cos_shoulder_offset = (int32_t)(shoulder_num * (1 << 14) / ((int64_t)2 * L1_MM * distance));
+
+    q16_t shoulder_offset = acos_q30(cos_shoulder_offset);
+
+    // Two possible IK solutions
+    q16_t shoulder_ik_1 = angle_to_target + shoulder_offset;
+    q16_t elbow_ik_1 = INT_TO_Q16(180) - acos_q30(cos_elbow);
+
+    q16_t shoulder_ik_2 = angle_to_target - shoulder_offset;
+    q16_t elbow_ik_2 = -elbow_ik_1;
+
+    // Apply mounting offset and convert to physical servo angles for both configs
+    int shoulder_physical_1 = 90 - q16_trunc(shoulder_ik_1 + INT_TO_Q16(SHOULDER_MOUNT_OFFSET));
+    int elbow_physical_1 = 90 - q16_trunc(elbow_ik_1);
+
+    int shoulder_physical_2 = 90 - q16_trunc(shoulder_ik_2 + INT_TO_Q16(SHOULDER_MOUNT_OFFSET));
+    int elbow_physical_2 = 90 - q16_trunc(elbow_ik_2);
+
+    bool config1_valid = (shoulder_physical_1 >= 0 && shoulder_physical_1 <= 180 && elbow_physical_1 >= 0 && elbow_physical_1 <= 180);
+    bool config2_valid = (shoulder_physical_2 >= 0 && shoulder_physical_2 <= 180 && elbow_physical_2 >= 0 && elbow_physical_2 <= 180);
+
+    if (config1_valid) {
+        *shoulder_angle = shoulder_physical_1;
+        *elbow_angle = elbow_physical_1;
+        return true;
+    } else if (config2_valid) {
+        *shoulder_angle = shoulder_physical_2;
+        *elbow_angle = elbow_physical_2;
+        return true;
+    }
+    return false;
+}
+
+bool calculate_2d_ik_fixed(float x, float z, float *shoulder_angle, float *elbow_angle) {
+    int shoulder, elbow;
+    if (!calculate_2d_ik_q16(FLOAT_TO_Q16(x), FLOAT_TO_Q16(z), &shoulder, &elbow)) {
+        if (arm_ik_verbose) printf("No valid IK solution for Target(%.1f, %.1f)\n", x, z);
+        return false;
+    }
+
+    *shoulder_angle = shoulder;
+    *elbow_angle = elbow;
+    if (arm_ik_verbose) printf("IK: Target(%.1f, %.1f) -> Servos S=%d° E=%d°\n", x, z, shoulder, elbow);
+    return true;
+}
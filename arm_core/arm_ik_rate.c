@@ -0,0 +1,115 @@
+#include "arm_ik.h"
+#include <math.h>
+
+/*
+ * Resolved-rate (velocity) IK for a 2-link arm.
+ *
+ * With shoulder angle a (from horizontal) and elbow bend b (0 = straight,
+ * forearm at a - b):
+ *   x = l1 cos(a) + l2 cos(a - b)
+ *   z = l1 sin(a) + l2 sin(a - b)
+ *   J = [ -l1 sin(a) - l2 sin(a-b)    l2 sin(a-b) ]
+ *       [  l1 cos(a) + l2 cos(a-b)   -l2 cos(a-b) ]
+ *   det J = l1 l2 sin(b)
+ *
+ * Joint rates come from damped least squares, J^T (J J^T + k^2 I)^-1 v,
+ * which is the exact inverse away from the straight-arm singularity and
+ * fades to a bounded least-squares step as |sin(b)| falls inside
+ * ARM_RATE_DAMPING_ZONE.
+ */
+
+#define RAD_TO_DEG 57.2957795f
+#define DEG_TO_RAD 0.0174532925f
+
+void forward_2link(float link1, float link2, float shoulder_deg, float elbow_deg, float *x, float *z) {
+    float a = shoulder_deg * DEG_TO_RAD;
+    float f = (shoulder_deg - elbow_deg) * DEG_TO_RAD;
+    *x = link1 * cosf(a) + link2 * cosf(f);
+    *z = link1 * sinf(a) + link2 * sinf(f);
+}
+
+void calculate_2link_rates(float link1, float link2, float shoulder_deg, float elbow_deg,
+                           float vx, float vz, float *shoulder_rate, float *elbow_rate) {
+    float a = shoulder_deg * DEG_TO_RAD;
+    float f = (shoulder_deg - elbow_deg) * DEG_TO_RAD;
+    float s1 = sinf(a), c1 = cosf(a);
+    float sf = sinf(f), cf = cosf(f);
+
+    float j11 = -link1 * s1 - link2 * sf;
+    float j12 = link2 * sf;
+    float j21 = link1 * c1 + link2 * cf;
+    float j22 = -link2 * cf;
+
+    // Damping grows from 0 at the edge of the zone to ARM_RATE_DAMPING at the singularity
+    float w = fabsf(sinf(elbow_deg * DEG_TO_RAD));
+    float k2 = 0.0f;
+    if (w < ARM_RATE_DAMPING_ZONE) {
+        float t = 1.0f - w / ARM_RATE_DAMPING_ZONE;
+        k2 = ARM_RATE_DAMPING * ARM_RATE_DAMPING * t * t;
+    }
+
+    // (J J^T + k^2 I)^-1 v, 2x2 closed form
+    float m11 = j11 * j11 + j12 * j12 + k2;
+    float m12 = j11 * j21 + j12 * j22;
+    float m22 = j21 * j21 + j22 * j22 + k2;
+    float det = m11 * m22 - m12 * m12;
+    if (det <= 0.0f) {
+        *shoulder_rate = 0.0f;
+        *elbow_rate = 0.0f;
+        return;
+    }
+    float y1 = (m22 * vx - m12 * vz) / det;
+    float y2 = (m11 * vz - m12 * vx) / det;
+
+    *shoulder_rate = (j11 * y1 + j21 * y2) * RAD_TO_DEG;
+    *elbow_rate = (j12 * y1 + j22 * y2) * RAD_TO_DEG;
+}
+
+static float clamp_shoulder(float shoulder_deg) {
+    float shoulder_min = IK_SHOULDER_FROM_SERVO(180.0f);
+    float shoulder_max = IK_SHOULDER_FROM_SERVO(0.0f);
+    if (shoulder_deg < shoulder_min) return shoulder_min;
+    if (shoulder_deg > shoulder_max) return shoulder_max;
+    return shoulder_deg;
+}
+
+// Elbow servo covers bends of -90..90; stay on the current side of straight
+static float clamp_elbow(float elbow_deg, bool elbow_up) {
+    float elbow_min = elbow_up ? ARM_RATE_MIN_BEND : IK_ELBOW_FROM_SERVO(180.0f);
+    float elbow_max = elbow_up ? IK_ELBOW_FROM_SERVO(0.0f) : -ARM_RATE_MIN_BEND;
+    if (elbow_deg < elbow_min) return elbow_min;
+    if (elbow_deg > elbow_max) return elbow_max;
+    return elbow_deg;
+}
+
+void clamp_2link_joints(float *shoulder_deg, float *elbow_deg, bool elbow_up) {
+    *shoulder_deg = clamp_shoulder(*shoulder_deg);
+    *elbow_deg = clamp_elbow(*elbow_deg, elbow_up);
+}
+
+void step_2link_rates(float link1, float link2, float *shoulder_deg, float *elbow_deg,
+                      float vx, float vz, float dt, bool elbow_up) {
+    float shoulder_rate, elbow_rate;
+    calculate_2link_rates(link1, link2, *shoulder_deg, *elbow_deg, vx, vz, &shoulder_rate, &elbow_rate);
+
+    float shoulder = *shoulder_deg + shoulder_rate * dt;
+    float elbow = *elbow_deg + elbow_rate * dt;
+    bool shoulder_held = clamp_shoulder(shoulder) != shoulder;
+    bool elbow_held = clamp_elbow(elbow, elbow_up) != elbow;
+
+    // A joint at its limit is held there and the other one alone follows
+    // the part of v it can reach, (J col . v) / |J col|^2. At full stretch
+    // this slides the tip along the boundary.
+    if (shoulder_held != elbow_held) {
+        float a = *shoulder_deg * DEG_TO_RAD;
+        float f = (*shoulder_deg - *elbow_deg) * DEG_TO_RAD;
+        float jx = elbow_held ? -link1 * sinf(a) - link2 * sinf(f) : link2 * sinf(f);
+        float jz = elbow_held ? link1 * cosf(a) + link2 * cosf(f) : -link2 * cosf(f);
+        float rate = (jx * vx + jz * vz) / (jx * jx + jz * jz) * RAD_TO_DEG;
+        shoulder = *shoulder_deg + (elbow_held ? rate * dt : 0.0f);
+        elbow = *elbow_deg + (shoulder_held ? rate * dt : 0.0f);
+    }
+
+    *shoulder_deg = clamp_shoulder(shoulder);
+    *elbow_deg = clamp_elbow(elbow, elbow_up);
+}
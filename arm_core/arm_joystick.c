@@ -0,0 +1,146 @@
+#include "arm_joystick.h"
+
+// 2*pi in Q16, over the Q8 of the cutoff: k = 2*pi*fc/rate in Q16
+#define TWO_PI_Q16_PER_Q8 1608
+
+static int32_t abs32(int32_t v) {
+    return v < 0 ? -v : v;
+}
+
+static uint32_t isqrt32(uint32_t v) {
+    uint32_t root = 0, bit = (uint32_t)1 << 30;
+    while (bit > v) bit >>= 2;
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+// Exponential smoothing factor for a cutoff: k / (1 + k), Q16
+static int32_t smoothing_alpha(int32_t cutoff_q8, int32_t rate_hz) {
+    int32_t k = (int32_t)((int64_t)cutoff_q8 * TWO_PI_Q16_PER_Q8 / rate_hz);
+    return (int32_t)(((int64_t)k << 16) / (k + 65536));
+}
+
+static void set_spans(joystick_t *js, int axis) {
+    int32_t centre = js->centre_q4[axis];
+    js->span_neg_q4[axis] = (int32_t)((int64_t)centre * JOYSTICK_RANGE_INITIAL / 256);
+    js->span_pos_q4[axis] = (int32_t)((int64_t)((js->full_scale << 4) - centre) * JOYSTICK_RANGE_INITIAL / 256);
+}
+
+void joystick_init(joystick_t *js, int num_axes, int adc_bits, int rate_hz) {
+    js->num_axes = num_axes > JOYSTICK_MAX_AXES ? JOYSTICK_MAX_AXES : num_axes;
+    js->full_scale = (1 << adc_bits) - 1;
+    js->rate_hz = rate_hz;
+    js->min_cutoff_q8 = JOYSTICK_MIN_CUTOFF_Q8;
+    js->beta_q8 = JOYSTICK_BETA_Q8;
+    js->expo_q15 = JOYSTICK_EXPO_Q15;
+    js->speed_alpha_q16 = smoothing_alpha(JOYSTICK_DCUTOFF_Q8, rate_hz);
+    js->deadzone = JOYSTICK_DEADZONE_MIN;
+    js->cal_passes = 0;
+
+    for (int i = 0; i < js->num_axes; i++) {
+        js->centre_q4[i] = (js->full_scale + 1) << 3;  // Nominal mid-scale
+        set_spans(js, i);
+        js->cal_sum[i] = 0;
+        js->cal_min[i] = js->full_scale;
+        js->cal_max[i] = 0;
+        js->filtered[i] = 0;
+        js->speed[i] = 0;
+    }
+}
+
+bool joystick_calibrated(const joystick_t *js) {
+    return js->cal_passes >= JOYSTICK_CAL_PASSES;
+}
+
+static void finish_calibration(joystick_t *js) {
+    int32_t noise = 0;
+    bool at_rest = true;
+    for (int i = 0; i < js->num_axes; i++) {
+        int32_t centre = js->cal_sum[i] * 16 / JOYSTICK_CAL_PASSES;
+        int32_t spread = js->cal_max[i] - js->cal_min[i];
+        if (abs32(centre - js->centre_q4[i]) > js->full_scale * 2 || spread > js->full_scale / 16) at_rest = false;
+        if (spread > noise) noise = spread;
+    }
+    if (!at_rest) return;  // Held off centre: keep the nominal centre and dead zone
+
+    int32_t span_min = 0x7FFFFFFF;
+    for (int i = 0; i < js->num_axes; i++) {
+        js->centre_q4[i] = js->cal_sum[i] * 16 / JOYSTICK_CAL_PASSES;
+        set_spans(js, i);
+        if (js->span_neg_q4[i] < span_min) span_min = js->span_neg_q4[i];
+        if (js->span_pos_q4[i] < span_min) span_min = js->span_pos_q4[i];
+    }
+
+    int32_t deadzone = (int32_t)((int64_t)noise * 16 * JOYSTICK_ONE * JOYSTICK_DEADZONE_NOISE / span_min);
+    if (deadzone < JOYSTICK_DEADZONE_MIN) deadzone = JOYSTICK_DEADZONE_MIN;
+    if (deadzone > JOYSTICK_DEADZONE_MAX) deadzone = JOYSTICK_DEADZONE_MAX;
+    js->deadzone = deadzone;
+}
+
+// Centred and scaled to Q15, widening the range when the stick goes further
+static int32_t normalise(joystick_t *js, int axis, uint16_t raw) {
+    int32_t d = ((int32_t)raw << 4) - js->centre_q4[axis];
+    int32_t *span = d < 0 ? &js->span_neg_q4[axis] : &js->span_pos_q4[axis];
+    if (abs32(d) > *span) *span = abs32(d);
+    if (*span == 0) return 0;
+    return (int32_t)((int64_t)d * JOYSTICK_ONE / *span);
+}
+
+static int32_t one_euro(joystick_t *js, int axis, int32_t x) {
+    int32_t *filtered = &js->filtered[axis];
+    int32_t *speed = &js->speed[axis];
+
+    int32_t dx = (x - *filtered) * js->rate_hz;
+    *speed += (int32_t)(((int64_t)(dx - *speed) * js->speed_alpha_q16) >> 16);
+
+    int32_t cutoff = js->min_cutoff_q8 + (int32_t)((int64_t)js->beta_q8 * abs32(*speed) / JOYSTICK_ONE);
+    int32_t alpha = smoothing_alpha(cutoff, js->rate_hz);
+    *filtered += (int32_t)(((int64_t)(x - *filtered) * alpha) >> 16);
+    return *filtered;
+}
+
+bool joystick_update(joystick_t *js, const uint16_t raw[], int16_t out[]) {
+    if (!joystick_calibrated(js)) {
+        for (int i = 0; i < js->num_axes; i++) {
+            js->cal_sum[i] += raw[i];
+            if (raw[i] < js->cal_min[i]) js->cal_min[i] = raw[i];
+            if (raw[i] > js->cal_max[i]) js->cal_max[i] = raw[i];
+            out[i] = 0;
+        }
+        if (++js->cal_passes == JOYSTICK_CAL_PASSES) finish_calibration(js);
+        return false;
+    }
+
+    int32_t v[JOYSTICK_MAX_AXES];
+    uint32_t sum_sq = 0;
+    for (int i = 0; i < js->num_axes; i++) {
+        v[i] = one_euro(js, i, normalise(js, i, raw[i]));
+        sum_sq += (uint32_t)(v[i] * v[i]);
+    }
+
+    // Radial dead zone, rescaled from its edge and clamped to the circle
+    int32_t r = js->num_axes == 1 ? abs32(v[0]) : (int32_t)isqrt32(sum_sq);
+    if (r <= js->deadzone) {
+        for (int i = 0; i < js->num_axes; i++) out[i] = 0;
+        return true;
+    }
+    int32_t scaled = (r - js->deadzone) * JOYSTICK_ONE / (JOYSTICK_ONE - js->deadzone);
+    if (scaled > JOYSTICK_ONE) scaled = JOYSTICK_ONE;
+
+    // Response curve on the magnitude
+    int32_t cubed = ((scaled * scaled) >> 15) * scaled >> 15;
+    int32_t shaped = (int32_t)(((int64_t)(JOYSTICK_ONE - js->expo_q15) * scaled + (int64_t)js->expo_q15 * cubed) >> 15);
+
+    for (int i = 0; i < js->num_axes; i++) {
+        out[i] = (int16_t)((int64_t)v[i] * shaped / r);
+    }
+    return true;
+}
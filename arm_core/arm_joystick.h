@@ -0,0 +1,89 @@
+#ifndef ARM_JOYSTICK_H
+#define ARM_JOYSTICK_H
+
+/*
+ * JOYSTICK CONDITIONING
+ *
+ * Turns raw ADC readings of one stick (one or two axes) into deflections
+ * in Q15 (-32767..32767), integer maths only:
+ *
+ *   1. Auto-centre: the first JOYSTICK_CAL_PASSES updates only measure the
+ *      stick at rest (centre to 1/16 count, and its noise) and output 0.
+ *      A stick that isn't at rest then falls back to the nominal centre.
+ *   2. Range: each side of each axis starts at JOYSTICK_RANGE_INITIAL of
+ *      the way to the rail and widens to whatever the stick is seen to
+ *      reach, so full deflection means this stick's full travel.
+ *   3. One-euro filter per axis: a low-pass whose cutoff rises with speed,
+ *      min_cutoff at rest (steady small corrections) and up by beta per
+ *      full scale per second (fast swings keep little lag).
+ *   4. Radial dead zone on the stick's deflection, sized from the noise
+ *      measured at calibration, rescaled so output starts from 0 at its
+ *      edge; the square's corners are clamped to the unit circle.
+ *   5. Response curve on the magnitude: (1 - expo) r + expo r^3, direction
+ *      kept.
+ *
+ * Updates run at the loop rate given to joystick_init(). The output depends
+ * only on the sequence of raw readings, so recorded sessions (which keep
+ * the raw ADC) replay exactly.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define JOYSTICK_MAX_AXES 2
+#define JOYSTICK_ONE      32767  // Full deflection, Q15
+
+#define JOYSTICK_CAL_PASSES      10
+#define JOYSTICK_RANGE_INITIAL   224   // Of 256: starting span, centre to rail
+#define JOYSTICK_DEADZONE_MIN    1638  // Q15, 5%
+#define JOYSTICK_DEADZONE_MAX    4915  // Q15, 15%
+#define JOYSTICK_DEADZONE_NOISE  3     // Dead zone per peak-to-peak noise at rest
+
+// Filter and curve defaults, copied into each joystick_t by joystick_init()
+#define JOYSTICK_MIN_CUTOFF_Q8   256   // 1Hz
+#define JOYSTICK_BETA_Q8         1024  // +4Hz per full scale per second
+#define JOYSTICK_DCUTOFF_Q8      256   // 1Hz, for the speed estimate
+#define JOYSTICK_EXPO_Q15        16384 // 0.5
+
+typedef struct {
+    // Settings
+    int num_axes;
+    int32_t full_scale;      // Highest ADC reading
+    int32_t rate_hz;         // Update rate
+    int32_t min_cutoff_q8;   // Hz, Q8
+    int32_t beta_q8;         // Hz per full scale/s, Q8
+    int32_t expo_q15;
+
+    // Calibration, raw counts in Q4
+    int32_t centre_q4[JOYSTICK_MAX_AXES];
+    int32_t span_neg_q4[JOYSTICK_MAX_AXES];
+    int32_t span_pos_q4[JOYSTICK_MAX_AXES];
+    int32_t deadzone;        // Q15
+    int cal_passes;
+    int32_t cal_sum[JOYSTICK_MAX_AXES];
+    int32_t cal_min[JOYSTICK_MAX_AXES];
+    int32_t cal_max[JOYSTICK_MAX_AXES];
+
+    // One-euro state, Q15 and Q15 per second
+    int32_t filtered[JOYSTICK_MAX_AXES];
+    int32_t speed[JOYSTICK_MAX_AXES];
+    int32_t speed_alpha_q16;
+} joystick_t;
+
+void joystick_init(joystick_t *js, int num_axes, int adc_bits, int rate_hz);
+
+// One update per loop pass: raw[] in, out[] in Q15. Returns false while
+// still calibrating (out[] is 0).
+bool joystick_update(joystick_t *js, const uint16_t raw[], int16_t out[]);
+
+bool joystick_calibrated(const joystick_t *js);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,169 @@
+#include "arm_line.h"
+#include "arm_ik.h"
+#include "arm_servo.h"
+#include "motion_executor.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define RAD_TO_DEG 57.2957795f
+
+// One per move that can be alive at once: a full queue plus the two playing
+// while one blends into the next
+#define LINE_POOL (MOTION_QUEUE_SIZE + 2)
+static arm_line_t lines[LINE_POOL];
+static int next_line = 0;
+
+static volatile float max_error = 0.0f;
+
+// Exact 2-link solution on one branch, in IK-frame degrees. False if it's
+// out of reach or outside the servo ranges on that branch.
+static bool branch_joints(float x, float z, bool elbow_up, float *shoulder, float *elbow) {
+    float c = (x * x + z * z - LINK1 * LINK1 - LINK2 * LINK2) / (2.0f * LINK1 * LINK2);
+    if (c > 1.0f || c < -1.0f) return false;
+
+    float b = elbow_up ? acosf(c) : -acosf(c);
+    float a = atan2f(z, x) + atan2f(LINK2 * sinf(b), LINK1 + LINK2 * c);
+    *shoulder = a * RAD_TO_DEG;
+    *elbow = b * RAD_TO_DEG;
+
+    float clamped_shoulder = *shoulder, clamped_elbow = *elbow;
+    clamp_2link_joints(&clamped_shoulder, &clamped_elbow, elbow_up);
+    return clamped_shoulder == *shoulder && clamped_elbow == *elbow;
+}
+
+static bool near_singular(float elbow_deg) {
+    return fabsf(sinf(elbow_deg / RAD_TO_DEG)) < ARM_RATE_DAMPING_ZONE;
+}
+
+// Fills line from the queued end of the shoulder/elbow and walks it.
+// limits[] gets the tip vel/accel/jerk (mm) the joints allow, end_pulses[]
+// the exact end setpoint.
+static arm_line_result_t plan_line(arm_line_t *line, int shoulder_servo, int elbow_servo, float x, float z,
+                                   float limits[3], int end_pulses[2]) {
+    int start_pulses[2] = {motion_executor_planned_level(shoulder_servo),
+                           motion_executor_planned_level(elbow_servo)};
+    line->servo_nums[0] = shoulder_servo;
+    line->servo_nums[1] = elbow_servo;
+    line->shoulder = IK_SHOULDER_FROM_SERVO(pulse_to_angle(shoulder_servo, start_pulses[0]));
+    line->elbow = IK_ELBOW_FROM_SERVO(pulse_to_angle(elbow_servo, start_pulses[1]));
+    if (near_singular(line->elbow)) return ARM_LINE_SINGULAR;
+    line->elbow_up = line->elbow > 0.0f;
+
+    forward_2link(LINK1, LINK2, line->shoulder, line->elbow, &line->x0, &line->z0);
+    line->dx = x - line->x0;
+    line->dz = z - line->z0;
+    line->last_x = line->x0;
+    line->last_z = line->z0;
+
+    float length = sqrtf(line->dx * line->dx + line->dz * line->dz);
+    int samples = (int)ceilf(length / ARM_LINE_CHECK_MM);
+    if (samples < 1) samples = 1;
+
+    // Steepest pulses per mm of each joint between samples
+    float steepest[2] = {0.0f, 0.0f};
+    int prev[2] = {start_pulses[0], start_pulses[1]};
+    for (int i = 1; i <= samples; i++) {
+        float t = (float)i / samples;
+        float shoulder, elbow;
+        if (!branch_joints(line->x0 + line->dx * t, line->z0 + line->dz * t, line->elbow_up, &shoulder, &elbow)) {
+            return ARM_LINE_UNREACHABLE;
+        }
+        if (near_singular(elbow)) return ARM_LINE_SINGULAR;
+
+        int pulses[2] = {angle_to_pulse_f(shoulder_servo, SERVO_SHOULDER_FROM_IK(shoulder)),
+                         angle_to_pulse_f(elbow_servo, SERVO_ELBOW_FROM_IK(elbow))};
+        for (int j = 0; j < 2; j++) {
+            float slope = length > 1e-3f ? abs(pulses[j] - prev[j]) * samples / length : 0.0f;
+            if (slope > steepest[j]) steepest[j] = slope;
+            prev[j] = pulses[j];
+        }
+    }
+    end_pulses[0] = prev[0];
+    end_pulses[1] = prev[1];
+
+    limits[0] = ARM_LINE_MAX_SPEED;
+    limits[1] = ARM_LINE_MAX_ACCEL;
+    limits[2] = ARM_LINE_MAX_JERK;
+    for (int j = 0; j < 2; j++) {
+        if (steepest[j] <= 0.0f) continue;
+        float joint[3];
+        motion_executor_get_limits(line->servo_nums[j], &joint[0], &joint[1], &joint[2]);
+        for (int k = 0; k < 3; k++) {
+            if (joint[k] / steepest[j] < limits[k]) limits[k] = joint[k] / steepest[j];
+        }
+    }
+
+    // Normalised to the line, as the profile wants them
+    for (int k = 0; k < 3; k++) {
+        limits[k] /= length > 1e-3f ? length : 1e-3f;
+    }
+    return ARM_LINE_OK;
+}
+
+arm_line_result_t arm_line_check(int shoulder_servo, int elbow_servo, float x, float z) {
+    arm_line_t line;
+    float limits[3];
+    int end_pulses[2];
+    return plan_line(&line, shoulder_servo, elbow_servo, x, z, limits, end_pulses);
+}
+
+static void line_path(float s, int pulses[], void *user_data) {
+    arm_line_step((arm_line_t *)user_data, s, pulses);
+}
+
+arm_line_result_t arm_line_move(int shoulder_servo, int elbow_servo, float x, float z,
+                                motion_profile_type_t profile, int min_duration_ms) {
+    // A free queue slot means the line in this pool slot has finished
+    if (motion_executor_free_slots() == 0) return ARM_LINE_QUEUE_FULL;
+
+    arm_line_t *line = &lines[next_line];
+    float limits[3];
+    int end_pulses[2];
+    arm_line_result_t result = plan_line(line, shoulder_servo, elbow_servo, x, z, limits, end_pulses);
+    if (result != ARM_LINE_OK) return result;
+
+    if (!motion_executor_enqueue_path(line->servo_nums, end_pulses, 2, profile, limits[0], limits[1], limits[2],
+                                      min_duration_ms, line_path, line)) {
+        return ARM_LINE_QUEUE_FULL;
+    }
+    next_line = (next_line + 1) % LINE_POOL;
+    return ARM_LINE_OK;
+}
+
+const char *arm_line_result_name(arm_line_result_t result) {
+    switch (result) {
+    case ARM_LINE_OK: return "ok";
+    case ARM_LINE_UNREACHABLE: return "unreachable on this elbow branch";
+    case ARM_LINE_SINGULAR: return "too close to full stretch";
+    case ARM_LINE_QUEUE_FULL: return "queue full";
+    }
+    return "?";
+}
+
+void arm_line_step(arm_line_t *line, float s, int pulses[2]) {
+    float x = line->x0 + line->dx * s;
+    float z = line->z0 + line->dz * s;
+
+    // The tip where last tick's joints put it: that tick's error, and this
+    // tick's Newton step from there
+    float tip_x, tip_z;
+    forward_2link(LINK1, LINK2, line->shoulder, line->elbow, &tip_x, &tip_z);
+    float error = hypotf(tip_x - line->last_x, tip_z - line->last_z);
+    if (error > max_error) max_error = error;
+
+    float shoulder_step, elbow_step;
+    calculate_2link_rates(LINK1, LINK2, line->shoulder, line->elbow, x - tip_x, z - tip_z, &shoulder_step,
+                          &elbow_step);
+    line->shoulder += shoulder_step;
+    line->elbow += elbow_step;
+    clamp_2link_joints(&line->shoulder, &line->elbow, line->elbow_up);
+    line->last_x = x;
+    line->last_z = z;
+
+    pulses[0] = angle_to_pulse_f(line->servo_nums[0], SERVO_SHOULDER_FROM_IK(line->shoulder));
+    pulses[1] = angle_to_pulse_f(line->servo_nums[1], SERVO_ELBOW_FROM_IK(line->elbow));
+}
+
+float arm_line_max_error(void) {
+    return max_error;
+}
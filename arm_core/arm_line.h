@@ -0,0 +1,87 @@
+#ifndef ARM_LINE_H
+#define ARM_LINE_H
+
+/*
+ * STRAIGHT-LINE CARTESIAN MOVES
+ *
+ * A joint-space move between two tip targets traces an arc, which can dip
+ * toward the table. A line move keeps the pointer tip on the straight line
+ * instead: the motion executor plays it as a path move (motion_executor.h),
+ * and every tick arm_line_step() solves the IK for the next point on the
+ * line with one damped Newton step warm-started from the tick before
+ * (calculate_2link_rates() on the tip error). That's a handful of float
+ * trig calls per tick, well inside MOTION_TICK_MS.
+ *
+ * Planning happens at enqueue time on core 0, from wherever the queued
+ * moves leave the shoulder and elbow:
+ *   - The whole line is sampled every ARM_LINE_CHECK_MM with the exact
+ *     2-link solution on the branch the arm is on. A line can't change
+ *     branch, so a point only the other branch reaches (or nothing
+ *     reaches) makes it ARM_LINE_UNREACHABLE.
+ *   - A point inside ARM_RATE_DAMPING_ZONE of the straight-arm singularity
+ *     makes it ARM_LINE_SINGULAR: the damping there would pull the tip off
+ *     the line. Full stretch (where ik_control starts) counts too.
+ *   - The tip speed, acceleration and jerk are capped so that no joint goes
+ *     over its motion executor limits anywhere along the line, using the
+ *     steepest pulses-per-mm between samples. Near the singularity the
+ *     joints turn fastest for a given tip speed, so lines slow down there.
+ *
+ * There's no orientation to interpolate on this arm in the 2D plane: the
+ * wrist pitch is held straight and the pointer is part of link 2.
+ */
+
+#include <stdbool.h>
+#include "motion_profile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ARM_LINE_MAX_SPEED 120.0f   // mm/s
+#define ARM_LINE_MAX_ACCEL 500.0f   // mm/s^2
+#define ARM_LINE_MAX_JERK  5000.0f  // mm/s^3
+#define ARM_LINE_CHECK_MM  2.0f     // Planning sample spacing
+
+typedef enum {
+    ARM_LINE_OK,
+    ARM_LINE_UNREACHABLE,  // Some point needs the other branch, or nothing reaches it
+    ARM_LINE_SINGULAR,     // Passes too close to full stretch
+    ARM_LINE_QUEUE_FULL,
+} arm_line_result_t;
+
+// One line move as the executor plays it. Angles are IK-frame degrees
+// (arm_ik.h), updated every tick.
+typedef struct {
+    int servo_nums[2];  // Shoulder, elbow
+    float x0, z0, dx, dz;
+    float shoulder, elbow;
+    float last_x, last_z;  // Previous tick's target, for the error check
+    bool elbow_up;
+} arm_line_t;
+
+// Checks the line from where the queued moves leave the arm to (x, z)
+// without queueing anything
+arm_line_result_t arm_line_check(int shoulder_servo, int elbow_servo, float x, float z);
+
+// Plans and queues a line to (x, z). profile shapes the speed along the
+// line (LINEAR is spaced min_duration_ms from the next move, as in
+// motion_executor_enqueue(), if the joints allow it);
+// min_duration_ms only ever slows it down. Nothing is queued unless the
+// result is ARM_LINE_OK.
+arm_line_result_t arm_line_move(int shoulder_servo, int elbow_servo, float x, float z,
+                                motion_profile_type_t profile, int min_duration_ms);
+
+const char *arm_line_result_name(arm_line_result_t result);
+
+// The per-tick step: setpoint for position s (0..1) along the line
+void arm_line_step(arm_line_t *line, float s, int pulses[2]);
+
+// Largest distance seen between a tick's target and where its solved
+// joints put the tip, in mm
+float arm_line_max_error(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
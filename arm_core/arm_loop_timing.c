@@ -0,0 +1,145 @@
+#include "arm_loop_timing.h"
+#include <stdio.h>
+#include <string.h>
+
+#define HISTOGRAM_PERIOD LOOP_STAGE_COUNT  // Extra histogram after the stages
+#define LINE_MAX 32
+
+typedef struct {
+    uint32_t buckets[LOOP_TIMING_BUCKETS];
+    uint32_t count;
+    uint32_t min_us, max_us;
+    uint64_t sum_us;
+} histogram_t;
+
+static const char *const names[LOOP_STAGE_COUNT + 1] = {
+    "adc", "ik", "boundary", "servo", "telemetry", "sleep", "period",
+};
+
+static histogram_t histograms[LOOP_STAGE_COUNT + 1];
+static uint32_t stage_us[LOOP_STAGE_COUNT];  // This pass so far
+static uint64_t pass_start_us = 0;
+static uint64_t last_mark_us = 0;
+
+static char line[LINE_MAX];
+static int line_len = 0;
+static bool input_closed = false;
+
+// Exact below 4, then 4 per octave: the top two bits after the leading one
+static int bucket_for(uint32_t us) {
+    if (us < 4) return (int)us;
+    int octave = 31 - __builtin_clz(us);
+    int index = 4 * (octave - 1) + (int)((us >> (octave - 2)) & 3);
+    return index < LOOP_TIMING_BUCKETS ? index : LOOP_TIMING_BUCKETS - 1;
+}
+
+static uint32_t bucket_floor(int index) {
+    if (index < 4) return (uint32_t)index;
+    int octave = index / 4 + 1;
+    return (uint32_t)(4 + index % 4) << (octave - 2);
+}
+
+static void record(histogram_t *h, uint32_t us) {
+    h->buckets[bucket_for(us)]++;
+    if (h->count == 0 || us < h->min_us) h->min_us = us;
+    if (us > h->max_us) h->max_us = us;
+    h->sum_us += us;
+    h->count++;
+}
+
+static uint32_t elapsed_us(uint64_t from, uint64_t to) {
+    uint64_t us = to - from;
+    return us > 0xFFFFFFFFu ? 0xFFFFFFFFu : (uint32_t)us;
+}
+
+void loop_timing_begin(void) {
+    uint64_t now = hal_time_us();
+    if (pass_start_us != 0) {
+        stage_us[LOOP_STAGE_SLEEP] += elapsed_us(last_mark_us, now);
+        for (int i = 0; i < LOOP_STAGE_COUNT; i++) {
+            record(&histograms[i], stage_us[i]);
+        }
+        record(&histograms[HISTOGRAM_PERIOD], elapsed_us(pass_start_us, now));
+    }
+    memset(stage_us, 0, sizeof(stage_us));
+    pass_start_us = now;
+    last_mark_us = now;
+}
+
+void loop_timing_mark(loop_stage_t stage) {
+    uint64_t now = hal_time_us();
+    stage_us[stage] += elapsed_us(last_mark_us, now);
+    last_mark_us = now;
+}
+
+void loop_timing_reset(void) {
+    memset(histograms, 0, sizeof(histograms));
+}
+
+// Upper edge of the bucket holding the given fraction of the samples
+static uint32_t percentile(const histogram_t *h, uint32_t per_mille) {
+    uint64_t target = ((uint64_t)h->count * per_mille + 999) / 1000;
+    uint64_t seen = 0;
+    for (int i = 0; i < LOOP_TIMING_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen >= target) {
+            uint32_t edge = i + 1 < LOOP_TIMING_BUCKETS ? bucket_floor(i + 1) - 1 : h->max_us;
+            return edge < h->max_us ? edge : h->max_us;
+        }
+    }
+    return h->max_us;
+}
+
+void loop_timing_report(void) {
+    printf("Loop timing, %lu passes (us)\n", (unsigned long)histograms[HISTOGRAM_PERIOD].count);
+    printf("%-10s %8s %8s %8s %8s %8s %10s\n", "stage", "min", "p50", "p90", "p99", "max", "mean");
+    for (int i = 0; i <= LOOP_STAGE_COUNT; i++) {
+        const histogram_t *h = &histograms[i];
+        if (h->count == 0) continue;
+        printf("%-10s %8lu %8lu %8lu %8lu %8lu %10.1f\n", names[i], (unsigned long)h->min_us,
+               (unsigned long)percentile(h, 500), (unsigned long)percentile(h, 900),
+               (unsigned long)percentile(h, 990), (unsigned long)h->max_us, (double)h->sum_us / h->count);
+    }
+
+    // Buckets as floor:count
+    for (int i = 0; i <= LOOP_STAGE_COUNT; i++) {
+        const histogram_t *h = &histograms[i];
+        if (h->count == 0) continue;
+        printf("%s:", names[i]);
+        for (int b = 0; b < LOOP_TIMING_BUCKETS; b++) {
+            if (h->buckets[b] != 0) printf(" %lu:%lu", (unsigned long)bucket_floor(b), (unsigned long)h->buckets[b]);
+        }
+        printf("\n");
+    }
+}
+
+static void handle_line(void) {
+    line[line_len] = '\0';
+    if (strcmp(line, "timing") == 0) {
+        loop_timing_report();
+    } else if (strcmp(line, "timing reset") == 0) {
+        loop_timing_reset();
+        printf("Loop timing reset\n");
+    }
+}
+
+void loop_timing_poll(void) {
+    uint8_t buf[16];
+    while (!input_closed) {
+        int n = hal_serial_read_nonblocking(buf, sizeof(buf));
+        if (n < 0) {
+            input_closed = true;
+            if (line_len > 0) handle_line();  // Last line without a newline
+        }
+        if (n <= 0) break;
+
+        for (int i = 0; i < n; i++) {
+            if (buf[i] == '\n' || buf[i] == '\r') {
+                if (line_len > 0) handle_line();
+                line_len = 0;
+            } else if (line_len < LINE_MAX - 1) {
+                line[line_len++] = (char)buf[i];
+            }
+        }
+    }
+}
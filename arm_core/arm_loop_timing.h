@@ -0,0 +1,58 @@
+#ifndef ARM_LOOP_TIMING_H
+#define ARM_LOOP_TIMING_H
+
+/*
+ * CONTROL LOOP STAGE TIMING
+ *
+ * The loop calls loop_timing_begin() at the top of each pass and
+ * loop_timing_mark(stage) at the end of each stage; the time since the
+ * previous mark is added to that stage (a stage can be marked more than
+ * once a pass). Whatever is left between the last mark and the next
+ * loop_timing_begin() is the sleep. When a pass closes, each stage's total
+ * and the begin-to-begin period go into a histogram, so the counts are
+ * per pass and a stage that didn't run counts as 0us.
+ *
+ * Histograms are log-linear: exact below 4us, then 4 buckets per power of
+ * two (within 25%), up to ~0.5s. Everything is on core 0 and costs a
+ * timer read per mark.
+ *
+ * loop_timing_poll() reads serial commands, one per line:
+ *   timing        prints min/percentiles/max/mean per stage and the
+ *                 non-empty buckets
+ *   timing reset  clears the histograms
+ * e.g. "echo timing > /dev/ttyACM0" while the loop runs. The report is
+ * plain text, so it falls between telemetry frames.
+ */
+
+#include "arm_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    LOOP_STAGE_ADC,        // Joystick reads and dead zone
+    LOOP_STAGE_IK,         // Solves and rate integration
+    LOOP_STAGE_BOUNDARY,   // Reach map checks and projection
+    LOOP_STAGE_SERVO,      // Pulse conversion and motion executor queueing
+    LOOP_STAGE_TELEMETRY,  // Reporting: telemetry records or printf
+    LOOP_STAGE_SLEEP,      // Last mark to the next pass (includes telemetry_poll while sleeping)
+    LOOP_STAGE_COUNT
+} loop_stage_t;
+
+#define LOOP_TIMING_BUCKETS 72
+
+void loop_timing_begin(void);
+void loop_timing_mark(loop_stage_t stage);
+
+// Handles "timing" commands on the serial port; call once a pass
+void loop_timing_poll(void);
+
+void loop_timing_report(void);
+void loop_timing_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
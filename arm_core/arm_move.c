@@ -0,0 +1,98 @@
+#include "arm_move.h"
+#include "arm_servo.h"
+#include <math.h>
+#include <stdlib.h>
+
+int current_positions[ARM_NUM_SERVOS];
+
+#if ARM_BOARD_AVR
+// The Nano has no timer to spare for the motion executor, so moves play
+// out here, blocking, on the same tick and profiles
+static uint slices[ARM_NUM_SERVOS];
+static uint channels[ARM_NUM_SERVOS];
+
+static void play_move(const int servo_nums[], const int pulses[], int num_servos,
+                      motion_profile_type_t profile, int duration_ms) {
+    float vel = 1e9f, accel = 1e9f, jerk = 1e9f;
+    int start[ARM_NUM_SERVOS];
+    for (int i = 0; i < num_servos; i++) {
+        start[i] = current_positions[servo_nums[i]];
+        float distance = (float)abs(pulses[i] - start[i]);
+        if (distance > 0.0f) {
+            if (MOTION_DEFAULT_MAX_VEL / distance < vel) vel = MOTION_DEFAULT_MAX_VEL / distance;
+            if (MOTION_DEFAULT_MAX_ACCEL / distance < accel) accel = MOTION_DEFAULT_MAX_ACCEL / distance;
+            if (MOTION_DEFAULT_MAX_JERK / distance < jerk) jerk = MOTION_DEFAULT_MAX_JERK / distance;
+        }
+    }
+    if (vel == 1e9f) profile = MOTION_PROFILE_LINEAR;
+
+    motion_profile_t p;
+    motion_profile_plan(&p, profile, vel, accel, jerk, duration_ms / 1000.0f);
+    int ticks = (int)ceilf(p.total * (1000.0f / MOTION_TICK_MS) - 1e-3f);
+    if (ticks < 1) ticks = 1;
+
+    uint64_t next_us = hal_time_us();
+    for (int tick = 1; tick <= ticks; tick++) {
+        float s = tick == ticks ? 1.0f : motion_profile_position(&p, tick * (MOTION_TICK_MS / 1000.0f));
+        for (int i = 0; i < num_servos; i++) {
+            int servo = servo_nums[i];
+            float delta = (pulses[i] - start[i]) * s;
+            int level = start[i] + (int)(delta >= 0.0f ? delta + 0.5f : delta - 0.5f);
+            hal_pwm_set_chan_level(slices[servo], channels[servo], level);
+        }
+        next_us += MOTION_TICK_MS * 1000;
+        hal_sleep_until_us(next_us);
+    }
+}
+#endif
+
+bool arm_servos_init(void) {
+    static const uint pins[ARM_NUM_SERVOS] = ARM_SERVO_PINS;
+    for (int i = 0; i < ARM_NUM_SERVOS; i++) {
+        hal_pwm_servo_init(pins[i]);
+        current_positions[i] = angle_to_pulse(i, 90);
+    }
+#if ARM_BOARD_AVR
+    for (int i = 0; i < ARM_NUM_SERVOS; i++) {
+        slices[i] = hal_pwm_gpio_to_slice_num(pins[i]);
+        channels[i] = hal_pwm_gpio_to_channel(pins[i]);
+    }
+    return true;
+#else
+    return motion_executor_init(pins, current_positions, ARM_NUM_SERVOS);
+#endif
+}
+
+void set_servo_angle(int servo_num, int angle) {
+    int nums[] = {servo_num};
+    float angles[] = {angle};
+    move_servos_coordinated(nums, angles, 1, MOTION_PROFILE_SCURVE, 0);
+    motion_executor_wait_idle();
+}
+
+bool move_servos_coordinated(int servo_nums[], float target_angles[], int num_servos, motion_profile_type_t profile, int duration_ms) {
+    int end_pulses[num_servos];
+    for (int i = 0; i < num_servos; i++) {
+        end_pulses[i] = angle_to_pulse_f(servo_nums[i], target_angles[i]);
+    }
+    return move_servo_pulses(servo_nums, end_pulses, num_servos, profile, duration_ms);
+}
+
+bool move_servo_pulses(const int servo_nums[], const int pulses[], int num_servos, motion_profile_type_t profile, int duration_ms) {
+#if ARM_BOARD_AVR
+    play_move(servo_nums, pulses, num_servos, profile, duration_ms);
+#else
+    bool queued = profile == MOTION_PROFILE_LINEAR
+                      ? motion_executor_enqueue(servo_nums, pulses, num_servos, duration_ms)
+                      : motion_executor_enqueue_profiled(servo_nums, pulses, num_servos, profile, duration_ms);
+    if (!queued) {
+        return false;
+    }
+#endif
+
+    // Track where the queued moves will leave each servo
+    for (int i = 0; i < num_servos; i++) {
+        current_positions[servo_nums[i]] = pulses[i];
+    }
+    return true;
+}
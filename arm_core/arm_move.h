@@ -0,0 +1,50 @@
+#ifndef ARM_MOVE_H
+#define ARM_MOVE_H
+
+/*
+ * Servo moves shared by the firmwares: servo setup, where each servo has
+ * been sent, and queueing moves on the motion executor.
+ *
+ * current_positions[] is the PWM level (Pico counts) each servo will be at
+ * once everything queued so far has played out. It is only updated when a
+ * move is accepted, so a full queue leaves it untouched.
+ *
+ * On the Nano (ARM_BOARD_AVR) there is no motion executor: the same calls
+ * play the move out before returning, on the executor's tick and profiles
+ * with its default limits.
+ */
+
+#include "arm_config.h"
+#include "motion_executor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int current_positions[ARM_NUM_SERVOS];
+
+// PWM on ARM_SERVO_PINS, every servo recorded at 90 degrees, motion
+// executor started. Nothing moves until the first move is queued.
+bool arm_servos_init(void);
+
+// S-curve single-servo move, blocks until done
+void set_servo_angle(int servo_num, int angle);
+
+// Queues the move on the motion executor and returns straight away.
+// Consecutive LINEAR moves start duration_ms apart and blend into each
+// other. A LINEAR move on its own also runs an end ramp of up to
+// MOTION_LINEAR_RAMP_MS, and from rest it can wait MOTION_LOOKAHEAD_TICKS
+// for a follower (motion_executor.h). TRAPEZOID/SCURVE moves run as fast
+// as the servo limits allow, but no faster than duration_ms. On the Nano
+// moves block instead, and LINEAR takes exactly duration_ms.
+// Returns false if the queue is full; positions are only updated on success.
+bool move_servos_coordinated(int servo_nums[], float target_angles[], int num_servos, motion_profile_type_t profile, int duration_ms);
+
+// Same, with PWM levels already worked out (e.g. sub-degree joint angles)
+bool move_servo_pulses(const int servo_nums[], const int pulses[], int num_servos, motion_profile_type_t profile, int duration_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,103 @@
+#include "arm_reach.h"
+#include "arm_reach_map.h"
+#include <math.h>
+
+// The tables stay in flash on the AVR (arm_board.h)
+#define NODE(p, i) ((int16_t)ARM_FLASH_READ_U16((const uint16_t *)&(p)[i]))
+
+#define PROJECT_STEPS 3
+#define RING_STEP_MM  1.0f
+#define RING_POINTS   24
+
+const reach_map_t arm_reach_2d = {
+    ARM_REACH_2D_X0, ARM_REACH_2D_Z0, ARM_REACH_2D_COLS, ARM_REACH_2D_ROWS, arm_reach_2d_sdf,
+};
+
+const reach_map_t arm_reach_wrist = {
+    ARM_REACH_WRIST_X0, ARM_REACH_WRIST_Z0, ARM_REACH_WRIST_COLS, ARM_REACH_WRIST_ROWS, arm_reach_wrist_sdf,
+};
+
+// Bilinear distance and gradient. Points off the grid are clamped onto its
+// edge and the distance from there added; the gradient then points outward.
+static float sample(const reach_map_t *map, float x, float z, float *gx, float *gz) {
+    float max_x = map->x0 + (map->cols - 1) * ARM_REACH_STEP;
+    float max_z = map->z0 + (map->rows - 1) * ARM_REACH_STEP;
+    float cx = x < map->x0 ? map->x0 : (x > max_x ? max_x : x);
+    float cz = z < map->z0 ? map->z0 : (z > max_z ? max_z : z);
+
+    float fx = (cx - map->x0) * (1.0f / ARM_REACH_STEP);
+    float fz = (cz - map->z0) * (1.0f / ARM_REACH_STEP);
+    int col = (int)fx;
+    int row = (int)fz;
+    if (col > map->cols - 2) col = map->cols - 2;
+    if (row > map->rows - 2) row = map->rows - 2;
+    fx -= col;
+    fz -= row;
+
+    const int16_t *p = map->sdf + row * map->cols + col;
+    float a = NODE(p, 0), b = NODE(p, 1), c = NODE(p, map->cols), d = NODE(p, map->cols + 1);
+
+    float near_row = a + (b - a) * fx;
+    float far_row = c + (d - c) * fx;
+    float dist = (near_row + (far_row - near_row) * fz) * (1.0f / ARM_REACH_SCALE);
+
+    float ox = x - cx, oz = z - cz;
+    if (ox != 0.0f || oz != 0.0f) {
+        float off = sqrtf(ox * ox + oz * oz);
+        if (gx) {
+            *gx = ox / off;
+            *gz = oz / off;
+        }
+        return dist + off;
+    }
+
+    if (gx) {
+        *gx = ((b - a) + ((d - c) - (b - a)) * fz) * (1.0f / (ARM_REACH_SCALE * ARM_REACH_STEP));
+        *gz = (far_row - near_row) * (1.0f / (ARM_REACH_SCALE * ARM_REACH_STEP));
+    }
+    return dist;
+}
+
+float reach_map_distance(const reach_map_t *map, float x, float z) {
+    return sample(map, x, z, 0, 0);
+}
+
+bool reach_map_project(const reach_map_t *map, float *x, float *z, float margin) {
+    float px = *x, pz = *z;
+    for (int i = 0; i <= PROJECT_STEPS; i++) {
+        float gx, gz;
+        float dist = sample(map, px, pz, &gx, &gz);
+        if (dist <= -margin) {
+            *x = px;
+            *z = pz;
+            return true;
+        }
+        if (i == PROJECT_STEPS) break;
+
+        // The true field has a unit gradient; renormalise the interpolated
+        // one. Aim a little past margin so interpolation error doesn't leave
+        // the point just short of it.
+        float len = sqrtf(gx * gx + gz * gz);
+        if (len < 1e-3f) break;
+        float move = (dist + 1.5f * margin) / len;
+        px -= gx / len * move;
+        pz -= gz / len * move;
+    }
+
+    // Rings around the request, nearest first
+    float start = reach_map_distance(map, *x, *z);
+    if (start < 0.0f) start = 0.0f;
+    for (float r = start + RING_STEP_MM; r <= start + ARM_REACH_SEARCH_MM; r += RING_STEP_MM) {
+        for (int k = 0; k < RING_POINTS; k++) {
+            float t = k * (6.2831853f / RING_POINTS);
+            float tx = *x + r * cosf(t);
+            float tz = *z + r * sinf(t);
+            if (reach_map_distance(map, tx, tz) <= -margin) {
+                *x = tx;
+                *z = tz;
+                return true;
+            }
+        }
+    }
+    return false;
+}
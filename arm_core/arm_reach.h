@@ -0,0 +1,61 @@
+#ifndef ARM_REACH_H
+#define ARM_REACH_H
+
+/*
+ * REACHABILITY MAPS
+ *
+ * Precomputed signed distance to the edge of the reachable workspace,
+ * taking in the servo ranges and the shoulder mount offset, not just the
+ * LINK1 + LINK2 circle. Distances are in mm, negative inside, bilinearly
+ * interpolated from a 6mm grid (tools/gen_reach_map.c, which writes
+ * arm_reach_map.h). Coordinates are in the shoulder's vertical plane:
+ *
+ *   arm_reach_2d     pointer tip (x, z), as passed to calculate_2d_ik()
+ *   arm_reach_wrist  wrist pitch axis (u, v) for calculate_arm_ik(), with
+ *                    the pointer at ARM_REACH_WRIST_PITCH
+ *
+ * A point at least ARM_REACH_MARGIN inside solves with the matching IK
+ * call. The grid rounds off the two sharp corners where the shoulder and
+ * elbow both sit at a servo limit, so within ~10mm of those the map is
+ * conservative. Away from the grid the distance is an overestimate.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ARM_REACH_MARGIN    0.5f   // mm, covers interpolation error on the boundary
+#define ARM_REACH_SEARCH_MM 24.0f  // Ring search limit for reach_map_project()
+
+typedef struct {
+    float x0, z0;  // mm, first grid node
+    int cols, rows;
+    const int16_t *sdf;  // Row-major, ARM_REACH_SCALE units per mm, ARM_FLASH
+} reach_map_t;
+
+extern const reach_map_t arm_reach_2d;
+extern const reach_map_t arm_reach_wrist;
+
+float reach_map_distance(const reach_map_t *map, float x, float z);
+
+static inline bool reach_map_contains(const reach_map_t *map, float x, float z) {
+    return reach_map_distance(map, x, z) <= -ARM_REACH_MARGIN;
+}
+
+// Moves (x, z) to the nearest point at least margin inside the reachable
+// set, leaving reachable points alone. One step along the distance
+// gradient does it almost everywhere; near a crease in the field (equally
+// far from two parts of the boundary) it takes a second or third. If that
+// still misses, as next to the sharp corners, it searches rings of growing
+// radius around (x, z) instead. Returns false if nothing is inside within
+// ARM_REACH_SEARCH_MM of where the gradient said the boundary was.
+bool reach_map_project(const reach_map_t *map, float *x, float *z, float margin);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
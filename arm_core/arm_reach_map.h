@@ -0,0 +1,214 @@
+// Generated by tools/gen_reach_map.c - do not edit
+// LINK1=114 LINK2=204 FOREARM=124, shoulder mount offset 28 deg,
+// servos 0-180, wrist map at pointer pitch 0 deg
+
+#ifndef ARM_REACH_MAP_H
+#define ARM_REACH_MAP_H
+
+#include <stdint.h>
+#include "arm_board.h"
+
+#define ARM_REACH_STEP  6      // mm between grid nodes
+#define ARM_REACH_SCALE 16     // Table units per mm
+#define ARM_REACH_WRIST_PITCH 0.0f  // Pointer pitch the wrist map is built for
+
+#define ARM_REACH_2D_X0   -270
+#define ARM_REACH_2D_Z0   -330
+#define ARM_REACH_2D_COLS 101
+#define ARM_REACH_2D_ROWS 109
+
+static const int16_t arm_reach_2d_sdf[11009] ARM_FLASH = {
+    1782, 1717, 1652, 1589, 1527, 1465, 1405, 1347, 1289, 1233, 1178, 1125, 1073, 1023, 974, 927, 881, 837, 794, 752, 712, 673, 635, 599, 564, 530, 498, 468, 438, 411, 385, 360, 337, 316, 297, 279, 262, 248, 235, 223, 214, 206, 200, 195, 193, 192, 193, 195, 200, 206, 214, 223, 235, 248, 262, 279, 297, 316, 337, 360, 385, 411, 438, 468, 498, 530, 564, 599, 635, 673, 712, 752, 794, 837, 881, 926, 973, 1021, 1069, 1119, 1170, 1222, 1276, 1330, 1385, 1441, 1498, 1555, 1614, 1674, 1734, 1795, 1857, 1920, 1983, 2048, 2113, 2178, 2245, 2311, 2379,
+    1713, 1646, 1581, 1517, 1453, 1391, 1330, 1271, 1212, 1155, 1099, 1045, 992, 941, 891, 843, 796, 751, 708, 666, 625, 585, 547, 510, 474, 440, 408, 376, 347, 319, 292, 267, 244, 222, 202, 184, 168, 153, 139, 128, 118, 110, 104, 100, 97, 96, 97, 100, 104, 110, 118, 128, 139, 153, 168, 184, 202, 222, 244, 267, 292, 319, 347, 376, 408, 440, 474, 510, 547, 585, 625, 666, 708, 751, 796, 842, 889, 938, 987, 1038, 1090, 1142, 1196, 1251, 1307, 1363, 1421, 1479, 1539, 1599, 1660, 1722, 1785, 1848, 1912, 1977, 2043, 2109, 2176, 2243, 2311,
+    1644, 1577, 1511, 1445, 1381, 1318, 1256, 1195, 1136, 1078, 1021, 966, 912, 859, 809, 759, 712, 666, 622, 579, 538, 497, 458, 421, 385, 350, 317, 285, 255, 227, 200, 175, 151, 129, 108, 90, 73, 58, 44, 33, 23, 14, 8, 4, 1, 0, 1, 4, 8, 14, 23, 33, 44, 58, 73, 90, 108, 129, 151, 175, 200, 227, 255, 285, 317, 350, 385, 421, 458, 497, 538, 579, 622, 666, 712, 759, 806, 855, 906, 957, 1009, 1063, 1117, 1173, 1229, 1286, 1345, 1404, 1464, 1525, 1587, 1649, 1712, 1777, 1841, 1907, 1973, 2040, 2108, 2176, 2245,
+    1577, 1508, 1441, 1375, 1310, 1246, 1183, 1121, 1060, 1001, 943, 887, 832, 779, 727, 677, 628, 582, 537, 493, 451, 410, 371, 332, 296, 261, 227, 195, 164, 135, 108, 82, 58, 35, 14, -5, -22, -37, -51, -63, -73, -81, -88, -92, -95, -96, -95, -92, -88, -81, -73, -63, -51, -37, -22, -5, 14, 35, 58, 82, 108, 135, 164, 195, 227, 261, 296, 332, 371, 410, 451, 493, 537, 582, 628, 675, 724, 774, 824, 876, 929, 984, 1039, 1095, 1152, 1210, 1269, 1329, 1390, 1451, 1514, 1577, 1641, 1706, 1771, 1837, 1904, 1972, 2040, 2109, 2178,
+    1510, 1441, 1373, 1305, 1239, 1174, 1110, 1047, 986, 926, 867, 809, 753, 699, 646, 595, 545, 498, 452, 408, 365, 323, 283, 244, 207, 171, 137, 104, 73, 43, 15, -11, -35, -58, -79, -99, -116, -132, -146, -158, -169, -177, -184, -188, -191, -192, -191, -188, -184, -177, -169, -158, -146, -132, -116, -99, -79, -58, -35, -11, 15, 43, 73, 104, 137, 171, 207, 244, 283, 323, 365, 408, 452, 497, 544, 592, 642, 692, 744, 796, 850, 905, 961, 1018, 1075, 1134, 1194, 1255, 1316, 1378, 1441, 1505, 1570, 1635, 1702, 1768, 1836, 1904, 1973, 2043, 2113,
+    1445, 1374, 1305, 1237, 1170, 1104, 1039, 975, 912, 851, 791, 732, 675, 620, 566, 513, 463, 414, 367, 322, 279, 236, 195, 156, 118, 82, 47, 14, -18, -48, -77, -103, -128, -152, -173, -193, -211, -227, -241, -254, -264, -273, -279, -284, -287, -288, -287, -284, -279, -273, -264, -254, -241, -227, -211, -193, -173, -152, -128, -103, -77, -48, -18, 14, 47, 82, 118, 156, 195, 236, 279, 322, 367, 413, 461, 510, 560, 611, 663, 717, 771, 827, 883, 941, 999, 1059, 1119, 1181, 1243, 1306, 1370, 1434, 1500, 1566, 1633, 1700, 1768, 1837, 1907, 1977, 2048,
+    1380, 1309, 1239, 1169, 1101, 1034, 968, 903, 839, 777, 716, 656, 598, 541, 486, 433, 381, 331, 283, 237, 193, 150, 108, 68, 30, -7, -43, -77, -109, -140, -169, -196, -221, -245, -267, -287, -305, -322, -336, -349, -360, -368, -375, -380, -383, -384, -383, -380, -375, -368, -360, -349, -336, -322, -305, -287, -267, -245, -221, -196, -169, -140, -109, -77, -43, -7, 30, 68, 108, 150, 193, 237, 283, 330, 378, 428, 478, 530, 583, 637, 693, 749, 806, 865, 924, 984, 1045, 1108, 1170, 1234, 1299, 1364, 1430, 1497, 1564, 1633, 1702, 1771, 1841, 1912, 1983,
+    1317, 1244, 1173, 1103, 1034, 965, 898, 832, 767, 704, 642, 581, 521, 464, 407, 353, 300, 249, 200, 153, 108, 64, 22, -19, -58, -96, -132, -167, -200, -231, -260, -288, -314, -338, -361, -381, -400, -416, -431, -444, -455, -464, -471, -476, -479, -480, -479, -476, -471, -464, -455, -444, -431, -416, -400, -381, -361, -338, -314, -288, -260, -231, -200, -167, -132, -96, -58, -19, 22, 64, 108, 153, 199, 247, 296, 346, 397, 450, 504, 559, 615, 672, 730, 789, 849, 910, 972, 1035, 1099, 1163, 1228, 1294, 1361, 1429, 1497, 1566, 1635, 1706, 1777, 1848, 1920,
+    1254, 1181, 1109, 1038, 967, 898, 830, 762, 696, 632, 568, 506, 446, 387, 329, 274, 219, 167, 117, 69, 23, -21, -63, -102, -146, -184, -221, -256, -290, -322, -352, -380, -407, -431, -454, -475, -494, -511, -526, -539, -551, -560, -567, -572, -575, -576, -575, -572, -567, -560, -551, -539, -526, -511, -494, -475, -454, -431, -407, -380, -352, -322, -290, -256, -221, -184, -146, -106, -65, -22, 23, 68, 116, 164, 214, 265, 317, 371, 425, 481, 538, 595, 654, 714, 775, 837, 900, 963, 1027, 1093, 1159, 1225, 1293, 1361, 1430, 1500, 1570, 1641, 1712, 1785, 1857,
+    1193, 1119, 1046, 973, 902, 832, 762, 694, 627, 561, 496, 433, 371, 311, 252, 195, 140, 87, 35, -14, -62, -107, -150, -190, -233, -273, -310, -346, -380, -412, -443, -472, -499, -524, -547, -569, -588, -606, -621, -635, -646, -655, -663, -668, -671, -672, -671, -668, -663, -655, -646, -635, -621, -606, -588, -569, -547, -524, -499, -472, -443, -412, -380, -346, -310, -273, -234, -193, -151, -107, -62, -15, 33, 82, 132, 184, 237, 291, 347, 403, 461, 520, 579, 640, 702, 764, 828, 892, 957, 1023, 1090, 1157, 1225, 1294, 1364, 1434, 1505, 1577, 1649, 1722, 1795,
+    1134, 1058, 984, 910, 838, 766, 696, 626, 558, 491, 425, 361, 298, 236, 176, 118, 61, 7, -46, -97, -146, -192, -236, -278, -317, -361, -399, -435, -470, -503, -534, -564, -591, -617, -641, -663, -666, -649, -633, -619, -608, -598, -591, -585, -582, -581, -582, -585, -591, -598, -608, -619, -633, -649, -666, -663, -641, -617, -591, -564, -534, -503, -470, -435, -399, -361, -321, -279, -236, -192, -146, -99, -50, -1, 51, 104, 158, 213, 269, 326, 385, 444, 505, 566, 629, 692, 756, 821, 887, 954, 1021, 1090, 1159, 1228, 1299, 1370, 1441, 1514, 1587, 1660, 1734,
+    1075, 999, 923, 849, 775, 702, 631, 560, 491, 422, 355, 289, 225, 162, 101, 41, -16, -73, -127, -179, -229, -276, -322, -364, -405, -446, -487, -524, -560, -593, -625, -655, -665, -639, -615, -593, -572, -554, -538, -524, -512, -502, -495, -489, -486, -485, -486, -489, -495, -502, -512, -524, -538, -554, -572, -593, -615, -639, -665, -655, -625, -593, -560, -524, -487, -448, -408, -365, -322, -276, -230, -182, -132, -81, -29, 24, 79, 135, 192, 250, 309, 370, 431, 493, 556, 621, 686, 751, 818, 886, 954, 1023, 1093, 1163, 1234, 1306, 1378, 1451, 1525, 1599, 1674,
+    1018, 941, 864, 789, 714, 640, 567, 495, 424, 355, 287, 219, 154, 90, 27, -34, -93, -151, -206, -260, -311, -360, -407, -451, -492, -531, -575, -613, -649, -665, -633, -602, -573, -547, -522, -499, -478, -460, -443, -429, -417, -407, -399, -393, -390, -389, -390, -393, -399, -407, -417, -429, -443, -460, -478, -499, -522, -547, -573, -602, -633, -665, -649, -613, -575, -535, -494, -451, -407, -361, -313, -264, -214, -162, -109, -55, 1, 58, 116, 175, 235, 296, 358, 421, 485, 550, 616, 682, 750, 818, 887, 957, 1027, 1099, 1170, 1243, 1316, 1390, 1464, 1539, 1614,
+    962, 884, 806, 730, 654, 579, 505, 432, 360, 289, 219, 151, 84, 18, -46, -108, -169, -228, -285, -340, -392, -443, -491, -536, -579, -619, -661, -648, -611, -576, -542, -511, -482, -454, -429, -406, -384, -365, -349, -334, -321, -311, -303, -297, -294, -293, -294, -297, -303, -311, -321, -334, -349, -365, -384, -406, -429, -454, -482, -511, -542, -576, -611, -648, -663, -622, -580, -536, -491, -444, -396, -346, -295, -242, -188, -133, -77, -19, 40, 100, 160, 222, 285, 349, 414, 480, 547, 614, 682, 751, 821, 892, 963, 1035, 1108, 1181, 1255, 1329, 1404, 1479, 1555,
+    908, 829, 750, 672, 595, 519, 444, 369, 296, 224, 153, 83, 15, -52, -117, -181, -243, -304, -362, -419, -473, -525, -574, -621, -665, -640, -599, -560, -522, -486, -452, -420, -390, -362, -336, -312, -291, -271, -254, -239, -226, -216, -207, -202, -198, -197, -198, -202, -207, -216, -226, -239, -254, -271, -291, -312, -336, -362, -390, -420, -452, -486, -522, -560, -599, -640, -666, -621, -575, -527, -478, -427, -375, -322, -267, -211, -154, -95, -35, 25, 87, 150, 214, 279, 344, 411, 478, 547, 616, 686, 756, 828, 900, 972, 1045, 1119, 1194, 1269, 1345, 1421, 1498,
+    855, 775, 695, 616, 538, 461, 384, 309, 234, 161, 88, 17, -52, -121, -188, -253, -317, -379, -439, -496, -552, -606, -657, -643, -598, -554, -512, -472, -433, -397, -362, -329, -299, -270, -243, -219, -197, -177, -159, -144, -131, -120, -112, -106, -102, -101, -102, -106, -112, -120, -131, -144, -159, -177, -197, -219, -243, -270, -299, -329, -362, -397, -433, -472, -512, -554, -598, -643, -658, -610, -560, -508, -455, -401, -345, -288, -230, -170, -110, -48, 14, 78, 143, 209, 275, 343, 411, 480, 550, 621, 692, 764, 837, 910, 984, 1059, 1134, 1210, 1286, 1363, 1441,
+    804, 723, 642, 562, 483, 404, 326, 250, 174, 99, 25, -47, -118, -188, -257, -323, -389, -452, -514, -573, -631, -657, -608, -560, -513, -469, -426, -384, -345, -308, -272, -239, -207, -178, -151, -126, -103, -83, -65, -49, -36, -25, -16, -10, -6, -5, -6, -10, -16, -25, -36, -49, -65, -83, -103, -126, -151, -178, -207, -239, -272, -308, -345, -384, -426, -469, -513, -560, -608, -657, -641, -588, -534, -479, -422, -364, -305, -245, -184, -121, -57, 7, 73, 139, 207, 275, 344, 414, 485, 556, 629, 702, 775, 849, 924, 999, 1075, 1152, 1229, 1307, 1385,
+    755, 672, 590, 509, 429, 349, 270, 192, 115, 39, -36, -110, -183, -254, -324, -392, -459, -524, -587, -649, -628, -576, -525, -476, -429, -383, -340, -297, -257, -219, -183, -149, -116, -86, -59, -33, -10, 11, 30, 46, 60, 71, 80, 86, 90, 91, 90, 86, 80, 71, 60, 46, 30, 11, -10, -33, -59, -87, -116, -149, -183, -219, -257, -297, -340, -383, -429, -476, -525, -572, -625, -668, -613, -557, -499, -440, -380, -319, -256, -193, -128, -63, 4, 71, 139, 209, 279, 349, 421, 493, 566, 640, 714, 789, 865, 941, 1018, 1095, 1173, 1251, 1330,
+    707, 623, 540, 458, 377, 296, 216, 136, 58, -19, -96, -171, -245, -318, -390, -460, -528, -595, -658, -602, -548, -495, -443, -393, -345, -299, -254, -211, -170, -131, -94, -59, -26, 5, 33, 60, 84, 105, 124, 141, 155, 166, 175, 182, 186, 187, 186, 182, 175, 166, 155, 141, 124, 105, 84, 60, 33, 5, -26, -59, -94, -131, -170, -211, -254, -299, -345, -393, -443, -491, -548, -602, -658, -634, -575, -515, -454, -392, -328, -264, -199, -132, -65, 4, 73, 143, 214, 285, 358, 431, 505, 579, 654, 730, 806, 883, 961, 1039, 1117, 1196, 1276,
+    661, 576, 492, 409, 326, 244, 163, 83, 3, -76, -154, -230, -306, -380, -453, -525, -595, -639, -581, -524, -469, -415, -362, -311, -262, -214, -169, -125, -83, -43, -5, 31, 65, 96, 125, 152, 177, 199, 218, 235, 250, 262, 271, 278, 282, 283, 282, 278, 271, 262, 250, 235, 218, 199, 177, 152, 125, 96, 65, 31, -5, -43, -83, -125, -169, -214, -262, -311, -358, -415, -469, -524, -581, -639, -650, -589, -527, -464, -400, -334, -268, -200, -132, -63, 7, 78, 150, 222, 296, 370, 444, 520, 595, 672, 749, 827, 905, 984, 1063, 1142, 1222,
+    616, 531, 446, 362, 278, 195, 112, 31, -50, -130, -210, -288, -365, -441, -516, -589, -624, -564, -505, -447, -390, -335, -281, -230, -179, -131, -84, -39, 4, 45, 84, 120, 155, 187, 217, 245, 270, 292, 313, 330, 345, 357, 367, 374, 378, 379, 378, 374, 367, 357, 345, 330, 313, 292, 270, 245, 217, 187, 155, 120, 84, 45, 4, -39, -84, -131, -179, -229, -281, -335, -390, -447, -505, -564, -624, -663, -600, -535, -470, -404, -336, -268, -199, -128, -57, 14, 87, 160, 235, 309, 385, 461, 538, 615, 693, 771, 850, 929, 1009, 1090, 1170,
+    574, 488, 402, 316, 232, 147, 64, -19, -102, -183, -264, -343, -422, -499, -576, -614, -551, -489, -429, -370, -312, -256, -202, -149, -97, -48, 0, 46, 90, 132, 172, 209, 245, 278, 309, 337, 363, 386, 407, 425, 440, 453, 462, 469, 474, 475, 474, 469, 462, 453, 440, 425, 407, 386, 363, 337, 309, 278, 245, 209, 172, 132, 90, 46, 0, -48, -97, -145, -202, -256, -312, -370, -429, -489, -551, -614, -671, -606, -539, -472, -404, -334, -264, -193, -121, -48, 25, 100, 175, 250, 326, 403, 481, 559, 637, 717, 796, 876, 957, 1038, 1119,
+    534, 446, 359, 273, 187, 102, 17, -67, -151, -233, -315, -396, -477, -556, -608, -542, -478, -416, -354, -294, -235, -178, -122, -68, -16, 35, 84, 130, 175, 218, 259, 298, 334, 368, 400, 429, 455, 479, 501, 519, 535, 548, 558, 565, 570, 571, 570, 565, 558, 548, 535, 519, 501, 479, 455, 429, 400, 368, 334, 298, 259, 218, 175, 130, 84, 35, -16, -68, -122, -178, -235, -294, -354, -416, -478, -542, -608, -674, -608, -539, -470, -400, -328, -256, -184, -110, -35, 40, 116, 192, 269, 347, 425, 504, 583, 663, 744, 824, 906, 987, 1069,
+    495, 407, 319, 232, 145, 58, -28, -113, -198, -282, -365, -447, -529, -605, -538, -472, -407, -343, -280, -219, -159, -101, -44, 11, 65, 116, 166, 214, 260, 304, 346, 386, 423, 458, 491, 521, 548, 573, 594, 614, 630, 643, 654, 661, 666, 667, 666, 661, 654, 643, 630, 614, 594, 573, 548, 521, 491, 458, 423, 386, 346, 304, 260, 214, 166, 116, 65, 11, -44, -101, -159, -219, -280, -343, -407, -472, -538, -605, -674, -606, -535, -464, -392, -319, -245, -170, -95, -19, 58, 135, 213, 291, 371, 450, 530, 611, 692, 774, 855, 938, 1021,
+    459, 370, 281, 193, 105, 17, -70, -156, -242, -328, -412, -496, -579, -538, -470, -402, -336, -271, -207, -145, -84, -25, 33, 90, 145, 197, 249, 298, 345, 390, 433, 474, 512, 548, 581, 612, 640, 666, 688, 708, 725, 738, 749, 757, 762, 763, 762, 757, 749, 738, 725, 708, 688, 666, 640, 612, 581, 548, 512, 474, 433, 390, 345, 298, 249, 197, 145, 90, 33, -25, -84, -145, -207, -271, -336, -402, -470, -538, -608, -671, -600, -527, -454, -380, -305, -230, -154, -77, 1, 79, 158, 237, 317, 397, 478, 560, 642, 724, 806, 889, 973,
+    425, 335, 245, 156, 67, -21, -110, -197, -284, -371, -457, -542, -542, -472, -402, -334, -267, -200, -136, -72, -10, 51, 110, 168, 224, 278, 330, 380, 429, 475, 519, 561, 600, 637, 672, 703, 732, 758, 782, 802, 819, 834, 845, 853, 857, 859, 857, 853, 845, 834, 819, 802, 782, 758, 732, 703, 672, 637, 600, 561, 519, 475, 429, 380, 330, 278, 224, 168, 110, 51, -10, -72, -136, -200, -267, -334, -402, -472, -542, -614, -663, -589, -515, -440, -364, -288, -211, -133, -55, 24, 104, 184, 265, 346, 428, 510, 592, 675, 759, 842, 926,
+    393, 302, 212, 122, 32, -58, -147, -236, -324, -412, -499, -551, -478, -407, -336, -267, -198, -131, -65, 0, 63, 125, 186, 245, 302, 357, 411, 462, 512, 559, 605, 648, 688, 726, 762, 794, 824, 851, 875, 896, 914, 929, 940, 948, 953, 955, 953, 948, 940, 929, 914, 896, 875, 851, 824, 794, 762, 726, 688, 648, 605, 559, 512, 462, 411, 357, 302, 245, 186, 125, 63, 0, -65, -131, -198, -267, -336, -407, -478, -551, -624, -650, -575, -499, -422, -345, -267, -188, -109, -29, 51, 132, 214, 296, 378, 461, 544, 628, 712, 796, 881,
+    363, 272, 181, 90, -1, -92, -182, -272, -361, -450, -538, -489, -416, -343, -271, -200, -131, -62, 5, 71, 136, 199, 260, 321, 379, 436, 491, 544, 594, 643, 690, 734, 775, 815, 851, 885, 916, 944, 968, 990, 1009, 1024, 1036, 1044, 1049, 1051, 1049, 1044, 1036, 1024, 1009, 990, 968, 944, 916, 885, 851, 815, 775, 734, 690, 643, 594, 544, 491, 436, 379, 321, 260, 199, 136, 71, 5, -62, -131, -200, -271, -343, -416, -489, -564, -639, -634, -557, -479, -401, -322, -242, -162, -81, -1, 82, 164, 247, 330, 413, 497, 582, 666, 751, 837,
+    336, 244, 152, 60, -32, -123, -214, -305, -395, -485, -505, -429, -354, -280, -207, -136, -65, 5, 73, 141, 207, 271, 334, 396, 455, 513, 570, 624, 676, 726, 774, 819, 862, 903, 940, 975, 1007, 1036, 1061, 1084, 1103, 1119, 1131, 1140, 1145, 1147, 1145, 1140, 1131, 1119, 1103, 1084, 1061, 1036, 1007, 975, 940, 903, 862, 819, 774, 726, 676, 624, 570, 513, 455, 396, 334, 271, 207, 141, 73, 5, -65, -136, -207, -280, -354, -429, -505, -581, -658, -613, -534, -455, -375, -295, -214, -132, -50, 33, 116, 199, 283, 367, 452, 537, 622, 708, 794,
+    311, 218, 125, 33, -60, -152, -244, -335, -427, -518, -447, -370, -294, -219, -145, -72, 0, 71, 141, 209, 276, 342, 407, 469, 531, 590, 648, 703, 757, 808, 857, 904, 948, 990, 1029, 1065, 1098, 1128, 1154, 1177, 1197, 1214, 1227, 1236, 1241, 1243, 1241, 1236, 1227, 1214, 1197, 1177, 1154, 1128, 1098, 1065, 1029, 990, 948, 904, 857, 808, 757, 703, 648, 590, 531, 469, 407, 342, 276, 209, 141, 71, 0, -72, -145, -219, -294, -370, -447, -524, -602, -668, -588, -508, -427, -346, -264, -182, -99, -15, 68, 153, 237, 322, 408, 493, 579, 666, 752,
+    289, 195, 102, 8, -85, -178, -270, -363, -455, -469, -390, -312, -235, -159, -84, -10, 63, 136, 207, 276, 345, 412, 478, 542, 605, 666, 725, 782, 837, 890, 940, 988, 1034, 1077, 1117, 1154, 1188, 1219, 1247, 1271, 1292, 1309, 1322, 1331, 1337, 1339, 1337, 1331, 1322, 1309, 1292, 1271, 1247, 1219, 1188, 1154, 1117, 1077, 1034, 988, 940, 890, 837, 782, 725, 666, 605, 542, 478, 412, 345, 276, 207, 136, 63, -10, -84, -159, -235, -312, -390, -469, -548, -628, -641, -560, -478, -396, -313, -230, -146, -62, 23, 108, 193, 279, 365, 451, 538, 625, 712,
+    268, 174, 80, -13, -107, -201, -294, -387, -481, -415, -335, -256, -178, -101, -25, 51, 125, 199, 271, 342, 412, 481, 548, 614, 678, 740, 800, 859, 916, 970, 1022, 1072, 1119, 1163, 1205, 1243, 1278, 1310, 1339, 1364, 1386, 1403, 1417, 1427, 1433, 1435, 1433, 1427, 1417, 1403, 1386, 1364, 1339, 1310, 1278, 1243, 1205, 1163, 1119, 1072, 1022, 970, 916, 859, 800, 740, 678, 614, 548, 481, 412, 342, 271, 199, 125, 51, -25, -101, -178, -256, -335, -415, -495, -576, -657, -610, -527, -444, -361, -276, -192, -107, -22, 64, 150, 236, 323, 410, 497, 585, 673,
+    251, 156, 62, -33, -127, -221, -315, -409, -443, -362, -281, -202, -122, -44, 33, 110, 186, 260, 334, 407, 478, 548, 616, 684, 749, 813, 875, 935, 993, 1049, 1103, 1154, 1203, 1249, 1292, 1331, 1368, 1401, 1431, 1457, 1480, 1498, 1512, 1523, 1529, 1531, 1529, 1523, 1512, 1498, 1480, 1457, 1431, 1401, 1368, 1331, 1292, 1249, 1203, 1154, 1103, 1049, 993, 935, 875, 813, 749, 684, 616, 548, 478, 407, 334, 260, 186, 110, 33, -44, -122, -202, -281, -362, -443, -525, -608, -658, -575, -491, -407, -322, -236, -151, -65, 22, 108, 195, 283, 371, 458, 547, 635,
+    236, 141, 46, -49, -144, -238, -333, -428, -393, -311, -230, -149, -68, 11, 90, 168, 245, 321, 396, 469, 542, 614, 684, 752, 819, 885, 948, 1010, 1070, 1128, 1183, 1236, 1286, 1333, 1378, 1419, 1457, 1492, 1523, 1550, 1573, 1592, 1608, 1618, 1625, 1627, 1625, 1618, 1608, 1592, 1573, 1550, 1523, 1492, 1457, 1419, 1378, 1333, 1286, 1236, 1183, 1128, 1070, 1010, 948, 885, 819, 752, 684, 614, 542, 469, 396, 321, 245, 168, 90, 11, -68, -149, -230, -311, -393, -476, -560, -643, -621, -536, -451, -365, -279, -193, -106, -19, 68, 156, 244, 332, 421, 510, 599,
+    223, 128, 33, -63, -158, -253, -348, -429, -345, -262, -179, -97, -16, 65, 145, 224, 302, 379, 455, 531, 605, 678, 749, 819, 888, 955, 1020, 1084, 1145, 1205, 1262, 1316, 1368, 1417, 1463, 1506, 1546, 1582, 1614, 1642, 1667, 1687, 1703, 1714, 1721, 1723, 1721, 1714, 1703, 1687, 1667, 1642, 1614, 1582, 1546, 1506, 1463, 1417, 1368, 1316, 1262, 1205, 1145, 1084, 1020, 955, 888, 819, 749, 678, 605, 531, 455, 379, 302, 224, 145, 65, -16, -97, -179, -262, -345, -429, -513, -598, -666, -580, -494, -408, -321, -234, -146, -58, 30, 118, 207, 296, 385, 474, 564,
+    213, 118, 22, -73, -169, -264, -360, -383, -299, -214, -131, -48, 35, 116, 197, 278, 357, 436, 513, 590, 666, 740, 813, 885, 955, 1024, 1091, 1156, 1219, 1280, 1339, 1395, 1449, 1500, 1548, 1592, 1634, 1671, 1705, 1735, 1760, 1781, 1798, 1809, 1817, 1819, 1817, 1809, 1798, 1781, 1760, 1735, 1705, 1671, 1634, 1592, 1548, 1500, 1449, 1395, 1339, 1280, 1219, 1156, 1091, 1024, 955, 885, 813, 740, 666, 590, 513, 436, 357, 278, 197, 116, 35, -48, -131, -214, -299, -383, -469, -554, -640, -622, -535, -448, -361, -273, -184, -96, -7, 82, 171, 261, 350, 440, 530,
+    206, 110, 15, -81, -177, -273, -368, -340, -254, -169, -84, 0, 84, 166, 249, 330, 411, 491, 570, 648, 725, 800, 875, 948, 1020, 1091, 1160, 1227, 1292, 1354, 1415, 1473, 1529, 1582, 1631, 1678, 1721, 1760, 1795, 1826, 1853, 1875, 1892, 1905, 1913, 1915, 1913, 1905, 1892, 1875, 1853, 1826, 1795, 1760, 1721, 1678, 1631, 1582, 1529, 1473, 1415, 1354, 1292, 1227, 1160, 1091, 1020, 948, 875, 800, 725, 648, 570, 491, 411, 330, 249, 166, 84, 0, -84, -169, -254, -340, -426, -512, -599, -663, -575, -487, -399, -310, -221, -132, -43, 47, 137, 227, 317, 408, 498,
+    202, 106, 10, -86, -182, -278, -374, -297, -211, -125, -39, 46, 130, 214, 298, 380, 462, 544, 624, 703, 782, 859, 935, 1010, 1084, 1156, 1227, 1295, 1362, 1427, 1490, 1550, 1608, 1662, 1714, 1762, 1807, 1848, 1885, 1918, 1946, 1969, 1987, 2000, 2008, 2011, 2008, 2000, 1987, 1969, 1946, 1918, 1885, 1848, 1807, 1762, 1714, 1662, 1608, 1550, 1490, 1427, 1362, 1295, 1227, 1156, 1084, 1010, 935, 859, 782, 703, 624, 544, 462, 380, 298, 214, 130, 46, -39, -125, -211, -297, -384, -472, -560, -648, -613, -524, -435, -346, -256, -167, -77, 14, 104, 195, 285, 376, 468,
+    200, 104, 8, -88, -184, -280, -345, -257, -170, -83, 4, 90, 175, 260, 345, 429, 512, 594, 676, 757, 837, 916, 993, 1070, 1145, 1219, 1292, 1362, 1431, 1498, 1563, 1625, 1685, 1741, 1795, 1846, 1892, 1935, 1974, 2008, 2038, 2063, 2082, 2096, 2104, 2107, 2104, 2096, 2082, 2063, 2038, 2008, 1974, 1935, 1892, 1846, 1795, 1741, 1685, 1625, 1563, 1498, 1431, 1362, 1292, 1219, 1145, 1070, 993, 916, 837, 757, 676, 594, 512, 429, 345, 260, 175, 90, 4, -83, -170, -257, -345, -433, -522, -611, -649, -560, -470, -380, -290, -200, -109, -18, 73, 164, 255, 347, 438,
+    200, 105, 9, -87, -183, -279, -308, -219, -131, -43, 45, 132, 218, 304, 390, 475, 559, 643, 726, 808, 890, 970, 1049, 1128, 1205, 1280, 1354, 1427, 1498, 1567, 1634, 1698, 1760, 1819, 1875, 1928, 1977, 2022, 2063, 2099, 2130, 2156, 2176, 2191, 2200, 2203, 2200, 2191, 2176, 2156, 2130, 2099, 2063, 2022, 1977, 1928, 1875, 1819, 1760, 1698, 1634, 1567, 1498, 1427, 1354, 1280, 1205, 1128, 1049, 970, 890, 808, 726, 643, 559, 475, 390, 304, 218, 132, 45, -43, -131, -219, -308, -397, -486, -576, -665, -593, -503, -412, -322, -231, -140, -48, 43, 135, 227, 319, 411,
+    204, 108, 12, -84, -180, -275, -272, -183, -94, -5, 84, 172, 259, 346, 433, 519, 605, 690, 774, 857, 940, 1022, 1103, 1183, 1262, 1339, 1415, 1490, 1563, 1634, 1703, 1769, 1834, 1895, 1953, 2008, 2060, 2107, 2150, 2188, 2221, 2249, 2271, 2286, 2296, 2299, 2296, 2286, 2271, 2249, 2221, 2188, 2150, 2107, 2060, 2008, 1953, 1895, 1834, 1769, 1703, 1634, 1563, 1490, 1415, 1339, 1262, 1183, 1103, 1022, 940, 857, 774, 690, 605, 519, 433, 346, 259, 172, 84, -5, -94, -183, -272, -362, -452, -542, -633, -625, -534, -443, -352, -260, -169, -77, 15, 108, 200, 292, 385,
+    210, 114, 19, -77, -173, -268, -239, -149, -59, 31, 120, 209, 298, 386, 474, 561, 648, 734, 819, 904, 988, 1072, 1154, 1236, 1316, 1395, 1473, 1550, 1625, 1698, 1769, 1838, 1905, 1969, 2030, 2087, 2141, 2191, 2236, 2277, 2312, 2341, 2365, 2381, 2392, 2395, 2392, 2381, 2365, 2341, 2312, 2277, 2236, 2191, 2141, 2087, 2030, 1969, 1905, 1838, 1769, 1698, 1625, 1550, 1473, 1395, 1316, 1236, 1154, 1072, 988, 904, 819, 734, 648, 561, 474, 386, 298, 209, 120, 31, -59, -149, -239, -329, -420, -511, -602, -655, -564, -472, -380, -288, -196, -103, -11, 82, 175, 267, 360,
+    219, 123, 28, -68, -163, -258, -207, -116, -26, 65, 155, 245, 334, 423, 512, 600, 688, 775, 862, 948, 1034, 1119, 1203, 1286, 1368, 1449, 1529, 1608, 1685, 1760, 1834, 1905, 1974, 2041, 2104, 2165, 2221, 2274, 2322, 2365, 2402, 2433, 2458, 2476, 2487, 2491, 2487, 2476, 2458, 2433, 2402, 2365, 2322, 2274, 2221, 2165, 2104, 2041, 1974, 1905, 1834, 1760, 1685, 1608, 1529, 1449, 1368, 1286, 1203, 1119, 1034, 948, 862, 775, 688, 600, 512, 423, 334, 245, 155, 65, -26, -116, -207, -299, -390, -482, -573, -665, -591, -499, -407, -314, -221, -128, -35, 58, 151, 244, 337,
+    230, 135, 40, -55, -150, -245, -178, -87, 5, 96, 187, 278, 368, 458, 548, 637, 726, 815, 903, 990, 1077, 1163, 1249, 1333, 1417, 1500, 1582, 1662, 1741, 1819, 1895, 1969, 2041, 2110, 2176, 2240, 2299, 2355, 2405, 2451, 2491, 2525, 2552, 2571, 2583, 2587, 2583, 2571, 2552, 2525, 2491, 2451, 2405, 2355, 2299, 2240, 2176, 2110, 2041, 1969, 1895, 1819, 1741, 1662, 1582, 1500, 1417, 1333, 1249, 1163, 1077, 990, 903, 815, 726, 637, 548, 458, 368, 278, 187, 96, 5, -86, -178, -270, -362, -454, -547, -639, -617, -524, -431, -338, -245, -152, -58, 35, 129, 222, 316,
+    244, 149, 54, -40, -135, -229, -151, -59, 33, 125, 217, 309, 400, 491, 581, 672, 762, 851, 940, 1029, 1117, 1205, 1292, 1378, 1463, 1548, 1631, 1714, 1795, 1875, 1953, 2030, 2104, 2176, 2246, 2312, 2375, 2433, 2487, 2536, 2579, 2615, 2645, 2666, 2679, 2683, 2679, 2666, 2645, 2615, 2579, 2536, 2487, 2433, 2375, 2312, 2246, 2176, 2104, 2030, 1953, 1875, 1795, 1714, 1631, 1548, 1463, 1378, 1292, 1205, 1117, 1029, 940, 851, 762, 672, 581, 491, 400, 309, 217, 125, 33, -59, -151, -243, -336, -429, -522, -615, -641, -547, -454, -361, -267, -173, -79, 14, 108, 202, 297,
+    260, 166, 72, -22, -116, -210, -126, -33, 60, 152, 245, 337, 429, 521, 612, 703, 794, 885, 975, 1065, 1154, 1243, 1331, 1419, 1506, 1592, 1678, 1762, 1846, 1928, 2008, 2087, 2165, 2240, 2312, 2381, 2448, 2510, 2567, 2620, 2666, 2705, 2737, 2760, 2774, 2779, 2774, 2760, 2737, 2705, 2666, 2620, 2567, 2510, 2448, 2381, 2312, 2240, 2165, 2087, 2008, 1928, 1846, 1762, 1678, 1592, 1506, 1419, 1331, 1243, 1154, 1065, 975, 885, 794, 703, 612, 521, 429, 337, 245, 152, 60, -33, -126, -219, -312, -406, -499, -593, -663, -569, -475, -381, -287, -193, -99, -5, 90, 184, 279,
+    279, 185, 92, -2, -95, -188, -103, -10, 84, 177, 270, 363, 455, 548, 640, 732, 824, 916, 1007, 1098, 1188, 1278, 1368, 1457, 1546, 1634, 1721, 1807, 1892, 1977, 2060, 2141, 2221, 2299, 2375, 2448, 2517, 2583, 2645, 2701, 2751, 2794, 2828, 2854, 2870, 2875, 2870, 2854, 2828, 2794, 2751, 2701, 2645, 2583, 2517, 2448, 2375, 2299, 2221, 2141, 2060, 1977, 1892, 1807, 1721, 1634, 1546, 1457, 1368, 1278, 1188, 1098, 1007, 916, 824, 732, 640, 548, 455, 363, 270, 177, 84, -10, -103, -197, -291, -384, -478, -572, -666, -588, -494, -400, -305, -211, -116, -22, 73, 168, 262,
+    301, 207, 114, 22, -71, -164, -83, 11, 105, 199, 292, 386, 479, 573, 666, 758, 851, 944, 1036, 1128, 1219, 1310, 1401, 1492, 1582, 1671, 1760, 1848, 1935, 2022, 2107, 2191, 2274, 2355, 2433, 2510, 2583, 2653, 2719, 2779, 2833, 2880, 2919, 2947, 2965, 2971, 2965, 2947, 2919, 2880, 2833, 2779, 2719, 2653, 2583, 2510, 2433, 2355, 2274, 2191, 2107, 2022, 1935, 1848, 1760, 1671, 1582, 1492, 1401, 1310, 1219, 1128, 1036, 944, 851, 758, 666, 573, 479, 386, 292, 199, 105, 11, -83, -177, -271, -365, -460, -554, -649, -606, -511, -416, -322, -227, -132, -37, 58, 153, 248,
+    325, 232, 140, 47, -44, -136, -65, 30, 124, 218, 313, 407, 501, 594, 688, 782, 875, 968, 1061, 1154, 1247, 1339, 1431, 1523, 1614, 1705, 1795, 1885, 1974, 2063, 2150, 2236, 2322, 2405, 2487, 2567, 2645, 2719, 2789, 2854, 2913, 2965, 3008, 3040, 3060, 3067, 3060, 3040, 3008, 2965, 2913, 2854, 2789, 2719, 2645, 2567, 2487, 2405, 2322, 2236, 2150, 2063, 1974, 1885, 1795, 1705, 1614, 1523, 1431, 1339, 1247, 1154, 1061, 968, 875, 782, 688, 594, 501, 407, 313, 218, 124, 30, -65, -159, -254, -349, -443, -538, -633, -621, -526, -431, -336, -241, -146, -51, 44, 139, 235,
+    351, 259, 167, 76, -15, -106, -49, 46, 141, 235, 330, 425, 519, 614, 708, 802, 896, 990, 1084, 1177, 1271, 1364, 1457, 1550, 1642, 1735, 1826, 1918, 2008, 2099, 2188, 2277, 2365, 2451, 2536, 2620, 2701, 2779, 2854, 2924, 2989, 3047, 3095, 3132, 3155, 3163, 3155, 3132, 3095, 3047, 2989, 2924, 2854, 2779, 2701, 2620, 2536, 2451, 2365, 2277, 2188, 2099, 2008, 1918, 1826, 1735, 1642, 1550, 1457, 1364, 1271, 1177, 1084, 990, 896, 802, 708, 614, 519, 425, 330, 235, 141, 46, -49, -144, -239, -334, -429, -524, -619, -635, -539, -444, -349, -254, -158, -63, 33, 128, 223,
+    380, 288, 197, 107, 17, -73, -36, 60, 155, 250, 345, 440, 535, 630, 725, 819, 914, 1009, 1103, 1197, 1292, 1386, 1480, 1573, 1667, 1760, 1853, 1946, 2038, 2130, 2221, 2312, 2402, 2491, 2579, 2666, 2751, 2833, 2913, 2989, 3060, 3124, 3179, 3222, 3250, 3259, 3250, 3222, 3179, 3124, 3060, 2989, 2913, 2833, 2751, 2666, 2579, 2491, 2402, 2312, 2221, 2130, 2038, 1946, 1853, 1760, 1667, 1573, 1480, 1386, 1292, 1197, 1103, 1009, 914, 819, 725, 630, 535, 440, 345, 250, 155, 60, -36, -131, -226, -321, -417, -512, -608, -646, -551, -455, -360, -264, -169, -73, 23, 118, 214,
+    410, 320, 230, 140, 51, -38, -25, 71, 166, 262, 357, 453, 548, 643, 738, 834, 929, 1024, 1119, 1214, 1309, 1403, 1498, 1592, 1687, 1781, 1875, 1969, 2063, 2156, 2249, 2341, 2433, 2525, 2615, 2705, 2794, 2880, 2965, 3047, 3124, 3196, 3259, 3310, 3343, 3355, 3343, 3310, 3259, 3196, 3124, 3047, 2965, 2880, 2794, 2705, 2615, 2525, 2433, 2341, 2249, 2156, 2063, 1969, 1875, 1781, 1687, 1592, 1498, 1403, 1309, 1214, 1119, 1024, 929, 834, 738, 643, 548, 453, 357, 262, 166, 71, -25, -120, -216, -311, -407, -502, -598, -655, -560, -464, -368, -273, -177, -81, 14, 110, 206,
+    444, 354, 265, 176, 88, 0, -16, 80, 175, 271, 367, 462, 558, 654, 749, 845, 940, 1036, 1131, 1227, 1322, 1417, 1512, 1608, 1703, 1798, 1892, 1987, 2082, 2176, 2271, 2365, 2458, 2552, 2645, 2737, 2828, 2919, 3008, 3095, 3179, 3259, 3332, 3393, 3435, 3451, 3435, 3393, 3332, 3259, 3179, 3095, 3008, 2919, 2828, 2737, 2645, 2552, 2458, 2365, 2271, 2176, 2082, 1987, 1892, 1798, 1703, 1608, 1512, 1417, 1322, 1227, 1131, 1036, 940, 845, 749, 654, 558, 462, 367, 271, 175, 80, -16, -112, -207, -303, -399, -495, -591, -663, -567, -471, -375, -279, -184, -88, 8, 104, 200,
+    479, 390, 302, 214, 127, 40, -10, 86, 182, 278, 374, 469, 565, 661, 757, 853, 948, 1044, 1140, 1236, 1331, 1427, 1523, 1618, 1714, 1809, 1905, 2000, 2096, 2191, 2286, 2381, 2476, 2571, 2666, 2760, 2854, 2947, 3040, 3132, 3222, 3310, 3393, 3468, 3524, 3547, 3524, 3468, 3393, 3310, 3222, 3132, 3040, 2947, 2854, 2760, 2666, 2571, 2476, 2381, 2286, 2191, 2096, 2000, 1905, 1809, 1714, 1618, 1523, 1427, 1331, 1236, 1140, 1044, 948, 853, 757, 661, 565, 469, 374, 278, 182, 86, -10, -106, -202, -297, -393, -489, -585, -668, -572, -476, -380, -284, -188, -92, 4, 100, 195,
+    516, 429, 341, 254, 168, 82, -3, 90, 186, 282, 378, 474, 570, 666, 762, 857, 953, 1049, 1145, 1241, 1337, 1433, 1529, 1625, 1721, 1817, 1913, 2008, 2104, 2200, 2296, 2392, 2487, 2583, 2679, 2774, 2870, 2965, 3060, 3155, 3250, 3343, 3435, 3524, 3603, 3643, 3603, 3524, 3435, 3343, 3250, 3155, 3060, 2965, 2870, 2774, 2679, 2583, 2487, 2392, 2296, 2200, 2104, 2008, 1913, 1817, 1721, 1625, 1529, 1433, 1337, 1241, 1145, 1049, 953, 857, 762, 666, 570, 474, 378, 282, 186, 90, -6, -102, -198, -294, -390, -486, -582, -671, -575, -479, -383, -287, -191, -95, 1, 97, 193,
+    556, 469, 383, 297, 211, 128, 78, 119, 202, 293, 386, 481, 576, 671, 766, 862, 957, 1053, 1149, 1245, 1341, 1436, 1532, 1628, 1724, 1820, 1916, 2012, 2108, 2204, 2300, 2396, 2491, 2587, 2683, 2779, 2875, 2971, 3067, 3163, 3259, 3355, 3451, 3547, 3643, 3739, 3643, 3547, 3451, 3355, 3259, 3163, 3067, 2971, 2875, 2779, 2683, 2587, 2491, 2395, 2299, 2203, 2107, 2011, 1915, 1819, 1723, 1627, 1531, 1435, 1339, 1243, 1147, 1051, 955, 859, 763, 667, 571, 475, 379, 283, 187, 91, -5, -101, -197, -293, -389, -485, -581, -672, -576, -480, -384, -288, -192, -96, 0, 96, 192,
+    597, 511, 426, 341, 263, 202, 174, 196, 255, 332, 416, 505, 596, 689, 782, 876, 970, 1065, 1159, 1254, 1350, 1445, 1540, 1636, 1731, 1827, 1922, 2018, 2113, 2209, 2305, 2401, 2496, 2592, 2688, 2784, 2880, 2975, 3071, 3167, 3263, 3359, 3455, 3551, 3606, 3643, 3603, 3524, 3435, 3343, 3250, 3155, 3060, 2965, 2870, 2774, 2679, 2583, 2487, 2392, 2296, 2200, 2104, 2008, 1913, 1817, 1721, 1625, 1529, 1433, 1337, 1241, 1145, 1049, 953, 857, 762, 666, 570, 474, 378, 282, 186, 90, -6, -99, -194, -290, -386, -482, -578, -671, -575, -479, -383, -287, -191, -95, 1, 97, 193,
+    641, 556, 474, 399, 335, 289, 270, 285, 328, 391, 465, 546, 631, 719, 809, 900, 992, 1084, 1178, 1271, 1365, 1459, 1554, 1649, 1743, 1838, 1933, 2028, 2124, 2219, 2314, 2409, 2505, 2600, 2696, 2791, 2887, 2983, 3078, 3174, 3269, 3365, 3424, 3474, 3524, 3547, 3524, 3468, 3393, 3310, 3222, 3132, 3040, 2947, 2854, 2760, 2666, 2571, 2476, 2381, 2286, 2191, 2096, 2000, 1905, 1809, 1714, 1618, 1523, 1427, 1331, 1236, 1140, 1044, 948, 853, 757, 661, 565, 469, 374, 278, 182, 86, -10, -106, -202, -297, -393, -489, -585, -668, -572, -476, -380, -284, -188, -92, 4, 100, 195,
+    687, 608, 535, 469, 416, 380, 366, 377, 411, 462, 526, 599, 678, 760, 846, 933, 1022, 1112, 1203, 1295, 1387, 1480, 1573, 1667, 1761, 1855, 1949, 2043, 2138, 2232, 2327, 2422, 2517, 2612, 2707, 2802, 2897, 2993, 3088, 3183, 3246, 3293, 3342, 3393, 3435, 3451, 3435, 3393, 3332, 3259, 3179, 3095, 3008, 2919, 2828, 2737, 2645, 2552, 2458, 2365, 2271, 2176, 2082, 1987, 1892, 1798, 1703, 1608, 1512, 1417, 1322, 1227, 1131, 1036, 940, 845, 749, 654, 558, 462, 367, 271, 175, 80, -16, -112, -207, -303, -399, -495, -591, -663, -567, -471, -375, -279, -184, -88, 8, 104, 200,
+    743, 670, 605, 548, 503, 473, 462, 471, 498, 542, 597, 662, 734, 811, 891, 975, 1060, 1147, 1236, 1325, 1416, 1507, 1599, 1691, 1783, 1876, 1969, 2063, 2156, 2250, 2344, 2438, 2533, 2627, 2722, 2816, 2911, 3006, 3073, 3117, 3162, 3210, 3260, 3310, 3343, 3355, 3343, 3310, 3259, 3196, 3124, 3047, 2965, 2880, 2794, 2705, 2615, 2525, 2433, 2341, 2249, 2156, 2063, 1969, 1875, 1781, 1687, 1592, 1498, 1403, 1309, 1214, 1119, 1024, 929, 834, 738, 643, 548, 453, 357, 262, 166, 71, -25, -120, -216, -311, -407, -502, -598, -655, -560, -464, -368, -273, -177, -81, 14, 110, 206,
+    806, 740, 681, 631, 592, 567, 558, 565, 588, 625, 674, 732, 798, 869, 945, 1024, 1105, 1189, 1275, 1362, 1450, 1539, 1629, 1719, 1810, 1902, 1994, 2086, 2179, 2272, 2365, 2458, 2552, 2646, 2740, 2834, 2905, 2945, 2987, 3032, 3079, 3128, 3179, 3222, 3250, 3259, 3250, 3222, 3179, 3124, 3060, 2989, 2913, 2833, 2751, 2666, 2579, 2491, 2402, 2312, 2221, 2130, 2038, 1946, 1853, 1760, 1667, 1573, 1480, 1386, 1292, 1197, 1103, 1009, 914, 819, 725, 630, 535, 440, 345, 250, 155, 60, -36, -131, -226, -321, -417, -512, -608, -646, -551, -455, -360, -264, -169, -73, 23, 118, 214,
+    875, 815, 761, 717, 683, 662, 654, 660, 680, 712, 756, 808, 868, 934, 1004, 1079, 1157, 1237, 1320, 1404, 1490, 1576, 1664, 1753, 1842, 1932, 2023, 2114, 2205, 2297, 2390, 2482, 2575, 2668, 2744, 2779, 2817, 2858, 2902, 2948, 2996, 3047, 3095, 3132, 3155, 3163, 3155, 3132, 3095, 3047, 2989, 2924, 2854, 2779, 2701, 2620, 2536, 2451, 2365, 2277, 2188, 2099, 2008, 1918, 1826, 1735, 1642, 1550, 1457, 1364, 1271, 1177, 1084, 990, 896, 802, 708, 614, 519, 425, 330, 235, 141, 46, -49, -144, -239, -334, -429, -524, -619, -635, -539, -444, -349, -254, -158, -63, 33, 128, 223,
+    949, 894, 845, 806, 776, 757, 750, 756, 773, 801, 840, 887, 942, 1003, 1069, 1140, 1214, 1291, 1370, 1451, 1534, 1619, 1704, 1791, 1879, 1967, 2056, 2146, 2236, 2327, 2418, 2509, 2590, 2621, 2654, 2691, 2730, 2772, 2817, 2865, 2914, 2965, 3008, 3040, 3060, 3067, 3060, 3040, 3008, 2965, 2913, 2854, 2789, 2719, 2645, 2567, 2487, 2405, 2322, 2236, 2150, 2063, 1974, 1885, 1795, 1705, 1614, 1523, 1431, 1339, 1247, 1154, 1061, 968, 875, 782, 688, 594, 501, 407, 313, 218, 124, 30, -65, -159, -254, -349, -443, -538, -633, -621, -526, -431, -336, -241, -146, -51, 44, 139, 235,
+    1027, 976, 932, 896, 869, 852, 846, 851, 866, 892, 927, 970, 1020, 1077, 1139, 1205, 1275, 1349, 1425, 1503, 1583, 1665, 1749, 1833, 1919, 2005, 2093, 2181, 2270, 2359, 2446, 2471, 2499, 2530, 2565, 2603, 2644, 2687, 2734, 2782, 2833, 2880, 2919, 2947, 2965, 2971, 2965, 2947, 2919, 2880, 2833, 2779, 2719, 2653, 2583, 2510, 2433, 2355, 2274, 2191, 2107, 2022, 1935, 1848, 1760, 1671, 1582, 1492, 1401, 1310, 1219, 1128, 1036, 944, 851, 758, 666, 573, 479, 386, 292, 199, 105, 11, -83, -177, -271, -365, -460, -554, -649, -606, -511, -416, -322, -227, -132, -37, 58, 153, 248,
+    1107, 1060, 1020, 987, 963, 948, 942, 946, 960, 984, 1015, 1055, 1101, 1154, 1212, 1274, 1341, 1411, 1484, 1559, 1637, 1716, 1797, 1879, 1963, 2048, 2134, 2220, 2307, 2331, 2353, 2379, 2408, 2441, 2477, 2516, 2558, 2603, 2651, 2701, 2751, 2794, 2828, 2854, 2870, 2875, 2870, 2854, 2828, 2794, 2751, 2701, 2645, 2583, 2517, 2448, 2375, 2299, 2221, 2141, 2060, 1977, 1892, 1807, 1721, 1634, 1546, 1457, 1368, 1278, 1188, 1098, 1007, 916, 824, 732, 640, 548, 455, 363, 270, 177, 84, -10, -103, -197, -291, -384, -478, -572, -666, -588, -494, -400, -305, -211, -116, -22, 73, 168, 262,
+    1190, 1146, 1109, 1079, 1057, 1043, 1038, 1042, 1055, 1076, 1105, 1141, 1184, 1234, 1288, 1347, 1410, 1477, 1546, 1619, 1694, 1771, 1849, 1929, 2011, 2094, 2178, 2203, 2218, 2237, 2260, 2287, 2317, 2351, 2389, 2429, 2473, 2519, 2568, 2620, 2666, 2705, 2737, 2760, 2774, 2779, 2774, 2760, 2737, 2705, 2666, 2620, 2567, 2510, 2448, 2381, 2312, 2240, 2165, 2087, 2008, 1928, 1846, 1762, 1678, 1592, 1506, 1419, 1331, 1243, 1154, 1065, 975, 885, 794, 703, 612, 521, 429, 337, 245, 152, 60, -33, -126, -219, -312, -406, -499, -593, -663, -569, -475, -381, -287, -193, -99, -5, 90, 184, 279,
+    1275, 1234, 1199, 1172, 1151, 1139, 1134, 1138, 1149, 1169, 1196, 1229, 1269, 1315, 1366, 1422, 1482, 1546, 1613, 1682, 1754, 1828, 1905, 1983, 2062, 2090, 2097, 2108, 2124, 2144, 2167, 2195, 2227, 2262, 2301, 2343, 2388, 2437, 2487, 2536, 2579, 2615, 2645, 2666, 2679, 2683, 2679, 2666, 2645, 2615, 2579, 2536, 2487, 2433, 2375, 2312, 2246, 2176, 2104, 2030, 1953, 1875, 1795, 1714, 1631, 1548, 1463, 1378, 1292, 1205, 1117, 1029, 940, 851, 762, 672, 581, 491, 400, 309, 217, 125, 33, -59, -151, -243, -336, -429, -522, -615, -641, -547, -454, -361, -267, -173, -79, 14, 108, 202, 297,
+    1361, 1323, 1290, 1265, 1246, 1234, 1230, 1233, 1244, 1262, 1287, 1318, 1356, 1399, 1447, 1500, 1557, 1617, 1681, 1748, 1818, 1890, 1963, 1993, 1991, 1994, 2001, 2013, 2029, 2050, 2075, 2104, 2137, 2174, 2214, 2258, 2305, 2355, 2405, 2451, 2491, 2525, 2552, 2571, 2583, 2587, 2583, 2571, 2552, 2525, 2491, 2451, 2405, 2355, 2299, 2240, 2176, 2110, 2041, 1969, 1895, 1819, 1741, 1662, 1582, 1500, 1417, 1333, 1249, 1163, 1077, 990, 903, 815, 726, 637, 548, 458, 368, 278, 187, 96, 5, -86, -178, -270, -362, -454, -547, -639, -617, -524, -431, -338, -245, -152, -58, 35, 129, 222, 316,
+    1448, 1412, 1382, 1358, 1341, 1330, 1326, 1329, 1339, 1356, 1379, 1408, 1444, 1484, 1530, 1580, 1634, 1692, 1753, 1817, 1884, 1915, 1904, 1897, 1895, 1898, 1906, 1918, 1935, 1957, 1983, 2014, 2048, 2087, 2129, 2174, 2223, 2274, 2322, 2365, 2402, 2433, 2458, 2476, 2487, 2491, 2487, 2476, 2458, 2433, 2402, 2365, 2322, 2274, 2221, 2165, 2104, 2041, 1974, 1905, 1834, 1760, 1685, 1608, 1529, 1449, 1368, 1286, 1203, 1119, 1034, 948, 862, 775, 688, 600, 512, 423, 334, 245, 155, 65, -26, -116, -207, -299, -390, -482, -573, -665, -591, -499, -407, -314, -221, -128, -35, 58, 151, 244, 337,
+    1537, 1503, 1475, 1452, 1436, 1426, 1422, 1425, 1434, 1450, 1472, 1499, 1532, 1570, 1614, 1661, 1713, 1768, 1827, 1859, 1837, 1820, 1808, 1801, 1799, 1802, 1810, 1823, 1841, 1864, 1892, 1924, 1960, 2000, 2044, 2091, 2141, 2191, 2236, 2277, 2312, 2341, 2365, 2381, 2392, 2395, 2392, 2381, 2365, 2341, 2312, 2277, 2236, 2191, 2141, 2087, 2030, 1969, 1905, 1838, 1769, 1698, 1625, 1550, 1473, 1395, 1316, 1236, 1154, 1072, 988, 904, 819, 734, 648, 561, 474, 386, 298, 209, 120, 31, -59, -149, -239, -329, -420, -511, -602, -655, -564, -472, -380, -288, -196, -103, -11, 82, 175, 267, 360,
+    1626, 1594, 1567, 1546, 1531, 1522, 1518, 1521, 1530, 1544, 1565, 1590, 1622, 1658, 1699, 1744, 1793, 1827, 1795, 1767, 1744, 1725, 1713, 1705, 1703, 1706, 1715, 1729, 1748, 1772, 1801, 1834, 1872, 1914, 1960, 2009, 2060, 2107, 2150, 2188, 2221, 2249, 2271, 2286, 2296, 2299, 2296, 2286, 2271, 2249, 2221, 2188, 2150, 2107, 2060, 2008, 1953, 1895, 1834, 1769, 1703, 1634, 1563, 1490, 1415, 1339, 1262, 1183, 1103, 1022, 940, 857, 774, 690, 605, 519, 433, 346, 259, 172, 84, -5, -94, -183, -272, -362, -452, -542, -633, -625, -534, -443, -352, -260, -169, -77, 15, 108, 200, 292, 385,
+    1716, 1686, 1661, 1641, 1626, 1617, 1614, 1617, 1625, 1639, 1658, 1682, 1712, 1746, 1785, 1820, 1777, 1738, 1704, 1674, 1650, 1631, 1617, 1609, 1607, 1610, 1619, 1634, 1654, 1680, 1710, 1745, 1785, 1829, 1877, 1928, 1977, 2022, 2063, 2099, 2130, 2156, 2176, 2191, 2200, 2203, 2200, 2191, 2176, 2156, 2130, 2099, 2063, 2022, 1977, 1928, 1875, 1819, 1760, 1698, 1634, 1567, 1498, 1427, 1354, 1280, 1205, 1128, 1049, 970, 890, 808, 726, 643, 559, 475, 390, 304, 218, 132, 45, -43, -131, -219, -308, -397, -486, -576, -665, -593, -503, -412, -322, -231, -140, -48, 43, 135, 227, 319, 411,
+    1806, 1778, 1754, 1735, 1722, 1713, 1710, 1713, 1720, 1733, 1751, 1775, 1803, 1835, 1785, 1736, 1691, 1650, 1614, 1582, 1557, 1536, 1522, 1513, 1511, 1515, 1524, 1540, 1561, 1588, 1620, 1657, 1699, 1745, 1795, 1846, 1892, 1935, 1974, 2008, 2038, 2063, 2082, 2096, 2104, 2107, 2104, 2096, 2082, 2063, 2038, 2008, 1974, 1935, 1892, 1846, 1795, 1741, 1685, 1625, 1563, 1498, 1431, 1362, 1292, 1219, 1145, 1070, 993, 916, 837, 757, 676, 594, 512, 429, 345, 260, 175, 90, 4, -83, -170, -257, -345, -433, -522, -611, -649, -560, -470, -380, -290, -200, -109, -18, 73, 164, 255, 347, 438,
+    1898, 1870, 1848, 1830, 1817, 1809, 1806, 1808, 1816, 1828, 1845, 1867, 1818, 1760, 1704, 1653, 1605, 1562, 1524, 1491, 1464, 1442, 1427, 1417, 1415, 1419, 1429, 1446, 1469, 1497, 1531, 1570, 1614, 1663, 1714, 1762, 1807, 1848, 1885, 1918, 1946, 1969, 1987, 2000, 2008, 2011, 2008, 2000, 1987, 1969, 1946, 1918, 1885, 1848, 1807, 1762, 1714, 1662, 1608, 1550, 1490, 1427, 1362, 1295, 1227, 1156, 1084, 1010, 935, 859, 782, 703, 624, 544, 462, 380, 298, 214, 130, 46, -39, -125, -211, -297, -384, -472, -560, -648, -613, -524, -435, -346, -256, -167, -77, 14, 104, 195, 285, 376, 468,
+    1989, 1963, 1942, 1925, 1912, 1905, 1902, 1904, 1911, 1923, 1876, 1809, 1745, 1684, 1626, 1571, 1521, 1476, 1435, 1400, 1371, 1348, 1331, 1322, 1319, 1323, 1334, 1352, 1376, 1407, 1443, 1485, 1531, 1582, 1631, 1678, 1721, 1760, 1795, 1826, 1853, 1875, 1892, 1905, 1913, 1915, 1913, 1905, 1892, 1875, 1853, 1826, 1795, 1760, 1721, 1678, 1631, 1582, 1529, 1473, 1415, 1354, 1292, 1227, 1160, 1091, 1020, 948, 875, 800, 725, 648, 570, 491, 411, 330, 249, 166, 84, 0, -84, -169, -254, -340, -426, -512, -599, -663, -575, -487, -399, -310, -221, -132, -43, 47, 137, 227, 317, 408, 498,
+    2081, 2056, 2036, 2020, 2008, 2001, 1998, 2000, 1956, 1882, 1810, 1740, 1673, 1609, 1549, 1492, 1439, 1391, 1348, 1310, 1279, 1254, 1236, 1226, 1223, 1227, 1239, 1259, 1285, 1317, 1356, 1400, 1449, 1500, 1548, 1592, 1634, 1671, 1705, 1735, 1760, 1781, 1798, 1809, 1817, 1819, 1817, 1809, 1798, 1781, 1760, 1735, 1705, 1671, 1634, 1592, 1548, 1500, 1449, 1395, 1339, 1280, 1219, 1156, 1091, 1024, 955, 885, 813, 740, 666, 590, 513, 436, 357, 278, 197, 116, 35, -48, -131, -214, -299, -383, -469, -554, -640, -622, -535, -448, -361, -273, -184, -96, -7, 82, 171, 261, 350, 440, 530,
+    2173, 2150, 2130, 2115, 2103, 2097, 2055, 1975, 1897, 1821, 1747, 1674, 1605, 1538, 1474, 1414, 1358, 1307, 1261, 1221, 1187, 1161, 1142, 1130, 1127, 1132, 1145, 1165, 1194, 1229, 1270, 1317, 1368, 1417, 1463, 1506, 1546, 1582, 1614, 1642, 1667, 1687, 1703, 1714, 1721, 1723, 1721, 1714, 1703, 1687, 1667, 1642, 1614, 1582, 1546, 1506, 1463, 1417, 1368, 1316, 1262, 1205, 1145, 1084, 1020, 955, 888, 819, 749, 678, 605, 531, 455, 379, 302, 224, 145, 65, -16, -97, -179, -262, -345, -429, -513, -598, -666, -580, -494, -408, -321, -234, -146, -58, 30, 118, 207, 296, 385, 474, 564,
+    2266, 2243, 2225, 2210, 2171, 2087, 2004, 1922, 1842, 1763, 1686, 1611, 1539, 1469, 1402, 1339, 1280, 1225, 1176, 1133, 1097, 1068, 1047, 1034, 1031, 1036, 1050, 1073, 1103, 1141, 1186, 1236, 1286, 1333, 1378, 1419, 1457, 1492, 1523, 1550, 1573, 1592, 1608, 1618, 1625, 1627, 1625, 1618, 1608, 1592, 1573, 1550, 1523, 1492, 1457, 1419, 1378, 1333, 1286, 1236, 1183, 1128, 1070, 1010, 948, 885, 819, 752, 684, 614, 542, 469, 396, 321, 245, 168, 90, 11, -68, -149, -230, -311, -393, -476, -560, -643, -621, -536, -451, -365, -279, -193, -106, -19, 68, 156, 244, 332, 421, 510, 599,
+    2359, 2337, 2301, 2213, 2127, 2041, 1956, 1872, 1790, 1709, 1629, 1552, 1476, 1403, 1333, 1266, 1204, 1146, 1093, 1047, 1007, 975, 952, 939, 935, 941, 956, 981, 1014, 1055, 1103, 1154, 1203, 1249, 1292, 1331, 1368, 1401, 1431, 1457, 1480, 1498, 1512, 1523, 1529, 1531, 1529, 1523, 1512, 1498, 1480, 1457, 1431, 1401, 1368, 1331, 1292, 1249, 1203, 1154, 1103, 1049, 993, 935, 875, 813, 749, 684, 616, 548, 478, 407, 334, 260, 186, 110, 33, -44, -122, -202, -281, -362, -443, -525, -608, -658, -575, -491, -407, -322, -236, -151, -65, 22, 108, 195, 283, 371, 458, 547, 635,
+    2443, 2353, 2264, 2175, 2086, 1999, 1912, 1826, 1742, 1658, 1576, 1496, 1417, 1341, 1268, 1197, 1131, 1069, 1012, 962, 919, 884, 858, 843, 839, 845, 863, 890, 927, 971, 1022, 1072, 1119, 1163, 1205, 1243, 1278, 1310, 1339, 1364, 1386, 1403, 1417, 1427, 1433, 1435, 1433, 1427, 1417, 1403, 1386, 1364, 1339, 1310, 1278, 1243, 1205, 1163, 1119, 1072, 1022, 970, 916, 859, 800, 740, 678, 614, 548, 481, 412, 342, 271, 199, 125, 51, -25, -101, -178, -256, -335, -415, -495, -576, -657, -610, -527, -444, -361, -276, -192, -107, -22, 64, 150, 236, 323, 410, 497, 585, 673,
+    2412, 2320, 2230, 2139, 2050, 1961, 1872, 1784, 1698, 1612, 1527, 1444, 1363, 1283, 1206, 1132, 1062, 995, 934, 879, 832, 793, 765, 748, 743, 750, 770, 800, 841, 890, 940, 988, 1034, 1077, 1117, 1154, 1188, 1219, 1247, 1271, 1292, 1309, 1322, 1331, 1337, 1339, 1337, 1331, 1322, 1309, 1292, 1271, 1247, 1219, 1188, 1154, 1117, 1077, 1034, 988, 940, 890, 837, 782, 725, 666, 605, 542, 478, 412, 345, 276, 207, 136, 63, -10, -84, -159, -235, -312, -390, -469, -548, -628, -641, -560, -478, -396, -313, -230, -146, -62, 23, 108, 193, 279, 365, 451, 538, 625, 712,
+    2384, 2292, 2200, 2108, 2017, 1926, 1836, 1747, 1658, 1570, 1483, 1397, 1313, 1230, 1150, 1072, 997, 926, 860, 800, 747, 704, 672, 653, 647, 655, 678, 712, 757, 808, 857, 904, 948, 990, 1029, 1065, 1098, 1128, 1154, 1177, 1197, 1214, 1227, 1236, 1241, 1243, 1241, 1236, 1227, 1214, 1197, 1177, 1154, 1128, 1098, 1065, 1029, 990, 948, 904, 857, 808, 757, 703, 648, 590, 531, 469, 407, 342, 276, 209, 141, 71, 0, -72, -145, -219, -294, -370, -447, -524, -602, -668, -588, -508, -427, -346, -264, -182, -99, -15, 68, 153, 237, 322, 408, 493, 579, 666, 752,
+    2360, 2266, 2173, 2081, 1988, 1896, 1805, 1713, 1623, 1533, 1444, 1355, 1268, 1183, 1098, 1017, 937, 861, 790, 724, 666, 617, 580, 558, 551, 561, 587, 626, 676, 726, 774, 819, 862, 903, 940, 975, 1007, 1036, 1061, 1084, 1103, 1119, 1131, 1140, 1145, 1147, 1145, 1140, 1131, 1119, 1103, 1084, 1061, 1036, 1007, 975, 940, 903, 862, 819, 774, 726, 676, 624, 570, 513, 455, 396, 334, 271, 207, 141, 73, 5, -65, -136, -207, -280, -354, -429, -505, -581, -658, -613, -534, -455, -375, -295, -214, -132, -50, 33, 116, 199, 283, 367, 452, 537, 622, 708, 794,
+    2339, 2245, 2151, 2057, 1964, 1871, 1778, 1685, 1593, 1501, 1410, 1319, 1230, 1141, 1054, 968, 884, 804, 726, 654, 589, 533, 490, 463, 455, 467, 498, 544, 594, 643, 690, 734, 775, 815, 851, 885, 916, 944, 968, 990, 1009, 1024, 1036, 1044, 1049, 1051, 1049, 1044, 1036, 1024, 1009, 990, 968, 944, 916, 885, 851, 815, 775, 734, 690, 643, 594, 544, 491, 436, 379, 321, 260, 199, 136, 71, 5, -62, -131, -200, -271, -343, -416, -489, -564, -639, -634, -557, -479, -401, -322, -242, -162, -81, -1, 82, 164, 247, 330, 413, 497, 582, 666, 751, 837,
+    2322, 2227, 2133, 2038, 1944, 1850, 1755, 1662, 1568, 1475, 1382, 1289, 1197, 1106, 1016, 927, 839, 753, 670, 592, 519, 454, 403, 369, 359, 374, 412, 462, 512, 559, 605, 648, 688, 726, 762, 794, 824, 851, 875, 896, 914, 929, 940, 948, 953, 955, 953, 948, 940, 929, 914, 896, 875, 851, 824, 794, 762, 726, 688, 648, 605, 559, 512, 462, 411, 357, 302, 245, 186, 125, 63, 0, -65, -131, -198, -267, -336, -407, -478, -551, -624, -650, -575, -499, -422, -345, -267, -188, -109, -29, 51, 132, 214, 296, 378, 461, 544, 628, 712, 796, 881,
+    2309, 2214, 2119, 2024, 1928, 1833, 1738, 1644, 1549, 1454, 1360, 1266, 1172, 1079, 986, 894, 803, 713, 624, 539, 457, 383, 320, 277, 263, 283, 330, 380, 429, 475, 519, 561, 600, 637, 672, 703, 732, 758, 782, 802, 819, 834, 845, 853, 857, 859, 857, 853, 845, 834, 819, 802, 782, 758, 732, 703, 672, 637, 600, 561, 519, 475, 429, 380, 330, 278, 224, 168, 110, 51, -10, -72, -136, -200, -267, -334, -402, -472, -542, -614, -663, -589, -515, -440, -364, -288, -211, -133, -55, 24, 104, 184, 265, 346, 428, 510, 592, 675, 759, 842, 926,
+    2300, 2205, 2109, 2013, 1918, 1822, 1726, 1631, 1535, 1440, 1345, 1250, 1154, 1060, 965, 871, 777, 683, 590, 499, 410, 325, 247, 188, 167, 197, 249, 298, 345, 390, 433, 474, 512, 548, 581, 612, 640, 666, 688, 708, 725, 738, 749, 757, 762, 763, 762, 757, 749, 738, 725, 708, 688, 666, 640, 612, 581, 548, 512, 474, 433, 390, 345, 298, 249, 197, 145, 90, 33, -25, -84, -145, -207, -271, -336, -402, -470, -538, -608, -671, -600, -527, -454, -380, -305, -230, -154, -77, 1, 79, 158, 237, 317, 397, 478, 560, 642, 724, 806, 889, 973,
+    2295, 2200, 2104, 2008, 1912, 1816, 1720, 1624, 1528, 1432, 1336, 1240, 1145, 1049, 953, 857, 762, 666, 571, 476, 381, 287, 196, 112, 72, 116, 166, 214, 260, 304, 346, 386, 423, 458, 491, 521, 548, 573, 594, 614, 630, 643, 654, 661, 666, 667, 666, 661, 654, 643, 630, 614, 594, 573, 548, 521, 491, 458, 423, 386, 346, 304, 260, 214, 166, 116, 65, 11, -44, -101, -159, -219, -280, -343, -407, -472, -538, -605, -674, -606, -535, -464, -392, -319, -245, -170, -95, -19, 58, 135, 213, 291, 371, 450, 530, 611, 692, 774, 855, 938, 1021,
+    2295, 2199, 2103, 2007, 1911, 1815, 1719, 1623, 1527, 1431, 1335, 1239, 1143, 1047, 951, 855, 759, 663, 567, 471, 375, 280, 184, 90, 3, 35, 84, 130, 175, 218, 259, 298, 334, 368, 400, 429, 455, 479, 501, 519, 535, 548, 558, 565, 570, 571, 570, 565, 558, 548, 535, 519, 501, 479, 455, 429, 400, 368, 334, 298, 259, 218, 175, 130, 84, 35, -16, -68, -122, -178, -235, -294, -354, -416, -478, -542, -608, -674, -608, -539, -470, -400, -328, -256, -184, -110, -35, 40, 116, 192, 269, 347, 425, 504, 583, 663, 744, 824, 906, 987, 1069,
+    2298, 2202, 2106, 2010, 1914, 1818, 1723, 1627, 1531, 1435, 1340, 1244, 1149, 1053, 958, 863, 768, 673, 579, 486, 393, 304, 218, 134, 50, -33, 0, 46, 90, 132, 172, 209, 245, 278, 309, 337, 363, 386, 407, 425, 440, 453, 462, 469, 474, 475, 474, 469, 462, 453, 440, 425, 407, 386, 363, 337, 309, 278, 245, 209, 172, 132, 90, 46, 0, -48, -97, -149, -202, -256, -312, -370, -429, -489, -551, -614, -671, -606, -539, -472, -404, -334, -264, -193, -121, -48, 25, 100, 175, 250, 326, 403, 481, 559, 637, 717, 796, 876, 957, 1038, 1119,
+    2305, 2209, 2114, 2018, 1923, 1827, 1732, 1637, 1542, 1447, 1352, 1257, 1163, 1069, 975, 882, 789, 697, 607, 518, 433, 348, 265, 182, 99, 18, -63, -39, 4, 45, 84, 120, 155, 187, 217, 245, 270, 292, 313, 330, 345, 357, 367, 374, 378, 379, 378, 374, 367, 357, 345, 330, 313, 292, 270, 245, 217, 187, 155, 120, 84, 45, 4, -39, -84, -131, -179, -230, -281, -335, -390, -447, -505, -564, -624, -663, -600, -535, -470, -404, -336, -268, -199, -128, -57, 14, 87, 160, 235, 309, 385, 461, 538, 615, 693, 771, 850, 929, 1009, 1090, 1170,
+    2316, 2221, 2126, 2031, 1936, 1841, 1747, 1652, 1558, 1464, 1371, 1277, 1185, 1092, 1001, 910, 820, 733, 647, 563, 479, 396, 313, 231, 150, 70, -10, -88, -83, -43, -5, 31, 65, 96, 125, 152, 177, 199, 218, 235, 250, 262, 271, 278, 282, 283, 282, 278, 271, 262, 250, 235, 218, 199, 177, 152, 125, 96, 65, 31, -5, -43, -83, -125, -169, -214, -262, -311, -362, -415, -469, -524, -581, -639, -650, -589, -527, -464, -400, -334, -268, -200, -132, -63, 7, 78, 150, 222, 296, 370, 444, 520, 595, 672, 749, 827, 905, 984, 1063, 1142, 1222,
+    2331, 2236, 2142, 2048, 1954, 1860, 1766, 1673, 1580, 1488, 1396, 1304, 1213, 1124, 1035, 947, 862, 777, 693, 610, 527, 445, 364, 283, 203, 124, 46, -32, -108, -131, -94, -59, -26, 5, 33, 60, 84, 105, 124, 141, 155, 166, 175, 182, 186, 187, 186, 182, 175, 166, 155, 141, 124, 105, 84, 60, 33, 5, -26, -59, -94, -131, -170, -211, -254, -299, -345, -393, -443, -495, -548, -602, -658, -634, -575, -515, -454, -392, -328, -264, -199, -132, -65, 4, 73, 143, 214, 285, 358, 431, 505, 579, 654, 730, 806, 883, 961, 1039, 1117, 1196, 1276,
+    2349, 2256, 2162, 2069, 1976, 1883, 1791, 1699, 1608, 1517, 1427, 1337, 1249, 1162, 1076, 992, 908, 824, 741, 659, 577, 496, 416, 336, 258, 180, 103, 27, -48, -122, -183, -149, -116, -86, -59, -33, -10, 11, 30, 46, 60, 71, 80, 86, 90, 91, 90, 86, 80, 71, 60, 46, 30, 11, -10, -33, -59, -87, -116, -149, -183, -219, -257, -297, -340, -383, -429, -476, -525, -576, -628, -668, -613, -557, -499, -440, -380, -319, -256, -193, -128, -63, 4, 71, 139, 209, 279, 349, 421, 493, 566, 640, 714, 789, 865, 941, 1018, 1095, 1173, 1251, 1330,
+    2372, 2279, 2187, 2094, 2003, 1911, 1820, 1730, 1640, 1552, 1464, 1377, 1291, 1206, 1122, 1039, 955, 873, 791, 710, 629, 549, 470, 392, 314, 237, 162, 87, 14, -59, -130, -199, -207, -178, -151, -126, -103, -83, -65, -49, -36, -25, -16, -10, -6, -5, -6, -10, -16, -25, -36, -49, -65, -83, -103, -126, -151, -178, -207, -239, -272, -308, -345, -384, -426, -469, -513, -560, -608, -657, -641, -588, -534, -479, -422, -364, -305, -245, -184, -121, -57, 7, 73, 139, 207, 275, 344, 414, 485, 556, 629, 702, 775, 849, 924, 999, 1075, 1152, 1229, 1307, 1385,
+    2398, 2306, 2215, 2124, 2034, 1944, 1854, 1766, 1678, 1591, 1506, 1421, 1337, 1253, 1170, 1087, 1005, 923, 842, 762, 682, 604, 526, 448, 372, 297, 222, 149, 77, 6, -63, -132, -198, -263, -243, -219, -197, -177, -159, -144, -131, -120, -112, -106, -102, -101, -102, -106, -112, -120, -131, -144, -159, -177, -197, -219, -243, -270, -299, -329, -362, -397, -433, -472, -512, -554, -598, -643, -657, -606, -560, -508, -455, -401, -345, -288, -230, -170, -110, -48, 14, 78, 143, 209, 275, 343, 411, 480, 550, 621, 692, 764, 837, 910, 984, 1059, 1134, 1210, 1286, 1363, 1441,
+    2428, 2337, 2247, 2157, 2068, 1980, 1893, 1806, 1720, 1635, 1551, 1467, 1384, 1301, 1219, 1137, 1056, 975, 895, 816, 737, 660, 583, 507, 432, 358, 285, 213, 142, 72, 4, -63, -128, -191, -253, -312, -291, -271, -254, -239, -226, -216, -207, -202, -198, -197, -198, -202, -207, -216, -226, -239, -254, -271, -291, -312, -336, -362, -390, -420, -452, -486, -522, -560, -599, -640, -665, -621, -574, -525, -475, -427, -375, -322, -267, -211, -154, -95, -35, 25, 87, 150, 214, 279, 344, 411, 478, 547, 616, 686, 756, 828, 900, 972, 1045, 1119, 1194, 1269, 1345, 1421, 1498,
+    2461, 2371, 2283, 2195, 2107, 2021, 1935, 1850, 1766, 1682, 1598, 1515, 1433, 1351, 1269, 1188, 1108, 1029, 950, 871, 794, 717, 642, 567, 493, 420, 348, 278, 208, 140, 73, 8, -56, -118, -178, -237, -294, -348, -349, -334, -321, -311, -303, -297, -294, -293, -294, -297, -303, -311, -321, -334, -349, -365, -384, -406, -429, -454, -482, -511, -542, -576, -611, -648, -656, -619, -579, -536, -491, -443, -392, -346, -295, -242, -188, -133, -77, -19, 40, 100, 160, 222, 285, 349, 414, 480, 547, 614, 682, 751, 821, 892, 963, 1035, 1108, 1181, 1255, 1329, 1404, 1479, 1555,
+    2497, 2409, 2322, 2235, 2149, 2065, 1980, 1896, 1813, 1729, 1647, 1565, 1483, 1402, 1321, 1241, 1162, 1083, 1006, 928, 852, 776, 702, 628, 555, 484, 413, 344, 276, 209, 143, 80, 17, -44, -103, -160, -215, -268, -319, -368, -414, -407, -399, -393, -390, -389, -390, -393, -399, -407, -417, -429, -443, -460, -478, -499, -522, -547, -573, -602, -633, -656, -630, -600, -567, -531, -492, -451, -407, -360, -311, -260, -214, -162, -109, -55, 1, 58, 116, 175, 235, 296, 358, 421, 485, 550, 616, 682, 750, 818, 887, 957, 1027, 1099, 1170, 1243, 1316, 1390, 1464, 1539, 1614,
+    2536, 2450, 2364, 2279, 2195, 2111, 2027, 1944, 1861, 1778, 1697, 1615, 1534, 1454, 1375, 1296, 1217, 1140, 1063, 987, 911, 837, 763, 691, 619, 549, 480, 411, 345, 279, 215, 152, 91, 32, -26, -81, -135, -187, -236, -284, -329, -371, -411, -448, -482, -485, -486, -489, -495, -502, -512, -524, -538, -554, -572, -593, -615, -634, -621, -605, -586, -564, -538, -509, -477, -442, -405, -364, -322, -276, -229, -179, -132, -81, -29, 24, 79, 135, 192, 250, 309, 370, 431, 493, 556, 621, 686, 751, 818, 886, 954, 1023, 1093, 1163, 1234, 1306, 1378, 1451, 1525, 1599, 1674,
+    2579, 2494, 2409, 2325, 2241, 2158, 2075, 1992, 1910, 1829, 1748, 1667, 1587, 1508, 1429, 1351, 1274, 1197, 1121, 1046, 972, 899, 826, 755, 685, 615, 547, 480, 415, 350, 288, 226, 167, 109, 52, -2, -55, -105, -153, -199, -243, -284, -323, -359, -392, -422, -450, -474, -496, -514, -528, -540, -548, -553, -554, -553, -547, -538, -526, -511, -492, -471, -446, -418, -387, -353, -317, -278, -236, -192, -146, -97, -46, -1, 51, 104, 158, 213, 269, 326, 385, 444, 505, 566, 629, 692, 756, 821, 887, 954, 1021, 1090, 1159, 1228, 1299, 1370, 1441, 1514, 1587, 1660, 1734,
+    2624, 2539, 2456, 2372, 2289, 2206, 2124, 2043, 1961, 1881, 1800, 1721, 1642, 1563, 1485, 1408, 1332, 1256, 1181, 1107, 1034, 962, 891, 820, 751, 683, 616, 550, 486, 423, 361, 301, 243, 186, 131, 78, 27, -22, -69, -114, -156, -197, -234, -269, -301, -331, -357, -381, -402, -419, -433, -445, -452, -457, -458, -457, -451, -443, -431, -416, -398, -377, -353, -326, -296, -264, -228, -190, -150, -107, -62, -14, 33, 82, 132, 184, 237, 291, 347, 403, 461, 520, 579, 640, 702, 764, 828, 892, 957, 1023, 1090, 1157, 1225, 1294, 1364, 1434, 1505, 1577, 1649, 1722, 1795,
+    2670, 2586, 2503, 2421, 2338, 2256, 2175, 2094, 2013, 1934, 1854, 1775, 1697, 1620, 1543, 1467, 1391, 1316, 1243, 1170, 1097, 1026, 956, 887, 819, 752, 686, 622, 558, 497, 436, 377, 320, 265, 211, 159, 109, 61, 15, -28, -70, -109, -145, -179, -210, -239, -265, -287, -307, -324, -338, -349, -357, -361, -362, -361, -356, -347, -336, -322, -304, -284, -261, -234, -205, -174, -139, -102, -63, -21, 23, 68, 116, 164, 214, 265, 317, 371, 425, 481, 538, 595, 654, 714, 775, 837, 900, 963, 1027, 1093, 1159, 1225, 1293, 1361, 1430, 1500, 1570, 1641, 1712, 1785, 1857,
+    2718, 2635, 2552, 2470, 2389, 2307, 2227, 2147, 2067, 1988, 1909, 1831, 1754, 1677, 1601, 1526, 1452, 1378, 1305, 1233, 1162, 1092, 1023, 955, 888, 822, 757, 694, 632, 571, 512, 454, 398, 344, 292, 241, 192, 145, 101, 58, 18, -20, -55, -88, -119, -147, -172, -194, -213, -230, -243, -253, -261, -265, -266, -265, -260, -252, -241, -227, -210, -190, -168, -142, -114, -83, -50, -14, 24, 65, 108, 153, 199, 247, 296, 346, 397, 450, 504, 559, 615, 672, 730, 789, 849, 910, 972, 1035, 1099, 1163, 1228, 1294, 1361, 1429, 1497, 1566, 1635, 1706, 1777, 1848, 1920,
+    2766, 2684, 2602, 2521, 2440, 2360, 2280, 2200, 2121, 2043, 1965, 1888, 1812, 1736, 1661, 1587, 1513, 1440, 1369, 1298, 1227, 1158, 1090, 1023, 957, 893, 829, 767, 706, 647, 589, 532, 477, 424, 373, 323, 276, 230, 186, 145, 106, 69, 34, 2, -27, -54, -78, -100, -119, -135, -148, -158, -165, -169, -170, -169, -164, -156, -146, -132, -116, -97, -75, -50, -23, 7, 40, 75, 112, 151, 193, 237, 283, 330, 378, 428, 478, 530, 583, 637, 693, 749, 806, 865, 924, 984, 1045, 1108, 1170, 1234, 1299, 1364, 1430, 1497, 1564, 1633, 1702, 1771, 1841, 1912, 1983,
+    2816, 2735, 2653, 2573, 2493, 2413, 2334, 2255, 2177, 2100, 2023, 1947, 1871, 1796, 1722, 1649, 1576, 1504, 1433, 1363, 1294, 1226, 1159, 1093, 1028, 965, 902, 841, 781, 723, 666, 611, 557, 505, 455, 406, 360, 315, 273, 232, 194, 158, 125, 93, 65, 38, 15, -6, -24, -40, -52, -62, -69, -73, -74, -73, -68, -61, -51, -37, -22, -3, 18, 42, 69, 98, 130, 164, 200, 239, 279, 322, 367, 413, 461, 510, 560, 611, 663, 717, 771, 827, 883, 941, 999, 1059, 1119, 1181, 1243, 1306, 1370, 1434, 1500, 1566, 1633, 1700, 1768, 1837, 1907, 1977, 2048,
+    2867, 2786, 2706, 2626, 2546, 2467, 2389, 2311, 2234, 2157, 2081, 2006, 1931, 1857, 1784, 1711, 1640, 1569, 1499, 1430, 1362, 1295, 1229, 1164, 1100, 1037, 976, 916, 857, 800, 744, 690, 638, 587, 538, 490, 445, 401, 360, 320, 283, 248, 215, 185, 157, 131, 108, 88, 70, 55, 43, 33, 27, 23, 22, 23, 28, 35, 45, 58, 73, 91, 112, 135, 161, 189, 220, 253, 289, 326, 366, 408, 452, 497, 544, 592, 642, 692, 744, 796, 850, 905, 961, 1018, 1075, 1134, 1194, 1255, 1316, 1378, 1441, 1505, 1570, 1635, 1702, 1768, 1836, 1904, 1973, 2043, 2113,
+    2919, 2839, 2759, 2680, 2601, 2523, 2445, 2368, 2292, 2216, 2141, 2066, 1992, 1919, 1847, 1775, 1705, 1635, 1566, 1498, 1430, 1364, 1299, 1235, 1173, 1111, 1051, 992, 934, 878, 823, 770, 719, 669, 621, 574, 530, 487, 447, 408, 372, 338, 306, 276, 249, 224, 202, 182, 165, 150, 138, 129, 123, 119, 118, 119, 123, 130, 140, 152, 168, 185, 205, 228, 253, 281, 311, 343, 378, 414, 453, 494, 537, 582, 628, 675, 724, 774, 824, 876, 929, 984, 1039, 1095, 1152, 1210, 1269, 1329, 1390, 1451, 1514, 1577, 1641, 1706, 1771, 1837, 1904, 1972, 2040, 2109, 2178,
+    2972, 2893, 2814, 2735, 2657, 2580, 2503, 2427, 2351, 2276, 2201, 2128, 2055, 1982, 1911, 1840, 1770, 1701, 1633, 1566, 1500, 1435, 1371, 1308, 1246, 1186, 1127, 1069, 1012, 957, 903, 851, 801, 752, 705, 659, 616, 574, 535, 497, 461, 428, 397, 368, 342, 317, 296, 276, 260, 245, 234, 225, 218, 215, 214, 215, 219, 226, 235, 248, 262, 279, 299, 321, 346, 373, 402, 433, 467, 503, 541, 581, 623, 666, 712, 759, 806, 855, 906, 957, 1009, 1063, 1117, 1173, 1229, 1286, 1345, 1404, 1464, 1525, 1587, 1649, 1712, 1777, 1841, 1907, 1973, 2040, 2108, 2176, 2245,
+};
+
+#define ARM_REACH_WRIST_X0   -66
+#define ARM_REACH_WRIST_Z0   -198
+#define ARM_REACH_WRIST_COLS 54
+#define ARM_REACH_WRIST_ROWS 74
+
+static const int16_t arm_reach_wrist_sdf[3996] ARM_FLASH = {
+    1872, 1779, 1686, 1593, 1501, 1409, 1317, 1227, 1137, 1048, 961, 876, 793, 713, 638, 569, 509, 461, 419, 380, 344, 312, 284, 260, 241, 225, 214, 208, 206, 209, 216, 227, 243, 264, 288, 317, 349, 385, 424, 467, 513, 563, 614, 669, 726, 785, 846, 910, 975, 1042, 1110, 1180, 1252, 1325,
+    1853, 1759, 1665, 1571, 1477, 1383, 1290, 1197, 1105, 1014, 923, 834, 747, 661, 580, 503, 434, 377, 332, 291, 254, 221, 192, 167, 146, 130, 119, 112, 110, 113, 120, 132, 149, 170, 196, 226, 259, 297, 338, 383, 431, 481, 535, 591, 650, 711, 774, 839, 906, 975, 1045, 1116, 1189, 1264,
+    1839, 1744, 1649, 1554, 1459, 1364, 1269, 1175, 1081, 987, 894, 802, 710, 620, 532, 447, 368, 298, 246, 204, 165, 131, 100, 74, 52, 35, 23, 16, 14, 17, 25, 38, 55, 77, 104, 135, 171, 210, 253, 299, 349, 402, 457, 515, 576, 639, 703, 770, 839, 909, 981, 1054, 1129, 1204,
+    1830, 1734, 1638, 1542, 1447, 1351, 1256, 1160, 1065, 970, 875, 780, 686, 592, 499, 407, 317, 233, 163, 118, 77, 41, 9, -19, -42, -59, -72, -80, -82, -79, -71, -57, -39, -15, 13, 46, 83, 124, 168, 217, 268, 323, 380, 440, 503, 568, 634, 703, 774, 846, 919, 994, 1070, 1147,
+    1825, 1729, 1633, 1537, 1441, 1345, 1249, 1153, 1057, 962, 866, 770, 674, 578, 482, 387, 291, 196, 103, 32, -10, -49, -82, -111, -135, -154, -168, -176, -178, -175, -166, -152, -132, -107, -78, -44, -5, 38, 85, 135, 189, 246, 305, 367, 432, 499, 567, 638, 710, 784, 859, 935, 1013, 1092,
+    1826, 1730, 1634, 1538, 1442, 1346, 1250, 1154, 1059, 963, 867, 771, 676, 580, 485, 390, 295, 202, 114, 35, -46, -128, -173, -203, -229, -249, -263, -271, -274, -271, -261, -246, -225, -199, -168, -132, -91, -46, 3, 55, 111, 170, 232, 296, 363, 432, 502, 575, 649, 724, 801, 879, 958, 1038,
+    1832, 1736, 1640, 1545, 1449, 1354, 1259, 1163, 1068, 974, 879, 785, 691, 598, 506, 415, 329, 248, 168, 86, 3, -69, -104, -141, -182, -225, -270, -318, -368, -366, -356, -340, -318, -291, -258, -219, -176, -129, -78, -23, 35, 97, 161, 227, 296, 367, 440, 514, 590, 667, 746, 825, 905, 985,
+    1842, 1747, 1652, 1557, 1463, 1368, 1274, 1180, 1087, 993, 901, 809, 719, 630, 543, 460, 381, 300, 218, 134, 56, 21, -15, -54, -96, -140, -187, -236, -287, -341, -396, -434, -411, -381, -346, -306, -260, -211, -157, -100, -39, 25, 91, 160, 231, 304, 379, 455, 533, 612, 692, 772, 853, 934,
+    1858, 1764, 1670, 1576, 1482, 1389, 1297, 1204, 1113, 1022, 932, 844, 758, 674, 594, 514, 432, 349, 265, 191, 144, 110, 73, 33, -10, -56, -104, -154, -207, -262, -319, -378, -439, -471, -434, -391, -343, -291, -234, -174, -111, -44, 25, 96, 169, 244, 321, 400, 479, 559, 639, 720, 802, 884,
+    1878, 1785, 1692, 1600, 1508, 1416, 1326, 1236, 1147, 1059, 972, 888, 806, 727, 646, 563, 479, 398, 326, 270, 234, 199, 161, 119, 75, 28, -22, -74, -128, -185, -244, -304, -366, -430, -496, -475, -424, -369, -309, -246, -180, -111, -40, 34, 110, 187, 266, 346, 426, 507, 588, 670, 753, 836,
+    1903, 1811, 1720, 1629, 1539, 1449, 1361, 1273, 1187, 1102, 1020, 940, 860, 777, 693, 611, 533, 462, 402, 357, 324, 287, 248, 205, 159, 110, 59, 5, -51, -109, -169, -231, -295, -360, -428, -496, -503, -444, -382, -316, -247, -175, -101, -25, 54, 133, 213, 293, 374, 456, 539, 622, 705, 789,
+    1933, 1842, 1753, 1663, 1575, 1488, 1402, 1317, 1234, 1153, 1073, 992, 908, 824, 744, 668, 598, 536, 485, 448, 413, 375, 334, 289, 242, 192, 139, 84, 26, -34, -96, -159, -225, -292, -360, -430, -502, -517, -452, -382, -310, -236, -159, -80, -1, 80, 161, 242, 324, 407, 491, 574, 659, 744,
+    1966, 1878, 1790, 1703, 1616, 1531, 1448, 1366, 1286, 1206, 1122, 1038, 957, 878, 803, 734, 670, 615, 571, 538, 502, 462, 419, 373, 324, 272, 218, 161, 101, 40, -24, -89, -156, -225, -295, -366, -439, -513, -518, -445, -370, -293, -213, -132, -49, 28, 110, 193, 276, 360, 444, 529, 614, 700,
+    2004, 1917, 1831, 1746, 1662, 1580, 1499, 1419, 1337, 1253, 1170, 1090, 1013, 939, 869, 805, 748, 699, 661, 627, 590, 548, 504, 456, 405, 351, 295, 236, 175, 112, 47, -20, -89, -159, -231, -304, -378, -454, -531, -504, -426, -345, -263, -184, -104, -21, 62, 146, 230, 314, 400, 485, 571, 658,
+    2046, 1961, 1876, 1794, 1712, 1632, 1551, 1467, 1384, 1303, 1224, 1148, 1074, 1005, 940, 881, 829, 786, 751, 716, 677, 634, 587, 538, 485, 429, 371, 310, 248, 182, 116, 47, -24, -96, -169, -244, -319, -396, -474, -553, -477, -395, -318, -235, -152, -69, 15, 100, 185, 271, 357, 443, 530, 617,
+    2091, 2008, 1926, 1845, 1765, 1682, 1598, 1516, 1436, 1358, 1283, 1210, 1141, 1076, 1016, 961, 914, 874, 841, 804, 763, 718, 670, 618, 563, 506, 446, 383, 318, 251, 182, 112, 40, -34, -109, -185, -262, -341, -420, -500, -529, -449, -367, -283, -199, -115, -30, 56, 142, 229, 316, 403, 491, 579,
+    2139, 2058, 1978, 1896, 1812, 1730, 1649, 1570, 1493, 1418, 1346, 1277, 1211, 1150, 1094, 1044, 1000, 964, 930, 891, 848, 802, 751, 697, 641, 581, 519, 454, 387, 318, 248, 175, 101, 26, -51, -128, -207, -287, -368, -450, -532, -498, -414, -329, -244, -159, -73, 14, 101, 188, 276, 364, 453, 542,
+    2191, 2111, 2027, 1944, 1862, 1782, 1704, 1628, 1553, 1481, 1412, 1347, 1285, 1227, 1175, 1128, 1088, 1055, 1018, 978, 933, 884, 831, 775, 716, 654, 590, 523, 454, 383, 310, 236, 161, 84, 5, -74, -154, -236, -318, -401, -485, -544, -459, -373, -287, -201, -114, -26, 62, 150, 239, 328, 417, 507,
+    2241, 2158, 2076, 1995, 1916, 1838, 1762, 1689, 1617, 1548, 1482, 1420, 1361, 1307, 1258, 1215, 1178, 1144, 1106, 1063, 1016, 964, 909, 851, 789, 725, 659, 590, 519, 446, 371, 295, 218, 139, 59, -22, -104, -187, -270, -354, -439, -525, -502, -415, -328, -240, -152, -64, 25, 114, 203, 293, 383, 473,
+    2290, 2209, 2129, 2050, 1973, 1897, 1824, 1753, 1684, 1618, 1555, 1496, 1440, 1389, 1343, 1303, 1268, 1233, 1192, 1147, 1097, 1043, 986, 925, 861, 794, 725, 654, 581, 506, 429, 351, 272, 192, 110, 28, -56, -140, -225, -310, -396, -483, -543, -455, -367, -278, -189, -100, -10, 80, 170, 260, 351, 442,
+    2341, 2262, 2184, 2107, 2033, 1959, 1888, 1820, 1754, 1690, 1630, 1574, 1521, 1473, 1429, 1391, 1358, 1321, 1278, 1230, 1177, 1121, 1060, 997, 930, 861, 789, 716, 641, 563, 485, 405, 324, 242, 159, 75, -10, -96, -182, -269, -356, -444, -532, -492, -403, -314, -224, -134, -43, 48, 139, 230, 321, 413,
+    2396, 2318, 2242, 2168, 2095, 2024, 1955, 1889, 1826, 1765, 1707, 1653, 1603, 1558, 1517, 1481, 1447, 1407, 1361, 1311, 1255, 1195, 1132, 1066, 997, 925, 851, 775, 697, 618, 538, 456, 373, 289, 205, 119, 33, -54, -141, -229, -318, -407, -496, -527, -437, -347, -256, -165, -74, 18, 109, 201, 293, 385,
+    2453, 2377, 2303, 2230, 2160, 2091, 2025, 1961, 1900, 1841, 1786, 1735, 1687, 1644, 1605, 1571, 1535, 1492, 1443, 1389, 1331, 1268, 1202, 1132, 1060, 986, 909, 831, 751, 670, 587, 504, 419, 334, 248, 161, 73, -15, -104, -193, -283, -372, -463, -553, -469, -377, -286, -194, -102, -10, 82, 175, 267, 360,
+    2512, 2438, 2366, 2296, 2227, 2160, 2096, 2035, 1976, 1920, 1867, 1818, 1772, 1731, 1695, 1661, 1622, 1575, 1523, 1466, 1403, 1337, 1268, 1195, 1121, 1043, 964, 884, 802, 718, 634, 548, 462, 375, 287, 199, 110, 21, -69, -159, -250, -341, -432, -523, -498, -406, -314, -221, -129, -36, 57, 150, 243, 337,
+    2574, 2502, 2431, 2363, 2296, 2232, 2170, 2110, 2053, 1999, 1949, 1902, 1859, 1819, 1784, 1750, 1707, 1657, 1600, 1539, 1473, 1403, 1331, 1255, 1177, 1097, 1016, 933, 848, 763, 677, 590, 502, 413, 324, 234, 144, 54, -37, -128, -220, -312, -404, -496, -524, -432, -339, -246, -152, -59, 34, 128, 222, 316,
+    2637, 2567, 2498, 2432, 2367, 2305, 2245, 2187, 2132, 2081, 2032, 1987, 1946, 1908, 1875, 1836, 1789, 1735, 1675, 1609, 1539, 1466, 1389, 1311, 1230, 1147, 1063, 978, 891, 804, 716, 627, 538, 448, 357, 266, 175, 84, -8, -101, -193, -286, -378, -472, -548, -455, -361, -268, -174, -80, 14, 108, 202, 296,
+    2703, 2634, 2568, 2503, 2440, 2379, 2321, 2266, 2213, 2163, 2117, 2073, 2034, 1998, 1964, 1921, 1869, 1810, 1745, 1675, 1600, 1523, 1443, 1361, 1278, 1192, 1106, 1018, 930, 841, 751, 661, 570, 479, 387, 295, 203, 110, 17, -76, -169, -262, -356, -450, -543, -476, -381, -287, -193, -99, -4, 90, 185, 280,
+    2770, 2703, 2638, 2575, 2514, 2456, 2399, 2346, 2295, 2247, 2202, 2160, 2122, 2088, 2051, 2003, 1945, 1880, 1810, 1735, 1657, 1575, 1492, 1407, 1321, 1233, 1144, 1055, 964, 874, 782, 690, 598, 506, 413, 320, 227, 133, 40, -54, -148, -242, -336, -430, -525, -494, -399, -304, -210, -115, -20, 75, 170, 265,
+    2839, 2774, 2711, 2649, 2590, 2533, 2479, 2427, 2377, 2331, 2288, 2248, 2211, 2178, 2135, 2080, 2016, 1945, 1869, 1789, 1707, 1622, 1535, 1447, 1358, 1268, 1177, 1086, 994, 902, 809, 716, 623, 529, 435, 342, 248, 153, 59, -35, -130, -225, -319, -414, -509, -509, -414, -319, -224, -129, -33, 62, 157, 252,
+    2909, 2846, 2784, 2725, 2667, 2612, 2559, 2509, 2461, 2416, 2375, 2336, 2301, 2266, 2215, 2152, 2080, 2003, 1921, 1836, 1750, 1661, 1571, 1481, 1389, 1297, 1205, 1112, 1018, 925, 831, 737, 643, 548, 454, 359, 265, 170, 75, -20, -115, -210, -306, -401, -496, -521, -426, -331, -235, -140, -44, 51, 147, 242,
+    2959, 2919, 2859, 2801, 2745, 2692, 2640, 2592, 2546, 2503, 2462, 2425, 2392, 2349, 2288, 2215, 2135, 2051, 1964, 1875, 1784, 1693, 1600, 1508, 1414, 1321, 1227, 1132, 1038, 943, 848, 754, 659, 563, 468, 373, 278, 182, 87, -8, -104, -199, -295, -390, -486, -531, -436, -340, -244, -149, -53, 43, 139, 234,
+    2864, 2850, 2838, 2830, 2825, 2773, 2723, 2676, 2631, 2589, 2551, 2515, 2480, 2424, 2349, 2266, 2178, 2088, 1996, 1903, 1810, 1716, 1622, 1527, 1432, 1337, 1242, 1147, 1052, 956, 861, 765, 670, 574, 479, 383, 287, 192, 96, 0, -96, -191, -287, -383, -479, -538, -443, -347, -251, -155, -59, 37, 133, 229,
+    2769, 2755, 2743, 2735, 2730, 2728, 2730, 2735, 2717, 2677, 2639, 2605, 2559, 2480, 2391, 2299, 2206, 2111, 2016, 1921, 1826, 1730, 1635, 1539, 1443, 1348, 1252, 1156, 1060, 964, 869, 773, 677, 581, 485, 389, 293, 197, 101, 5, -91, -187, -283, -378, -474, -543, -447, -351, -255, -159, -63, 33, 129, 225,
+    2675, 2660, 2647, 2639, 2634, 2632, 2634, 2639, 2648, 2660, 2676, 2695, 2599, 2503, 2407, 2311, 2215, 2119, 2023, 1927, 1831, 1735, 1639, 1543, 1447, 1351, 1255, 1159, 1063, 967, 871, 775, 679, 583, 487, 391, 295, 199, 103, 7, -89, -185, -281, -377, -473, -544, -448, -352, -256, -160, -64, 32, 128, 224,
+    2581, 2565, 2552, 2543, 2538, 2536, 2538, 2544, 2553, 2565, 2582, 2599, 2559, 2480, 2391, 2299, 2206, 2111, 2016, 1921, 1826, 1730, 1635, 1539, 1443, 1348, 1252, 1156, 1060, 964, 869, 773, 677, 581, 485, 389, 293, 197, 101, 5, -91, -187, -283, -378, -474, -543, -447, -351, -255, -159, -63, 33, 129, 225,
+    2486, 2470, 2457, 2447, 2442, 2440, 2442, 2448, 2457, 2471, 2487, 2503, 2480, 2424, 2349, 2266, 2178, 2088, 1996, 1903, 1810, 1716, 1622, 1527, 1432, 1337, 1242, 1147, 1052, 956, 861, 765, 670, 574, 479, 383, 287, 192, 96, 0, -96, -191, -287, -383, -479, -538, -443, -347, -251, -155, -59, 37, 133, 229,
+    2392, 2375, 2361, 2352, 2346, 2344, 2346, 2352, 2362, 2376, 2393, 2407, 2391, 2349, 2288, 2215, 2135, 2051, 1964, 1875, 1784, 1693, 1600, 1508, 1414, 1321, 1227, 1132, 1038, 943, 848, 754, 659, 563, 468, 373, 278, 182, 87, -8, -104, -199, -295, -390, -486, -531, -436, -340, -244, -149, -53, 43, 139, 234,
+    2298, 2280, 2266, 2256, 2250, 2248, 2250, 2257, 2267, 2281, 2299, 2311, 2299, 2266, 2215, 2152, 2080, 2003, 1921, 1836, 1750, 1661, 1571, 1481, 1389, 1297, 1205, 1112, 1018, 925, 831, 737, 643, 548, 454, 359, 265, 170, 75, -20, -113, -207, -302, -398, -493, -521, -426, -331, -235, -140, -44, 51, 147, 242,
+    2204, 2186, 2171, 2160, 2154, 2152, 2154, 2161, 2172, 2187, 2206, 2215, 2206, 2178, 2135, 2080, 2016, 1945, 1869, 1789, 1707, 1622, 1535, 1447, 1358, 1268, 1177, 1086, 994, 902, 809, 716, 623, 529, 435, 342, 248, 153, 59, -35, -130, -225, -319, -414, -508, -509, -414, -319, -224, -129, -33, 62, 157, 252,
+    2111, 2091, 2076, 2065, 2058, 2056, 2058, 2065, 2077, 2092, 2111, 2119, 2111, 2088, 2051, 2003, 1945, 1880, 1810, 1735, 1657, 1575, 1492, 1407, 1321, 1233, 1144, 1055, 964, 874, 782, 690, 598, 506, 413, 320, 227, 133, 40, -54, -148, -242, -336, -430, -525, -494, -399, -304, -210, -115, -20, 75, 170, 265,
+    2017, 1997, 1981, 1969, 1962, 1960, 1963, 1970, 1982, 1998, 2016, 2023, 2016, 1996, 1964, 1921, 1869, 1810, 1745, 1675, 1600, 1523, 1443, 1361, 1278, 1192, 1106, 1018, 930, 841, 751, 661, 570, 479, 387, 295, 203, 110, 17, -76, -169, -262, -356, -450, -543, -476, -381, -287, -193, -99, -4, 90, 185, 280,
+    1924, 1903, 1886, 1874, 1866, 1864, 1867, 1874, 1887, 1904, 1921, 1927, 1921, 1903, 1875, 1836, 1789, 1735, 1675, 1609, 1539, 1466, 1389, 1311, 1230, 1147, 1063, 978, 891, 804, 716, 627, 538, 448, 357, 266, 175, 84, -8, -101, -193, -282, -375, -469, -548, -455, -361, -268, -174, -80, 14, 108, 202, 296,
+    1831, 1809, 1791, 1778, 1771, 1768, 1771, 1779, 1792, 1810, 1826, 1831, 1826, 1810, 1784, 1750, 1707, 1657, 1600, 1539, 1473, 1403, 1331, 1255, 1177, 1097, 1016, 933, 848, 763, 677, 590, 502, 413, 324, 234, 144, 54, -37, -128, -220, -312, -404, -495, -524, -432, -339, -246, -152, -59, 34, 128, 222, 316,
+    1739, 1715, 1696, 1683, 1675, 1672, 1675, 1683, 1697, 1716, 1730, 1735, 1730, 1716, 1693, 1661, 1622, 1575, 1523, 1466, 1403, 1337, 1268, 1195, 1121, 1043, 964, 884, 802, 718, 634, 548, 462, 375, 287, 199, 110, 21, -69, -159, -250, -341, -432, -523, -498, -406, -314, -221, -129, -36, 57, 150, 243, 337,
+    1647, 1622, 1602, 1587, 1579, 1576, 1579, 1588, 1603, 1622, 1635, 1639, 1635, 1622, 1600, 1571, 1535, 1492, 1443, 1389, 1331, 1268, 1202, 1132, 1060, 986, 909, 831, 751, 670, 587, 504, 419, 334, 248, 161, 73, -15, -104, -193, -283, -372, -463, -553, -469, -377, -286, -194, -102, -10, 82, 175, 267, 360,
+    1555, 1528, 1507, 1492, 1483, 1480, 1483, 1493, 1508, 1527, 1539, 1543, 1539, 1527, 1508, 1481, 1447, 1407, 1361, 1311, 1255, 1195, 1132, 1066, 997, 925, 851, 775, 697, 618, 538, 456, 373, 289, 205, 119, 33, -54, -141, -229, -318, -407, -496, -527, -437, -347, -256, -165, -74, 18, 109, 201, 293, 385,
+    1464, 1436, 1413, 1397, 1387, 1384, 1388, 1398, 1414, 1432, 1443, 1447, 1443, 1432, 1414, 1389, 1358, 1321, 1278, 1230, 1177, 1121, 1060, 997, 930, 861, 789, 716, 641, 563, 485, 405, 324, 242, 159, 75, -10, -96, -182, -269, -356, -444, -532, -492, -403, -314, -224, -134, -43, 48, 139, 230, 321, 413,
+    1374, 1343, 1319, 1302, 1291, 1288, 1292, 1303, 1321, 1337, 1348, 1351, 1348, 1337, 1321, 1297, 1268, 1233, 1192, 1147, 1097, 1043, 986, 925, 861, 794, 725, 654, 581, 506, 429, 351, 272, 192, 110, 28, -56, -140, -225, -310, -396, -483, -543, -455, -367, -278, -189, -100, -10, 80, 170, 260, 351, 442,
+    1284, 1252, 1226, 1207, 1196, 1192, 1196, 1208, 1227, 1242, 1252, 1255, 1252, 1242, 1227, 1205, 1177, 1144, 1106, 1063, 1016, 964, 909, 851, 789, 725, 659, 590, 519, 446, 371, 295, 218, 139, 59, -22, -104, -187, -270, -354, -439, -525, -502, -415, -328, -240, -152, -64, 25, 114, 203, 293, 383, 473,
+    1195, 1160, 1133, 1112, 1100, 1096, 1101, 1113, 1132, 1147, 1156, 1159, 1156, 1147, 1132, 1112, 1086, 1055, 1018, 978, 933, 884, 831, 775, 716, 654, 590, 523, 454, 383, 310, 236, 161, 84, 5, -74, -154, -236, -318, -401, -485, -544, -459, -373, -287, -201, -114, -26, 62, 150, 239, 328, 417, 507,
+    1108, 1070, 1040, 1018, 1004, 1000, 1005, 1019, 1038, 1052, 1060, 1063, 1060, 1052, 1038, 1018, 994, 964, 930, 891, 848, 802, 751, 697, 641, 581, 519, 454, 387, 318, 248, 175, 101, 26, -51, -128, -207, -287, -368, -450, -532, -498, -414, -329, -244, -159, -73, 14, 101, 188, 276, 364, 453, 542,
+    1022, 981, 948, 924, 909, 904, 910, 925, 943, 956, 964, 967, 964, 956, 943, 925, 902, 874, 841, 804, 763, 718, 670, 618, 563, 506, 446, 383, 318, 251, 182, 112, 40, -34, -109, -185, -262, -341, -420, -500, -531, -449, -367, -283, -199, -115, -30, 56, 142, 229, 316, 403, 491, 579,
+    938, 893, 857, 830, 813, 808, 814, 831, 848, 861, 869, 871, 869, 861, 848, 831, 809, 782, 751, 716, 677, 634, 587, 538, 485, 429, 371, 310, 248, 182, 116, 47, -24, -96, -169, -244, -319, -396, -474, -553, -480, -399, -318, -235, -152, -69, 15, 100, 185, 271, 357, 443, 530, 617,
+    857, 808, 767, 737, 718, 712, 719, 737, 754, 765, 773, 775, 773, 765, 754, 737, 716, 690, 661, 627, 590, 548, 504, 456, 405, 351, 295, 236, 175, 112, 47, -20, -89, -159, -231, -304, -378, -454, -531, -505, -426, -347, -266, -185, -104, -21, 62, 146, 230, 314, 400, 485, 571, 658,
+    778, 724, 679, 644, 623, 616, 624, 643, 659, 670, 677, 679, 677, 670, 659, 643, 623, 598, 570, 538, 502, 462, 419, 373, 324, 272, 218, 161, 101, 40, -24, -89, -156, -225, -295, -366, -439, -513, -524, -448, -371, -293, -213, -134, -53, 28, 110, 193, 276, 360, 444, 529, 614, 700,
+    696, 645, 593, 553, 528, 520, 529, 548, 563, 574, 581, 583, 581, 574, 563, 548, 529, 506, 479, 448, 413, 375, 334, 289, 242, 192, 139, 84, 26, -34, -96, -159, -225, -292, -360, -430, -502, -538, -464, -390, -314, -237, -159, -80, -1, 80, 161, 242, 324, 407, 491, 574, 659, 744,
+    612, 564, 511, 464, 434, 424, 435, 454, 468, 479, 485, 487, 485, 479, 468, 454, 435, 413, 387, 357, 324, 287, 248, 205, 159, 110, 59, 5, -51, -109, -169, -231, -295, -360, -428, -496, -547, -476, -403, -329, -255, -179, -102, -25, 54, 133, 213, 293, 374, 456, 539, 622, 705, 789,
+    529, 482, 432, 379, 341, 328, 342, 359, 373, 383, 389, 391, 389, 383, 373, 359, 342, 320, 295, 266, 234, 199, 161, 119, 75, 28, -22, -74, -128, -185, -244, -304, -366, -430, -496, -550, -481, -411, -340, -268, -194, -120, -44, 32, 109, 187, 266, 346, 426, 507, 588, 670, 753, 836,
+    452, 397, 350, 298, 250, 232, 248, 265, 278, 287, 293, 295, 293, 287, 278, 265, 248, 227, 203, 175, 144, 110, 73, 33, -10, -56, -104, -154, -207, -262, -319, -378, -439, -502, -547, -481, -414, -345, -276, -204, -132, -59, 15, 90, 166, 243, 321, 400, 479, 559, 639, 720, 802, 884,
+    382, 317, 267, 218, 165, 136, 153, 170, 182, 192, 197, 199, 197, 192, 182, 170, 153, 133, 110, 84, 54, 21, -15, -54, -96, -140, -187, -236, -287, -341, -396, -454, -513, -538, -476, -411, -345, -278, -210, -140, -69, 3, 76, 150, 225, 301, 378, 455, 533, 612, 692, 772, 853, 934,
+    327, 247, 183, 136, 85, 40, 59, 75, 87, 96, 101, 103, 101, 96, 87, 75, 59, 40, 17, -8, -37, -69, -104, -141, -182, -225, -270, -318, -368, -420, -474, -531, -524, -464, -403, -340, -276, -210, -142, -74, -4, 67, 139, 211, 285, 360, 436, 512, 589, 667, 746, 825, 905, 985,
+    293, 200, 113, 53, 4, -48, -35, -20, -8, 0, 5, 7, 5, 0, -8, -20, -35, -54, -76, -101, -128, -159, -193, -229, -269, -310, -354, -401, -450, -500, -553, -505, -448, -390, -329, -268, -204, -140, -74, -7, 62, 132, 202, 274, 347, 420, 495, 570, 646, 723, 801, 879, 958, 1038,
+    289, 194, 102, 20, -57, -128, -130, -115, -104, -96, -91, -89, -91, -96, -104, -115, -130, -148, -169, -193, -220, -250, -283, -318, -356, -396, -439, -485, -532, -531, -480, -426, -371, -314, -255, -194, -132, -69, -4, 62, 129, 198, 267, 338, 409, 482, 556, 630, 705, 781, 858, 935, 1013, 1092,
+    316, 232, 154, 78, 3, -70, -141, -209, -199, -191, -187, -185, -187, -191, -199, -210, -225, -242, -262, -286, -312, -341, -372, -407, -444, -483, -525, -544, -496, -446, -399, -347, -293, -237, -179, -120, -59, 3, 67, 132, 198, 265, 333, 403, 473, 545, 617, 691, 765, 840, 916, 992, 1069, 1147,
+    366, 288, 212, 138, 65, -5, -73, -139, -202, -262, -283, -281, -283, -287, -295, -306, -319, -336, -356, -378, -404, -432, -463, -496, -532, -534, -499, -459, -414, -364, -318, -266, -213, -159, -102, -44, 15, 76, 139, 202, 267, 333, 401, 469, 539, 609, 680, 753, 826, 900, 975, 1050, 1126, 1203,
+    423, 347, 273, 201, 131, 62, -4, -67, -128, -185, -240, -290, -337, -379, -390, -401, -414, -430, -450, -472, -496, -519, -509, -493, -471, -443, -410, -372, -329, -282, -231, -185, -134, -80, -25, 32, 90, 150, 211, 274, 338, 403, 469, 536, 605, 674, 745, 816, 888, 961, 1035, 1110, 1185, 1261,
+    482, 409, 337, 266, 198, 132, 68, 7, -51, -107, -158, -207, -251, -291, -326, -356, -382, -401, -416, -424, -426, -423, -414, -399, -378, -352, -321, -285, -244, -199, -150, -104, -53, -1, 54, 109, 166, 225, 285, 347, 409, 473, 539, 605, 672, 741, 810, 880, 952, 1024, 1096, 1170, 1245, 1320,
+    544, 472, 402, 334, 268, 204, 142, 83, 27, -26, -76, -122, -164, -202, -236, -264, -288, -307, -320, -328, -330, -327, -318, -304, -285, -260, -231, -196, -158, -115, -68, -18, 28, 80, 133, 187, 243, 301, 360, 420, 482, 545, 609, 674, 741, 808, 876, 946, 1016, 1087, 1159, 1232, 1305, 1380,
+    608, 538, 470, 403, 339, 277, 217, 161, 107, 56, 8, -36, -76, -113, -145, -172, -194, -212, -225, -232, -234, -231, -223, -210, -191, -168, -140, -107, -70, -29, 15, 62, 110, 161, 213, 266, 321, 378, 436, 495, 556, 617, 680, 745, 810, 876, 944, 1012, 1081, 1152, 1223, 1294, 1367, 1440,
+    674, 605, 539, 475, 412, 352, 295, 240, 187, 138, 93, 50, 12, -23, -53, -79, -101, -117, -129, -136, -138, -136, -128, -115, -97, -75, -48, -17, 18, 57, 100, 146, 193, 242, 293, 346, 400, 455, 512, 570, 630, 691, 753, 816, 880, 946, 1012, 1080, 1148, 1217, 1287, 1358, 1430, 1502,
+    741, 675, 610, 547, 487, 429, 373, 320, 270, 222, 178, 138, 101, 68, 39, 14, -6, -22, -34, -40, -42, -40, -32, -20, -3, 18, 43, 73, 107, 144, 185, 230, 276, 324, 374, 426, 479, 533, 589, 646, 705, 765, 826, 888, 952, 1016, 1081, 1148, 1215, 1284, 1353, 1423, 1494, 1565,
+    810, 746, 683, 622, 563, 507, 453, 401, 353, 307, 265, 226, 191, 159, 131, 108, 88, 73, 62, 55, 54, 56, 63, 75, 91, 111, 135, 164, 196, 232, 272, 314, 360, 407, 456, 507, 559, 612, 667, 723, 781, 840, 900, 961, 1024, 1087, 1152, 1217, 1284, 1351, 1419, 1489, 1559, 1629,
+    881, 818, 757, 697, 640, 586, 533, 484, 437, 393, 352, 315, 281, 251, 224, 201, 182, 168, 157, 151, 150, 152, 159, 170, 185, 205, 228, 255, 286, 321, 359, 400, 444, 491, 539, 588, 639, 692, 746, 801, 858, 916, 975, 1035, 1096, 1159, 1223, 1287, 1353, 1419, 1487, 1555, 1624, 1694,
+    953, 892, 832, 774, 719, 666, 615, 567, 522, 480, 440, 404, 372, 342, 317, 295, 277, 263, 253, 247, 246, 248, 254, 265, 280, 298, 321, 347, 377, 410, 446, 486, 529, 574, 622, 670, 720, 772, 825, 879, 935, 992, 1050, 1110, 1170, 1232, 1294, 1358, 1423, 1489, 1555, 1623, 1691, 1760,
+};
+
+#endif
@@ -0,0 +1,49 @@
+#include "arm_servo.h"
+#include "arm_config.h"
+#include ARM_SERVO_TABLE
+
+// Table entries live in flash on the AVR
+#define ENTRY(table, i) ((int)ARM_FLASH_READ_U16(&(table)[i]))
+
+#define MAX_ANGLE ((SERVO_TABLE_POINTS - 1) << SERVO_ANGLE_SHIFT)
+
+int servo_angle_to_pulse(int servo_num, servo_angle_t angle) {
+    if (angle < 0) angle = 0;
+    if (angle > MAX_ANGLE) angle = MAX_ANGLE;
+
+    const uint16_t *table = servo_pulse_table[servo_num];
+    int i = angle >> SERVO_ANGLE_SHIFT;
+    int frac = angle & (SERVO_ANGLE_ONE - 1);
+    if (frac == 0) return ENTRY(table, i);  // Also keeps 180 degrees from reading past the end
+
+    int step = ENTRY(table, i + 1) - ENTRY(table, i);
+    return ENTRY(table, i) + ((step * frac + SERVO_ANGLE_ONE / 2) >> SERVO_ANGLE_SHIFT);
+}
+
+int angle_to_pulse(int servo_num, int angle) {
+    if (angle < 0) angle = 0;
+    if (angle > SERVO_TABLE_POINTS - 1) angle = SERVO_TABLE_POINTS - 1;
+    return ENTRY(servo_pulse_table[servo_num], angle);
+}
+
+int angle_to_pulse_f(int servo_num, float angle) {
+    return servo_angle_to_pulse(servo_num, SERVO_ANGLE_FROM_FLOAT(angle));
+}
+
+// Off the hot path: binary search for the degree, then blend
+float pulse_to_angle(int servo_num, int pulse) {
+    const uint16_t *table = servo_pulse_table[servo_num];
+    if (pulse <= ENTRY(table, 0)) return 0.0f;
+    if (pulse >= ENTRY(table, SERVO_TABLE_POINTS - 1)) return SERVO_TABLE_POINTS - 1;
+
+    int lo = 0, hi = SERVO_TABLE_POINTS - 1;
+    while (hi - lo > 1) {
+        int mid = (lo + hi) / 2;
+        if (ENTRY(table, mid) <= pulse) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo + (float)(pulse - ENTRY(table, lo)) / (ENTRY(table, hi) - ENTRY(table, lo));
+}
@@ -0,0 +1,44 @@
+#ifndef ARM_SERVO_H
+#define ARM_SERVO_H
+
+/*
+ * Servo angle to PWM level conversion (Pico counts, ~0.512us each).
+ *
+ * Each joint has its own calibration table, one entry per degree with the
+ * servo's correction curve baked in (arm_servo_table.h, generated by
+ * tools/gen_servo_table.c). Current calibration:
+ *   MG995 (0-2):          0°=750, 180°=4600
+ *   SG90 #3 (3, roll):    0°=850, 180°=4650
+ *   SG90 (4, pitch):      0°=700, 180°=4550
+ *
+ * Sub-degree angles are blended between neighbouring entries with a
+ * multiply and a shift, no division. Angles outside 0-180 are clamped.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fixed-point servo angle, 1/256 degree
+typedef int32_t servo_angle_t;
+#define SERVO_ANGLE_SHIFT 8
+#define SERVO_ANGLE_ONE   (1 << SERVO_ANGLE_SHIFT)
+#define SERVO_ANGLE_FROM_FLOAT(f) ((servo_angle_t)((f) * SERVO_ANGLE_ONE + 0.5f))
+
+int servo_angle_to_pulse(int servo_num, servo_angle_t angle);
+
+int angle_to_pulse(int servo_num, int angle);
+
+// Sub-degree version for smoothly integrated angles (rate control)
+int angle_to_pulse_f(int servo_num, float angle);
+
+// Inverse, for reading back where a servo has been sent
+float pulse_to_angle(int servo_num, int pulse);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,91 @@
+// Generated by tools/gen_servo_table.c - do not edit
+// PWM level (Pico counts) per whole degree, calibration curve applied
+
+#ifndef ARM_SERVO_TABLE_H
+#define ARM_SERVO_TABLE_H
+
+#include <stdint.h>
+#include "arm_board.h"
+
+#define SERVO_TABLE_SERVOS 5
+#define SERVO_TABLE_POINTS 181
+
+static const uint16_t servo_pulse_table[SERVO_TABLE_SERVOS][SERVO_TABLE_POINTS] ARM_FLASH = {
+    // 0: base, MG995, 750-4600
+    {
+        750, 771, 793, 814, 836, 857, 878, 900, 921, 943, 964, 985, 1007, 1028, 1049, 1071,
+        1092, 1114, 1135, 1156, 1178, 1199, 1221, 1242, 1263, 1285, 1306, 1328, 1349, 1370, 1392, 1413,
+        1434, 1456, 1477, 1499, 1520, 1541, 1563, 1584, 1606, 1627, 1648, 1670, 1691, 1713, 1734, 1755,
+        1777, 1798, 1819, 1841, 1862, 1884, 1905, 1926, 1948, 1969, 1991, 2012, 2033, 2055, 2076, 2098,
+        2119, 2140, 2162, 2183, 2204, 2226, 2247, 2269, 2290, 2311, 2333, 2354, 2376, 2397, 2418, 2440,
+        2461, 2483, 2504, 2525, 2547, 2568, 2589, 2611, 2632, 2654, 2675, 2696, 2718, 2739, 2761, 2782,
+        2803, 2825, 2846, 2868, 2889, 2910, 2932, 2953, 2974, 2996, 3017, 3039, 3060, 3081, 3103, 3124,
+        3146, 3167, 3188, 3210, 3231, 3253, 3274, 3295, 3317, 3338, 3359, 3381, 3402, 3424, 3445, 3466,
+        3488, 3509, 3531, 3552, 3573, 3595, 3616, 3638, 3659, 3680, 3702, 3723, 3744, 3766, 3787, 3809,
+        3830, 3851, 3873, 3894, 3916, 3937, 3958, 3980, 4001, 4023, 4044, 4065, 4087, 4108, 4129, 4151,
+        4172, 4194, 4215, 4236, 4258, 4279, 4301, 4322, 4343, 4365, 4386, 4408, 4429, 4450, 4472, 4493,
+        4514, 4536, 4557, 4579, 4600,
+    },
+    // 1: shoulder, MG995, 750-4600
+    {
+        750, 771, 793, 814, 836, 857, 878, 900, 921, 943, 964, 985, 1007, 1028, 1049, 1071,
+        1092, 1114, 1135, 1156, 1178, 1199, 1221, 1242, 1263, 1285, 1306, 1328, 1349, 1370, 1392, 1413,
+        1434, 1456, 1477, 1499, 1520, 1541, 1563, 1584, 1606, 1627, 1648, 1670, 1691, 1713, 1734, 1755,
+        1777, 1798, 1819, 1841, 1862, 1884, 1905, 1926, 1948, 1969, 1991, 2012, 2033, 2055, 2076, 2098,
+        2119, 2140, 2162, 2183, 2204, 2226, 2247, 2269, 2290, 2311, 2333, 2354, 2376, 2397, 2418, 2440,
+        2461, 2483, 2504, 2525, 2547, 2568, 2589, 2611, 2632, 2654, 2675, 2696, 2718, 2739, 2761, 2782,
+        2803, 2825, 2846, 2868, 2889, 2910, 2932, 2953, 2974, 2996, 3017, 3039, 3060, 3081, 3103, 3124,
+        3146, 3167, 3188, 3210, 3231, 3253, 3274, 3295, 3317, 3338, 3359, 3381, 3402, 3424, 3445, 3466,
+        3488, 3509, 3531, 3552, 3573, 3595, 3616, 3638, 3659, 3680, 3702, 3723, 3744, 3766, 3787, 3809,
+        3830, 3851, 3873, 3894, 3916, 3937, 3958, 3980, 4001, 4023, 4044, 4065, 4087, 4108, 4129, 4151,
+        4172, 4194, 4215, 4236, 4258, 4279, 4301, 4322, 4343, 4365, 4386, 4408, 4429, 4450, 4472, 4493,
+        4514, 4536, 4557, 4579, 4600,
+    },
+    // 2: elbow, MG995, 750-4600
+    {
+        750, 771, 793, 814, 836, 857, 878, 900, 921, 943, 964, 985, 1007, 1028, 1049, 1071,
+        1092, 1114, 1135, 1156, 1178, 1199, 1221, 1242, 1263, 1285, 1306, 1328, 1349, 1370, 1392, 1413,
+        1434, 1456, 1477, 1499, 1520, 1541, 1563, 1584, 1606, 1627, 1648, 1670, 1691, 1713, 1734, 1755,
+        1777, 1798, 1819, 1841, 1862, 1884, 1905, 1926, 1948, 1969, 1991, 2012, 2033, 2055, 2076, 2098,
+        2119, 2140, 2162, 2183, 2204, 2226, 2247, 2269, 2290, 2311, 2333, 2354, 2376, 2397, 2418, 2440,
+        2461, 2483, 2504, 2525, 2547, 2568, 2589, 2611, 2632, 2654, 2675, 2696, 2718, 2739, 2761, 2782,
+        2803, 2825, 2846, 2868, 2889, 2910, 2932, 2953, 2974, 2996, 3017, 3039, 3060, 3081, 3103, 3124,
+        3146, 3167, 3188, 3210, 3231, 3253, 3274, 3295, 3317, 3338, 3359, 3381, 3402, 3424, 3445, 3466,
+        3488, 3509, 3531, 3552, 3573, 3595, 3616, 3638, 3659, 3680, 3702, 3723, 3744, 3766, 3787, 3809,
+        3830, 3851, 3873, 3894, 3916, 3937, 3958, 3980, 4001, 4023, 4044, 4065, 4087, 4108, 4129, 4151,
+        4172, 4194, 4215, 4236, 4258, 4279, 4301, 4322, 4343, 4365, 4386, 4408, 4429, 4450, 4472, 4493,
+        4514, 4536, 4557, 4579, 4600,
+    },
+    // 3: wrist roll, SG90 #3, 850-4650
+    {
+        850, 871, 892, 913, 934, 956, 977, 998, 1019, 1040, 1061, 1082, 1103, 1124, 1146, 1167,
+        1188, 1209, 1230, 1251, 1272, 1293, 1314, 1336, 1357, 1378, 1399, 1420, 1441, 1462, 1483, 1504,
+        1526, 1547, 1568, 1589, 1610, 1631, 1652, 1673, 1694, 1716, 1737, 1758, 1779, 1800, 1821, 1842,
+        1863, 1884, 1906, 1927, 1948, 1969, 1990, 2011, 2032, 2053, 2074, 2096, 2117, 2138, 2159, 2180,
+        2201, 2222, 2243, 2264, 2286, 2307, 2328, 2349, 2370, 2391, 2412, 2433, 2454, 2476, 2497, 2518,
+        2539, 2560, 2581, 2602, 2623, 2644, 2666, 2687, 2708, 2729, 2750, 2771, 2792, 2813, 2834, 2856,
+        2877, 2898, 2919, 2940, 2961, 2982, 3003, 3024, 3046, 3067, 3088, 3109, 3130, 3151, 3172, 3193,
+        3214, 3236, 3257, 3278, 3299, 3320, 3341, 3362, 3383, 3404, 3426, 3447, 3468, 3489, 3510, 3531,
+        3552, 3573, 3594, 3616, 3637, 3658, 3679, 3700, 3721, 3742, 3763, 3784, 3806, 3827, 3848, 3869,
+        3890, 3911, 3932, 3953, 3974, 3996, 4017, 4038, 4059, 4080, 4101, 4122, 4143, 4164, 4186, 4207,
+        4228, 4249, 4270, 4291, 4312, 4333, 4354, 4376, 4397, 4418, 4439, 4460, 4481, 4502, 4523, 4544,
+        4566, 4587, 4608, 4629, 4650,
+    },
+    // 4: wrist pitch, SG90, 700-4550
+    {
+        700, 721, 743, 764, 786, 807, 828, 850, 871, 893, 914, 935, 957, 978, 999, 1021,
+        1042, 1064, 1085, 1106, 1128, 1149, 1171, 1192, 1213, 1235, 1256, 1278, 1299, 1320, 1342, 1363,
+        1384, 1406, 1427, 1449, 1470, 1491, 1513, 1534, 1556, 1577, 1598, 1620, 1641, 1663, 1684, 1705,
+        1727, 1748, 1769, 1791, 1812, 1834, 1855, 1876, 1898, 1919, 1941, 1962, 1983, 2005, 2026, 2048,
+        2069, 2090, 2112, 2133, 2154, 2176, 2197, 2219, 2240, 2261, 2283, 2304, 2326, 2347, 2368, 2390,
+        2411, 2433, 2454, 2475, 2497, 2518, 2539, 2561, 2582, 2604, 2625, 2646, 2668, 2689, 2711, 2732,
+        2753, 2775, 2796, 2818, 2839, 2860, 2882, 2903, 2924, 2946, 2967, 2989, 3010, 3031, 3053, 3074,
+        3096, 3117, 3138, 3160, 3181, 3203, 3224, 3245, 3267, 3288, 3309, 3331, 3352, 3374, 3395, 3416,
+        3438, 3459, 3481, 3502, 3523, 3545, 3566, 3588, 3609, 3630, 3652, 3673, 3694, 3716, 3737, 3759,
+        3780, 3801, 3823, 3844, 3866, 3887, 3908, 3930, 3951, 3973, 3994, 4015, 4037, 4058, 4079, 4101,
+        4122, 4144, 4165, 4186, 4208, 4229, 4251, 4272, 4293, 4315, 4336, 4358, 4379, 4400, 4422, 4443,
+        4464, 4486, 4507, 4529, 4550,
+    },
+};
+
+#endif
@@ -0,0 +1,179 @@
+#include "arm_telemetry.h"
+#include "arm_frame.h"
+#include "motion_executor.h"
+#include <stddef.h>
+
+#define POLL_SLEEP_US 1000
+
+// Transmit ring: the core 1 sampler only writes head, telemetry_poll() on
+// core 0 only writes tail
+static uint8_t ring[TELEMETRY_RING_SIZE];
+static volatile uint32_t ring_head = 0;
+static volatile uint32_t ring_tail = 0;
+
+// Published by core 0, read by the sampler
+static volatile int16_t target_x = 0;
+static volatile int16_t target_y = 0;
+static volatile int16_t target_z = 0;
+static volatile uint16_t loop_us = 0;
+static volatile uint16_t period_us = 0;
+static uint64_t loop_start_us = 0;
+
+// Loop records: core 0 fills the slot after the published one, then
+// publishes it; the sampler sends each new one
+typedef struct {
+    uint32_t t_us;
+    uint16_t adc[TELEMETRY_ADC_INPUTS];
+    uint16_t pulses[TELEMETRY_SERVOS];
+} loop_record_t;
+
+static loop_record_t records[2];
+static volatile uint32_t records_published = 0;
+
+// Sampler state (core 1)
+static uint16_t seq = 0;
+static uint16_t dropped = 0;
+static uint32_t records_sent = 0;
+
+// Whole frames only; the decoder sees the gap in seq and the count
+static void queue_frame(const uint8_t *payload, int payload_len) {
+    uint8_t frame[FRAME_MAX_ENCODED];
+    int len = frame_encode(payload, payload_len, frame);
+
+    uint32_t head = ring_head;
+    if (TELEMETRY_RING_SIZE - (head - ring_tail) < (uint32_t)len) {
+        if (dropped < 0xFFFF) dropped++;
+        return;
+    }
+    for (int i = 0; i < len; i++) {
+        ring[(head + i) & (TELEMETRY_RING_SIZE - 1)] = frame[i];
+    }
+    dropped = 0;
+
+    // Publish the bytes before the new head
+    hal_memory_barrier();
+    ring_head = head + len;
+}
+
+static void send_loop_record(void) {
+    uint32_t published = records_published;
+    if (published == records_sent) return;
+    hal_memory_barrier();
+
+    const loop_record_t *record = &records[(published - 1) & 1];
+    uint8_t payload[FRAME_MAX_PAYLOAD];
+    uint8_t *p = payload;
+    *p++ = TELEMETRY_FRAME_LOOP;
+    p = frame_put_u16(p, (uint16_t)(published - 1));
+    p = frame_put_u32(p, record->t_us);
+    for (int i = 0; i < TELEMETRY_ADC_INPUTS; i++) {
+        p = frame_put_u16(p, record->adc[i]);
+    }
+    for (int i = 0; i < TELEMETRY_SERVOS; i++) {
+        p = frame_put_u16(p, record->pulses[i]);
+    }
+    queue_frame(payload, (int)(p - payload));
+    records_sent = published;
+}
+
+static bool telemetry_sample(void *user_data) {
+    (void)user_data;
+
+    uint8_t payload[FRAME_MAX_PAYLOAD];
+    uint8_t *p = payload;
+    *p++ = TELEMETRY_FRAME_SAMPLE;
+    p = frame_put_u16(p, seq++);
+    p = frame_put_u32(p, (uint32_t)hal_time_us());
+    p = frame_put_u16(p, dropped);
+    for (int i = 0; i < TELEMETRY_SERVOS; i++) {
+        p = frame_put_u16(p, (uint16_t)motion_executor_level(i));
+    }
+    p = frame_put_u16(p, (uint16_t)target_x);
+    p = frame_put_u16(p, (uint16_t)target_y);
+    p = frame_put_u16(p, (uint16_t)target_z);
+    for (int i = 0; i < TELEMETRY_ADC_INPUTS; i++) {
+        p = frame_put_u16(p, hal_adc_capture_latest(i));
+    }
+    p = frame_put_u16(p, loop_us);
+    p = frame_put_u16(p, period_us);
+    queue_frame(payload, (int)(p - payload));
+
+    send_loop_record();
+    return true;
+}
+
+bool telemetry_start(uint32_t rate_hz) {
+    if (rate_hz == 0) return false;
+    return hal_add_core1_repeating_timer_us(-(int64_t)(1000000 / rate_hz), telemetry_sample, NULL);
+}
+
+static int16_t to_tenth_mm(float mm) {
+    float t = mm * 10.0f;
+    if (t > 32767.0f) t = 32767.0f;
+    if (t < -32768.0f) t = -32768.0f;
+    return (int16_t)(t >= 0.0f ? t + 0.5f : t - 0.5f);
+}
+
+void telemetry_set_target(float x, float y, float z) {
+    target_x = to_tenth_mm(x);
+    target_y = to_tenth_mm(y);
+    target_z = to_tenth_mm(z);
+}
+
+void telemetry_loop_begin(void) {
+    uint64_t now = hal_time_us();
+    if (loop_start_us != 0) {
+        uint64_t period = now - loop_start_us;
+        period_us = (uint16_t)(period > 0xFFFF ? 0xFFFF : period);
+    }
+    loop_start_us = now;
+}
+
+void telemetry_loop_end(void) {
+    uint64_t busy = hal_time_us() - loop_start_us;
+    loop_us = (uint16_t)(busy > 0xFFFF ? 0xFFFF : busy);
+}
+
+void telemetry_record_loop(const uint16_t adc[], int num_adc, const int pulses[TELEMETRY_SERVOS]) {
+    uint32_t next = records_published;
+    loop_record_t *record = &records[next & 1];
+    record->t_us = (uint32_t)loop_start_us;
+    for (int i = 0; i < TELEMETRY_ADC_INPUTS; i++) {
+        record->adc[i] = i < num_adc ? adc[i] : 0;
+    }
+    for (int i = 0; i < TELEMETRY_SERVOS; i++) {
+        record->pulses[i] = (uint16_t)pulses[i];
+    }
+
+    // Slot contents before the count that hands it over
+    hal_memory_barrier();
+    records_published = next + 1;
+}
+
+void telemetry_poll(void) {
+    uint32_t head = ring_head;
+    hal_memory_barrier();
+
+    // At most two contiguous runs: up to the end of the ring, then the rest
+    while (ring_tail != head) {
+        uint32_t start = ring_tail & (TELEMETRY_RING_SIZE - 1);
+        uint32_t run = head - ring_tail;
+        if (run > TELEMETRY_RING_SIZE - start) run = TELEMETRY_RING_SIZE - start;
+
+        uint sent = hal_serial_write_nonblocking(&ring[start], run);
+        if (sent == 0) break;
+
+        // Bytes read before the slot is handed back
+        hal_memory_barrier();
+        ring_tail += sent;
+    }
+}
+
+void telemetry_sleep_until_us(uint64_t t_us) {
+    while (true) {
+        telemetry_poll();
+        uint64_t now = hal_time_us();
+        if (now >= t_us) break;
+        hal_sleep_until_us(t_us - now > POLL_SLEEP_US ? now + POLL_SLEEP_US : t_us);
+    }
+}
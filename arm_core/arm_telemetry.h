@@ -0,0 +1,79 @@
+#ifndef ARM_TELEMETRY_H
+#define ARM_TELEMETRY_H
+
+/*
+ * BINARY TELEMETRY STREAM
+ *
+ * A core 1 timer samples the arm at a fixed rate (200-500Hz) and packs each
+ * sample into a framed binary record in a transmit ring. Core 0 drains the
+ * ring into the serial port a bit at a time with telemetry_poll(), never
+ * waiting on USB; if the host falls behind, whole frames are dropped and
+ * counted rather than the control loop stalling.
+ *
+ * Each record is a [type][payload] frame (arm_frame.h: CRC-16, COBS, zero
+ * delimiters), so printf text on the same port falls between frames and
+ * the decoder can resync on any zero. tools/telemetry_decode.c turns a
+ * capture into CSV.
+ *
+ * TELEMETRY_FRAME_SAMPLE payload, little-endian:
+ *   u16 seq          increments per sample, including dropped ones
+ *   u32 t_us         sample time, low 32 bits of hal_time_us()
+ *   u16 dropped      frames lost to a full ring since the last one sent
+ *   u16 pulse[5]     PWM levels as written by the motion executor
+ *   i16 x, y, z      commanded Cartesian target, 0.1mm
+ *   u16 adc[3]       newest raw ADC samples (hal_adc_capture_latest()):
+ *                    mid-scale, 1 << (HAL_ADC_BITS - 1), for inputs not
+ *                    captured
+ *   u16 loop_us      core 0 time spent in the last control loop pass
+ *   u16 period_us    time between the last two control loop starts
+ *
+ * TELEMETRY_FRAME_LOOP, one per control loop pass, is the session
+ * recording: what the loop read and what it commanded, enough to replay
+ * the session through the same loop in the sim (tools/session_replay.c).
+ *   u16 pass         loop pass number, from 0 at the first recorded pass
+ *   u32 t_us         pass start time
+ *   u16 adc[3]       ADC values the pass read, 0 for inputs it doesn't use
+ *   u16 pulse[5]     PWM levels the pass left queued for each servo
+ */
+
+#include "arm_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TELEMETRY_FRAME_SAMPLE 1
+#define TELEMETRY_FRAME_LOOP   2
+#define TELEMETRY_SERVOS       5
+#define TELEMETRY_ADC_INPUTS   3
+#define TELEMETRY_RING_SIZE    2048  // Must be a power of 2
+#define TELEMETRY_DEFAULT_HZ   250
+
+// Starts sampling at rate_hz on core 1. Call after motion_executor_init()
+// and hal_adc_capture_start().
+bool telemetry_start(uint32_t rate_hz);
+
+// Core 0: what the control loop is commanding, in mm, and its own timing.
+// Call telemetry_loop_begin() at the top of each pass and
+// telemetry_loop_end() once its work is done.
+void telemetry_set_target(float x, float y, float z);
+void telemetry_loop_begin(void);
+void telemetry_loop_end(void);
+
+// Core 0: records the pass for replay, after its moves are queued. The
+// core 1 sampler sends it with its next sample, so passes must be further
+// apart than one sample period.
+void telemetry_record_loop(const uint16_t adc[], int num_adc, const int pulses[TELEMETRY_SERVOS]);
+
+// Core 0: moves queued frames to the serial port without blocking
+void telemetry_poll(void);
+
+// Core 0: hal_sleep_until_us() that keeps draining the ring while it waits,
+// so the stream keeps up with the sample rate between slow loop passes
+void telemetry_sleep_until_us(uint64_t t_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
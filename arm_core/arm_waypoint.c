@@ -0,0 +1,344 @@
+#include "arm_waypoint.h"
+#include "arm_frame.h"
+#include "arm_ik.h"
+#include "arm_line.h"
+#include "arm_reach.h"
+#include "arm_servo.h"
+#include "motion_executor.h"
+#include <string.h>
+
+#define RX_CHUNK 64
+#define TX_SIZE  512
+#define ACK_LEN    (1 + 2 + 1 + 1 + 2)
+#define STATUS_LEN (1 + 2 + 2 + 2 + 4 + 1)
+
+// A solved point, ready for the motion executor
+typedef struct {
+    uint16_t pulses[2];
+    uint16_t duration_ms;
+    bool profiled;
+    bool line;  // Try a line move to x, z first
+    float x, z;
+} solved_point_t;
+
+static int servo_nums[2];
+static waypoint_line_handler_t line_handler;
+
+// Double buffer: commands append to buffers[fill]; the other one was solved
+// into solved[] when it was swapped in and is fed from drain_pos
+static waypoint_t buffers[2][WAYPOINT_BUFFER_POINTS];
+static int fill = 0;
+static int fill_count = 0;
+static solved_point_t solved[WAYPOINT_BUFFER_POINTS];
+static int drain_count = 0;
+static int drain_pos = 0;
+
+// Where the last solved point leaves the arm, for branch selection
+static arm_pose_t last_pose;
+
+static frame_decoder_t decoder;
+static uint8_t rx[RX_CHUNK];
+static int rx_len = 0, rx_pos = 0;
+static bool closed = false;
+static char line[WAYPOINT_LINE_MAX];
+static int line_len = 0;
+
+static uint8_t tx[TX_SIZE];
+static int tx_len = 0;
+
+static bool have_session = false;
+static uint16_t last_seq = 0;  // Last accepted command
+static uint32_t done = 0;      // Points handed to the motion executor
+static int credits_reported = 0;
+static int queued_reported = 0;
+
+int waypoint_credits(void) {
+    return WAYPOINT_BUFFER_POINTS - fill_count;
+}
+
+static int queued_points(void) {
+    return fill_count + drain_count - drain_pos;
+}
+
+static void send(const uint8_t *payload, int len) {
+    uint8_t frame[FRAME_MAX_ENCODED];
+    int n = frame_encode(payload, len, frame);
+    if (tx_len + n > TX_SIZE) return;  // Reading stops before this can happen
+    memcpy(&tx[tx_len], frame, n);
+    tx_len += n;
+}
+
+static void flush_tx(void) {
+    if (tx_len == 0) return;
+    uint sent = hal_serial_write_nonblocking(tx, (uint)tx_len);
+    if (sent > 0) {
+        memmove(tx, &tx[sent], tx_len - sent);
+        tx_len -= (int)sent;
+    }
+}
+
+static void send_ack(uint16_t seq, uint8_t result, uint8_t index) {
+    uint8_t msg[ACK_LEN];
+    uint8_t *p = msg;
+    *p++ = WAYPOINT_MSG_ACK;
+    p = frame_put_u16(p, seq);
+    *p++ = result;
+    *p++ = index;
+    frame_put_u16(p, (uint16_t)waypoint_credits());
+    send(msg, ACK_LEN);
+    credits_reported = waypoint_credits();
+}
+
+static void send_status(void) {
+    uint8_t msg[STATUS_LEN];
+    uint8_t *p = msg;
+    *p++ = WAYPOINT_MSG_STATUS;
+    p = frame_put_u16(p, (uint16_t)(last_seq + 1));
+    p = frame_put_u16(p, (uint16_t)waypoint_credits());
+    p = frame_put_u16(p, (uint16_t)queued_points());
+    p = frame_put_u32(p, done);
+    *p = waypoint_stream_idle();
+    send(msg, STATUS_LEN);
+    credits_reported = waypoint_credits();
+    queued_reported = queued_points();
+}
+
+// Branch selection starts over from where the executor's queued moves
+// leave the arm, with no branch preference
+static void seed_last_pose(void) {
+    arm_pose_t pose = {90.0f, pulse_to_angle(servo_nums[0], motion_executor_planned_level(servo_nums[0])),
+                       pulse_to_angle(servo_nums[1], motion_executor_planned_level(servo_nums[1])),
+                       WRIST_PITCH_STRAIGHT, 0};
+    last_pose = pose;
+}
+
+// The dropped points were solved but never reached, so last_pose goes back
+// to where the arm really ends up
+static void drop_queued(void) {
+    fill_count = 0;
+    drain_pos = drain_count;
+    seed_last_pose();
+}
+
+static bool point_ok(const waypoint_t *point) {
+    if (point->kind != WAYPOINT_JOINT) return reach_map_contains(&arm_reach_2d, point->a, point->b);
+    return point->a >= 0.0f && point->a <= 180.0f && point->b >= 0.0f && point->b <= 180.0f;
+}
+
+bool waypoint_push(const waypoint_t *point) {
+    if (fill_count == WAYPOINT_BUFFER_POINTS || !point_ok(point)) return false;
+    buffers[fill][fill_count++] = *point;
+    return true;
+}
+
+// Solves a whole buffer in one go: IK on the branch closest to the point
+// before (with hysteresis), or straight conversion for joint points
+static void solve_buffer(const waypoint_t *points, int count) {
+    for (int i = 0; i < count; i++) {
+        const waypoint_t *point = &points[i];
+        solved_point_t *out = &solved[i];
+        arm_pose_t pose = last_pose;
+
+        out->line = point->kind == WAYPOINT_LINE;
+        out->x = point->a;
+        out->z = point->b;
+        if (point->kind != WAYPOINT_JOINT) {
+            arm_pose_t poses[ARM_IK_MAX_SOLUTIONS];
+            int count = calculate_2d_ik_branches(point->a, point->b, poses);
+            int pick = arm_ik_select_branch(poses, count, &last_pose);
+
+            // A line stays on the branch it starts on
+            for (int j = 0; out->line && j < count; j++) {
+                if (poses[j].config == last_pose.config) pick = j;
+            }
+            if (pick >= 0) pose = poses[pick];
+        } else {
+            pose.shoulder = point->a;
+            pose.elbow = point->b;
+        }
+
+        // Reconfigurations and duration 0 points get an S-curve
+        out->profiled = point->duration_ms == 0 || arm_pose_travel(&pose, &last_pose) > ARM_IK_CONTINUOUS_DEG;
+        out->duration_ms = point->duration_ms;
+        out->pulses[0] = (uint16_t)angle_to_pulse_f(servo_nums[0], pose.shoulder);
+        out->pulses[1] = (uint16_t)angle_to_pulse_f(servo_nums[1], pose.elbow);
+        last_pose = pose;
+    }
+}
+
+static void feed_executor(void) {
+    while (true) {
+        if (drain_pos == drain_count) {
+            if (fill_count == 0) return;
+
+            // Swap: the filled buffer drains, the drained one takes commands
+            solve_buffer(buffers[fill], fill_count);
+            drain_count = fill_count;
+            drain_pos = 0;
+            fill ^= 1;
+            fill_count = 0;
+        }
+
+        const solved_point_t *point = &solved[drain_pos];
+        if (point->line) {
+            arm_line_result_t result = arm_line_move(servo_nums[0], servo_nums[1], point->x, point->z,
+                                                     MOTION_PROFILE_SCURVE, point->duration_ms);
+            if (result == ARM_LINE_QUEUE_FULL) return;
+            if (result == ARM_LINE_OK) {
+                drain_pos++;
+                done++;
+                continue;
+            }
+        }
+
+        int pulses[2] = {point->pulses[0], point->pulses[1]};
+        bool queued = point->profiled
+                          ? motion_executor_enqueue_profiled(servo_nums, pulses, 2, MOTION_PROFILE_SCURVE,
+                                                             point->duration_ms)
+                          : motion_executor_enqueue(servo_nums, pulses, 2, point->duration_ms);
+        if (!queued) return;
+        drain_pos++;
+        done++;
+    }
+}
+
+static void handle_command(const uint8_t *msg, int len) {
+    if (len < 1) return;
+    if (msg[0] == WAYPOINT_CMD_STATUS) {
+        send_status();
+        return;
+    }
+    if (len < 3) return;
+
+    uint16_t seq = frame_get_u16(msg + 1);
+    if (msg[0] == WAYPOINT_CMD_HELLO) {
+        drop_queued();
+        have_session = true;
+        last_seq = seq;
+        send_ack(seq, WAYPOINT_OK, 0);
+        send_status();
+        return;
+    }
+
+    if (have_session && seq == last_seq) {
+        send_ack(seq, WAYPOINT_OK, 0);  // Resend of one we already took
+        return;
+    }
+    if (have_session && seq != (uint16_t)(last_seq + 1)) {
+        send_ack((uint16_t)(last_seq + 1), WAYPOINT_SEQUENCE, 0);
+        return;
+    }
+
+    if (msg[0] == WAYPOINT_CMD_STOP) {
+        drop_queued();
+    } else if (msg[0] == WAYPOINT_CMD_CARTESIAN || msg[0] == WAYPOINT_CMD_JOINT) {
+        int n = len >= 6 ? msg[5] : 0;
+        if (n < 1 || n > WAYPOINT_FRAME_POINTS || len != 6 + 4 * n) {
+            send_ack(seq, WAYPOINT_BAD_COMMAND, 0);
+            return;
+        }
+        if (n > waypoint_credits()) {
+            send_ack(seq, WAYPOINT_NO_CREDIT, 0);
+            return;
+        }
+
+        // Check every point first so a frame is taken whole or not at all
+        waypoint_t points[WAYPOINT_FRAME_POINTS];
+        uint16_t duration_ms = frame_get_u16(msg + 3);
+        for (int i = 0; i < n; i++) {
+            const uint8_t *p = msg + 6 + 4 * i;
+            points[i].duration_ms = duration_ms;
+            if (msg[0] == WAYPOINT_CMD_CARTESIAN) {
+                points[i].kind = WAYPOINT_CARTESIAN;
+                points[i].a = (int16_t)frame_get_u16(p) * 0.1f;
+                points[i].b = (int16_t)frame_get_u16(p + 2) * 0.1f;
+            } else {
+                points[i].kind = WAYPOINT_JOINT;
+                points[i].a = frame_get_u16(p) * 0.01f;
+                points[i].b = frame_get_u16(p + 2) * 0.01f;
+            }
+            if (!point_ok(&points[i])) {
+                send_ack(seq, WAYPOINT_UNREACHABLE, (uint8_t)i);
+                return;
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            buffers[fill][fill_count++] = points[i];
+        }
+    } else {
+        send_ack(seq, WAYPOINT_BAD_COMMAND, 0);
+        return;
+    }
+
+    have_session = true;
+    last_seq = seq;
+    send_ack(seq, WAYPOINT_OK, 0);
+}
+
+static void handle_text(uint8_t byte) {
+    if (byte == '\n' || byte == '\r') {
+        if (line_len > 0 && line_handler) {
+            line[line_len] = '\0';
+            line_handler(line);
+        }
+        line_len = 0;
+    } else if (line_len < WAYPOINT_LINE_MAX - 1) {
+        line[line_len++] = (char)byte;
+    }
+}
+
+// Room for the biggest command and its replies
+static bool can_take_command(void) {
+    return waypoint_credits() >= WAYPOINT_FRAME_POINTS && TX_SIZE - tx_len >= 2 * FRAME_MAX_ENCODED;
+}
+
+void waypoint_stream_init(int shoulder_servo, int elbow_servo, waypoint_line_handler_t on_line) {
+    servo_nums[0] = shoulder_servo;
+    servo_nums[1] = elbow_servo;
+    line_handler = on_line;
+    frame_decoder_init(&decoder);
+
+    seed_last_pose();
+    credits_reported = waypoint_credits();
+}
+
+void waypoint_stream_poll(void) {
+    flush_tx();
+
+    while (!closed && can_take_command()) {
+        if (rx_pos == rx_len) {
+            int n = hal_serial_read_nonblocking(rx, RX_CHUNK);
+            if (n < 0) closed = true;
+            if (n <= 0) break;
+            rx_len = n;
+            rx_pos = 0;
+        }
+
+        // One byte at a time, so bytes past a command stay in rx until
+        // there's room for the next one
+        uint8_t byte = rx[rx_pos++];
+        int result = frame_decoder_push(&decoder, byte);
+        if (result > 0) {
+            handle_command(decoder.payload, result);
+        } else if (result == FRAME_TEXT) {
+            handle_text(byte);
+        }
+    }
+
+    feed_executor();
+
+    // Credits back: every WAYPOINT_CREDIT_REPORT points, and when it runs dry
+    if (have_session && (waypoint_credits() >= credits_reported + WAYPOINT_CREDIT_REPORT ||
+                         (queued_points() == 0 && queued_reported > 0))) {
+        send_status();
+    }
+    flush_tx();
+}
+
+bool waypoint_stream_idle(void) {
+    return queued_points() == 0 && motion_executor_idle();
+}
+
+bool waypoint_stream_closed(void) {
+    return closed;
+}
@@ -0,0 +1,121 @@
+#ifndef ARM_WAYPOINT_H
+#define ARM_WAYPOINT_H
+
+/*
+ * STREAMING WAYPOINT PROTOCOL
+ *
+ * Lets a host push dense Cartesian or joint trajectories (shoulder/elbow
+ * plane, as in ik_control) over the serial port without a stop per point.
+ * Commands and replies are arm_frame.h frames; all fields little-endian.
+ *
+ * Host -> device, every command starts [u8 type][u16 seq]:
+ *   WAYPOINT_CMD_HELLO      Starts a session: drops queued waypoints and
+ *                           takes seq as the new base. Replies ACK + STATUS.
+ *   WAYPOINT_CMD_CARTESIAN  [u16 duration_ms][u8 n] n x [i16 x][i16 z]
+ *                           tip targets in 0.1mm
+ *   WAYPOINT_CMD_JOINT      [u16 duration_ms][u8 n] n x [u16 shoulder]
+ *                           [u16 elbow] servo angles in 0.01 degree
+ *   WAYPOINT_CMD_STOP       Drops queued waypoints. Moves already handed to
+ *                           the motion executor (MOTION_QUEUE_SIZE) finish.
+ *   WAYPOINT_CMD_STATUS     Not sequenced, seq ignored: replies STATUS only.
+ * Each point is a linear move, starting duration_ms after the one before
+ * and blending into it (motion_executor.h), so a stream of n points takes
+ * n * duration_ms plus one end ramp. A duration of 0 runs each point as an
+ * S-curve as fast as the servo limits allow: use it for the first point of
+ * a trajectory, wherever the arm is.
+ *
+ * Device -> host:
+ *   WAYPOINT_MSG_ACK     [u16 seq][u8 result][u8 index][u16 credits]
+ *   WAYPOINT_MSG_STATUS  [u16 next_seq][u16 credits][u16 queued]
+ *                        [u32 done][u8 idle]
+ *
+ * Sequencing: commands must arrive in seq order. A repeat of the last
+ * accepted seq is acknowledged again but not applied, so a host can
+ * resend whatever it didn't see an ACK for. Anything else out of order is
+ * refused with WAYPOINT_SEQUENCE and the expected seq in the ACK's seq
+ * field; the host goes back to it.
+ *
+ * Flow control: credits are free waypoint slots. A host keeps the points
+ * it has in flight within the credits of the last ACK/STATUS; a command
+ * that doesn't fit is refused whole with WAYPOINT_NO_CREDIT. Credits come
+ * back as points execute, reported by a STATUS every WAYPOINT_CREDIT_REPORT
+ * points and when the queue empties. While it is out of room the device
+ * also stops reading, so a host that ignores credits is held back by USB.
+ *
+ * Points are checked against the reach map as they arrive; a frame with
+ * an unreachable point is refused whole with WAYPOINT_UNREACHABLE and the
+ * point's index. Accepted points land in one of two waypoint buffers while
+ * the other is solved (IK and branch choice for the whole buffer at once)
+ * and fed to the motion executor; the buffers swap when that one runs dry.
+ *
+ * Plain text lines on the same port ("x z" in ik_control) are handed to the
+ * line handler, so the serial monitor keeps working alongside a host.
+ */
+
+#include "arm_hal.h"
+#include "motion_profile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WAYPOINT_CMD_HELLO     0x01
+#define WAYPOINT_CMD_CARTESIAN 0x02
+#define WAYPOINT_CMD_JOINT     0x03
+#define WAYPOINT_CMD_STOP      0x04
+#define WAYPOINT_CMD_STATUS    0x05
+
+#define WAYPOINT_MSG_ACK       0x81
+#define WAYPOINT_MSG_STATUS    0x82
+
+// ACK results
+#define WAYPOINT_OK          0
+#define WAYPOINT_UNREACHABLE 1
+#define WAYPOINT_NO_CREDIT   2
+#define WAYPOINT_SEQUENCE    3
+#define WAYPOINT_BAD_COMMAND 4
+
+#define WAYPOINT_BUFFER_POINTS  64  // Per buffer; credits top out here
+#define WAYPOINT_FRAME_POINTS   16  // Most points in one command
+#define WAYPOINT_CREDIT_REPORT  16
+#define WAYPOINT_LINE_MAX       64
+
+typedef enum {
+    WAYPOINT_CARTESIAN,  // a, b = tip x, z in mm
+    WAYPOINT_JOINT,      // a, b = shoulder, elbow servo angles in degrees
+    WAYPOINT_LINE,       // a, b = tip x, z in mm, reached along a straight
+                         // line (arm_line.h); local pushes only. Runs as a
+                         // CARTESIAN point if the line can't be done.
+} waypoint_kind_t;
+
+typedef struct {
+    waypoint_kind_t kind;
+    float a, b;
+    uint16_t duration_ms;  // 0: S-curve at the servo limits
+} waypoint_t;
+
+typedef void (*waypoint_line_handler_t)(char *line);
+
+// Call after motion_executor_init(). servo_nums are the motion executor
+// numbers of the shoulder and elbow.
+void waypoint_stream_init(int shoulder_servo, int elbow_servo, waypoint_line_handler_t on_line);
+
+// Reads and answers commands, swaps and solves buffers and keeps the motion
+// executor fed. Call every millisecond or so from the main loop.
+void waypoint_stream_poll(void);
+
+// Local queueing (text commands), same path as streamed points. Returns
+// false if the point is unreachable or there is no room.
+bool waypoint_push(const waypoint_t *point);
+int waypoint_credits(void);
+
+// Nothing queued here or in the motion executor
+bool waypoint_stream_idle(void);
+// The input was closed (host builds, end of stdin)
+bool waypoint_stream_closed(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
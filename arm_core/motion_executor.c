@@ -0,0 +1,283 @@
+#include "motion_executor.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define TICK_S (MOTION_TICK_MS / 1000.0f)
+
+typedef struct {
+    uint8_t num_servos;
+    uint8_t servo_nums[MOTION_MAX_SERVOS];
+    uint16_t start_pulses[MOTION_MAX_SERVOS];  // Where the move before it leaves them
+    uint16_t target_pulses[MOTION_MAX_SERVOS];
+    bool linear;
+    float ramp;   // Length of each end ramp, s
+    float blend;  // How long it overlaps the move before it, s
+    motion_profile_t profile;
+    motion_path_callback_t path;  // NULL: straight line in joint space
+    void *path_data;
+} motion_move_t;
+
+static motion_move_t queue[MOTION_QUEUE_SIZE];
+static volatile uint32_t queue_head = 0;  // Written by enqueue only
+static volatile uint32_t queue_tail = 0;  // Written by the core 1 timer only
+
+static uint slices[MOTION_MAX_SERVOS];
+static uint channels[MOTION_MAX_SERVOS];
+static int num_executor_servos = 0;
+
+// Producer (core 0) state: limits, and where the queued moves end up
+static float max_vel[MOTION_MAX_SERVOS];
+static float max_accel[MOTION_MAX_SERVOS];
+static float max_jerk[MOTION_MAX_SERVOS];
+static int planned_levels[MOTION_MAX_SERVOS];
+
+// Core 1 state. Playing moves add their offset from start_pulses on top of
+// base_levels, where the finished ones left the servos; two play at once
+// while one blends into the next.
+typedef struct {
+    motion_move_t move;
+    float t;  // Time into the move, s
+} motion_playing_t;
+
+static int levels[MOTION_MAX_SERVOS];
+static int base_levels[MOTION_MAX_SERVOS];
+static motion_playing_t playing[2];  // Oldest first
+static int num_playing = 0;
+static int lookahead_ticks = 0;
+static volatile bool moving = false;
+
+static void start_next(float t) {
+    hal_memory_barrier();
+    playing[num_playing].move = queue[queue_tail & (MOTION_QUEUE_SIZE - 1)];
+    playing[num_playing].t = t;
+    num_playing++;
+
+    // Mark busy before freeing the slot so idle() never sees a gap
+    moving = true;
+    hal_memory_barrier();
+    queue_tail++;
+}
+
+static bool motion_tick(void *user_data) {
+    (void)user_data;
+
+    for (int k = 0; k < num_playing; k++) {
+        playing[k].t += TICK_S;
+    }
+
+    uint32_t queued = queue_head - queue_tail;
+    if (num_playing == 0) {
+        // From rest, give the move after this one a few ticks to turn up,
+        // so a stream starts with that much slack for the producer
+        if (queued == 0 || (queued == 1 && ++lookahead_ticks < MOTION_LOOKAHEAD_TICKS)) return true;
+        lookahead_ticks = 0;
+        start_next(TICK_S);
+    } else if (num_playing == 1 && queued > 0) {
+        // The next move starts its blend time before the newest one ends.
+        // If it turned up late, it starts now instead.
+        const motion_playing_t *newest = &playing[0];
+        hal_memory_barrier();
+        float start = newest->move.profile.total - queue[queue_tail & (MOTION_QUEUE_SIZE - 1)].blend;
+        if (newest->t >= start) start_next(fminf(newest->t - start, TICK_S));
+    }
+
+    float offsets[MOTION_MAX_SERVOS];
+    bool touched[MOTION_MAX_SERVOS] = {false};
+    bool finished[2] = {false, false};
+    for (int k = 0; k < num_playing; k++) {
+        const motion_move_t *move = &playing[k].move;
+        bool last = playing[k].t >= move->profile.total - 1e-4f;
+        float s = last ? 1.0f : motion_profile_position(&move->profile, playing[k].t);
+
+        int path_levels[MOTION_MAX_SERVOS];
+        if (move->path && !last) move->path(s, path_levels, move->path_data);
+
+        for (int i = 0; i < move->num_servos; i++) {
+            int servo = move->servo_nums[i];
+            float offset = move->path && !last ? (float)(path_levels[i] - move->start_pulses[i])
+                                               : (move->target_pulses[i] - move->start_pulses[i]) * s;
+            offsets[servo] = touched[servo] ? offsets[servo] + offset : offset;
+            touched[servo] = true;
+        }
+        finished[k] = last;
+    }
+
+    for (int servo = 0; servo < num_executor_servos; servo++) {
+        if (!touched[servo]) continue;
+        float offset = offsets[servo];
+        int level = base_levels[servo] + (int)(offset >= 0.0f ? offset + 0.5f : offset - 0.5f);
+        levels[servo] = level;
+        hal_pwm_set_chan_level(slices[servo], channels[servo], level);
+    }
+
+    // Fold finished moves into the base
+    int kept = 0;
+    for (int k = 0; k < num_playing; k++) {
+        const motion_move_t *move = &playing[k].move;
+        if (!finished[k]) {
+            playing[kept++] = playing[k];
+            continue;
+        }
+        for (int i = 0; i < move->num_servos; i++) {
+            base_levels[move->servo_nums[i]] += move->target_pulses[i] - move->start_pulses[i];
+        }
+    }
+    num_playing = kept;
+    if (num_playing == 0) moving = false;
+    return true;
+}
+
+bool motion_executor_init(const uint servo_pins[], const int start_pulses[], int num_servos) {
+    if (num_servos > MOTION_MAX_SERVOS) return false;
+
+    num_executor_servos = num_servos;
+    for (int i = 0; i < num_servos; i++) {
+        slices[i] = hal_pwm_gpio_to_slice_num(servo_pins[i]);
+        channels[i] = hal_pwm_gpio_to_channel(servo_pins[i]);
+        levels[i] = start_pulses[i];
+        base_levels[i] = start_pulses[i];
+        planned_levels[i] = start_pulses[i];
+        max_vel[i] = MOTION_DEFAULT_MAX_VEL;
+        max_accel[i] = MOTION_DEFAULT_MAX_ACCEL;
+        max_jerk[i] = MOTION_DEFAULT_MAX_JERK;
+    }
+    return hal_add_core1_repeating_timer_us(-(int64_t)MOTION_TICK_MS * 1000, motion_tick, NULL);
+}
+
+void motion_executor_set_limits(int servo_num, float vel, float accel, float jerk) {
+    if (servo_num < 0 || servo_num >= MOTION_MAX_SERVOS) return;
+    max_vel[servo_num] = vel;
+    max_accel[servo_num] = accel;
+    max_jerk[servo_num] = jerk;
+}
+
+void motion_executor_get_limits(int servo_num, float *vel, float *accel, float *jerk) {
+    if (servo_num < 0 || servo_num >= MOTION_MAX_SERVOS) return;
+    *vel = max_vel[servo_num];
+    *accel = max_accel[servo_num];
+    *jerk = max_jerk[servo_num];
+}
+
+// path_limits: normalised vel/accel/jerk for path moves, NULL to take them
+// from the joints
+static bool enqueue_move(const int servo_nums[], const int target_pulses[], int num_servos,
+                         motion_profile_type_t type, int duration_ms, const float *path_limits,
+                         motion_path_callback_t path, void *path_data) {
+    if (num_servos > MOTION_MAX_SERVOS) return false;
+    if (motion_executor_free_slots() == 0) return false;
+
+    // Normalised limits: the tightest joint sets the pace for all of them
+    float vel = 1e9f, accel = 1e9f, jerk = 1e9f;
+    bool any_motion = false;
+
+    motion_move_t *move = &queue[queue_head & (MOTION_QUEUE_SIZE - 1)];
+    move->num_servos = num_servos;
+    move->path = path;
+    move->path_data = path_data;
+    for (int i = 0; i < num_servos; i++) {
+        int servo = servo_nums[i];
+        if (servo < 0 || servo >= num_executor_servos) return false;
+        move->servo_nums[i] = servo;
+        move->start_pulses[i] = planned_levels[servo];
+        move->target_pulses[i] = target_pulses[i];
+
+        float distance = (float)abs(target_pulses[i] - planned_levels[servo]);
+        if (distance > 0.0f) {
+            any_motion = true;
+            if (max_vel[servo] / distance < vel) vel = max_vel[servo] / distance;
+            if (max_accel[servo] / distance < accel) accel = max_accel[servo] / distance;
+            if (max_jerk[servo] / distance < jerk) jerk = max_jerk[servo] / distance;
+        }
+    }
+    if (path_limits) {
+        vel = path_limits[0];
+        accel = path_limits[1];
+        jerk = path_limits[2];
+        any_motion = true;
+    }
+
+    move->linear = type == MOTION_PROFILE_LINEAR;
+    if (!any_motion) {
+        // Nothing to blend: a plain wait
+        motion_profile_plan(&move->profile, MOTION_PROFILE_LINEAR, vel, accel, jerk, duration_ms / 1000.0f);
+    } else if (move->linear) {
+        // Constant speed, with a ramp at each end where it blends into its
+        // neighbours. Consecutive moves start duration_ms apart, so a stream
+        // keeps its timing and the speed changes smoothly between them.
+        float t = duration_ms > 0 ? duration_ms / 1000.0f : TICK_S;
+        float ramp = fminf(t, MOTION_LINEAR_RAMP_MS / 1000.0f);
+        motion_profile_plan(&move->profile, MOTION_PROFILE_TRAPEZOID, 1.0f / t, 1.0f / (t * ramp), 0.0f, 0.0f);
+    } else {
+        motion_profile_plan(&move->profile, type, vel, accel, jerk, duration_ms / 1000.0f);
+    }
+    move->ramp = 2.0f * move->profile.t_jerk + move->profile.t_accel;
+
+    // Overlap with the move queued before this one: the shorter of the two
+    // ramps, so neither starts or stops early. A servo that reverses between
+    // two profiled moves would see both ramps' acceleration at once, so
+    // those meet at a stop instead.
+    move->blend = 0.0f;
+    if (queue_head > 0) {
+        const motion_move_t *prev = &queue[(queue_head - 1) & (MOTION_QUEUE_SIZE - 1)];
+        move->blend = fminf(prev->ramp, move->ramp);
+        for (int i = 0; i < num_servos && !(prev->linear && move->linear); i++) {
+            for (int j = 0; j < prev->num_servos; j++) {
+                if (prev->servo_nums[j] != move->servo_nums[i]) continue;
+                int before = prev->target_pulses[j] - prev->start_pulses[j];
+                int after = move->target_pulses[i] - move->start_pulses[i];
+                if ((before > 0 && after < 0) || (before < 0 && after > 0)) move->blend = 0.0f;
+            }
+        }
+    }
+
+    for (int i = 0; i < num_servos; i++) {
+        planned_levels[servo_nums[i]] = target_pulses[i];
+    }
+
+    // Publish the move before the timer can see the new head
+    hal_memory_barrier();
+    queue_head++;
+    return true;
+}
+
+bool motion_executor_enqueue(const int servo_nums[], const int target_pulses[], int num_servos, int duration_ms) {
+    if (duration_ms < MOTION_TICK_MS) duration_ms = MOTION_TICK_MS;
+    return enqueue_move(servo_nums, target_pulses, num_servos, MOTION_PROFILE_LINEAR, duration_ms, NULL, NULL, NULL);
+}
+
+bool motion_executor_enqueue_profiled(const int servo_nums[], const int target_pulses[], int num_servos,
+                                      motion_profile_type_t profile, int min_duration_ms) {
+    return enqueue_move(servo_nums, target_pulses, num_servos, profile, min_duration_ms, NULL, NULL, NULL);
+}
+
+bool motion_executor_enqueue_path(const int servo_nums[], const int target_pulses[], int num_servos,
+                                  motion_profile_type_t profile, float vel, float accel, float jerk,
+                                  int min_duration_ms, motion_path_callback_t path, void *user_data) {
+    float limits[3] = {vel, accel, jerk};
+    return enqueue_move(servo_nums, target_pulses, num_servos, profile, min_duration_ms, limits, path, user_data);
+}
+
+int motion_executor_level(int servo_num) {
+    if (servo_num < 0 || servo_num >= num_executor_servos) return 0;
+    return levels[servo_num];
+}
+
+int motion_executor_planned_level(int servo_num) {
+    if (servo_num < 0 || servo_num >= num_executor_servos) return 0;
+    return planned_levels[servo_num];
+}
+
+int motion_executor_free_slots(void) {
+    return MOTION_QUEUE_SIZE - (int)(queue_head - queue_tail);
+}
+
+bool motion_executor_idle(void) {
+    return queue_head == queue_tail && !moving;
+}
+
+void motion_executor_wait_idle(void) {
+    while (!motion_executor_idle()) {
+        hal_sleep_ms(1);
+    }
+}
@@ -0,0 +1,103 @@
+#ifndef MOTION_EXECUTOR_H
+#define MOTION_EXECUTOR_H
+
+/*
+ * TIMER-DRIVEN MOTION EXECUTOR
+ *
+ * Moves are queued in a small ring buffer and played back from a repeating
+ * timer every MOTION_TICK_MS, so the caller returns immediately instead of
+ * sleeping through the move. On the Pico the timer runs on core 1, which
+ * owns servo output; core 0 is left to input, IK and printf.
+ *
+ * Each move takes its servos from wherever the previous move left them to
+ * the target pulses along a velocity profile (see motion_profile.h):
+ * linear over a fixed duration for streamed joystick increments, or a
+ * trapezoid/S-curve within per-servo velocity, acceleration and jerk
+ * limits for point-to-point moves. The profile is planned at enqueue time
+ * on core 0; the timer only evaluates it.
+ *
+ * Consecutive moves blend instead of stopping at each target. The timer
+ * looks one move ahead and starts it while the current one is still
+ * slowing down, overlapping the current move's deceleration with the next
+ * one's acceleration for the shorter of the two ramps; both play at once,
+ * each adding its own offset, so the arm rounds the corner at speed and
+ * still ends exactly on the last target. Linear moves get a ramp at each
+ * end (MOTION_LINEAR_RAMP_MS at most) and start duration_ms apart, so a
+ * joystick stream runs at constant speed through its increments and
+ * changes speed smoothly between them. A servo that reverses between two
+ * profiled moves stops first, as its limits assume. Starting from rest, a
+ * move waits up to MOTION_LOOKAHEAD_TICKS for the next one, so a stream
+ * begins with that much slack for the producer.
+ *
+ * The ring is single producer (core 0 main loop) / single consumer (core 1
+ * timer), so no locking is needed: the producer only writes head, the
+ * consumer only writes tail, and barriers order the slot contents against
+ * the index updates.
+ */
+
+#include "arm_hal.h"
+#include "motion_profile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MOTION_MAX_SERVOS 6
+#define MOTION_QUEUE_SIZE 8   // Must be a power of 2
+#define MOTION_TICK_MS    4   // Same step period as the old 200ms/50-step moves
+#define MOTION_LOOKAHEAD_TICKS 2   // Wait from rest for a second move
+#define MOTION_LINEAR_RAMP_MS  50  // Longest end ramp of a linear move
+
+// Default per-servo limits in PWM counts (~21.4 counts per degree)
+#define MOTION_DEFAULT_MAX_VEL   4000.0f    // counts/s, ~190 deg/s
+#define MOTION_DEFAULT_MAX_ACCEL 16000.0f   // counts/s^2, ~750 deg/s^2
+#define MOTION_DEFAULT_MAX_JERK  160000.0f  // counts/s^3
+
+// Starts the timer on core 1. servo_pins[i] is the pin for servo number i,
+// start_pulses[i] its current PWM level.
+bool motion_executor_init(const uint servo_pins[], const int start_pulses[], int num_servos);
+
+// Per-servo limits for trapezoid and S-curve moves, in PWM counts per
+// second, second^2 and second^3
+void motion_executor_set_limits(int servo_num, float max_vel, float max_accel, float max_jerk);
+void motion_executor_get_limits(int servo_num, float *max_vel, float *max_accel, float *max_jerk);
+
+// Queues a linear move of servo_nums[] to target_pulses[] over duration_ms.
+// The next move starts duration_ms after it; on its own it takes one ramp
+// longer. Returns false (nothing queued) if the queue is full.
+bool motion_executor_enqueue(const int servo_nums[], const int target_pulses[], int num_servos, int duration_ms);
+
+// Queues a profiled move. It is as fast as the slowest servo's limits
+// allow, but takes at least min_duration_ms (0 for no minimum).
+bool motion_executor_enqueue_profiled(const int servo_nums[], const int target_pulses[], int num_servos,
+                                      motion_profile_type_t profile, int min_duration_ms);
+
+// Path moves follow a curve instead of a straight line in joint space:
+// every tick but the last, the timer calls path(s, pulses, user_data) for
+// the setpoint at profile position s (0..1) and writes pulses[i] to
+// servo_nums[i]; the last tick writes target_pulses, which must be where
+// the path ends. The limits are normalised (per unit of s), as in
+// motion_profile_plan(). path runs in the timer, on core 1 on the Pico, so
+// it has to take well under a tick and its data has to stay put until the
+// move has played.
+typedef void (*motion_path_callback_t)(float s, int pulses[], void *user_data);
+bool motion_executor_enqueue_path(const int servo_nums[], const int target_pulses[], int num_servos,
+                                  motion_profile_type_t profile, float vel, float accel, float jerk,
+                                  int min_duration_ms, motion_path_callback_t path, void *user_data);
+
+// Level a servo will be at once everything queued so far has played
+int motion_executor_planned_level(int servo_num);
+
+// PWM level the timer last wrote to a servo. Exact on core 1 (e.g. from
+// another core 1 timer); on core 0 it may be a tick behind.
+int motion_executor_level(int servo_num);
+
+int motion_executor_free_slots(void);
+bool motion_executor_idle(void);
+void motion_executor_wait_idle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
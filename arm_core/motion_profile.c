@@ -0,0 +1,102 @@
+#include "motion_profile.h"
+#include <math.h>
+
+void motion_profile_plan(motion_profile_t *p, motion_profile_type_t type,
+                         float max_vel, float max_accel, float max_jerk, float min_duration_s) {
+    float vel, accel, t_jerk = 0.0f, jerk = 0.0f;
+
+    if (type == MOTION_PROFILE_LINEAR) {
+        float t = min_duration_s > 0.0f ? min_duration_s : 1e-3f;
+        p->t_jerk = 0.0f;
+        p->t_accel = 0.0f;
+        p->t_cruise = t;
+        p->jerk = 0.0f;
+        p->accel = 0.0f;
+        p->vel = 1.0f / t;
+        p->total = t;
+        return;
+    }
+
+    if (type == MOTION_PROFILE_TRAPEZOID) {
+        accel = max_accel;
+        vel = max_vel;
+        // Triangle if cruise speed can't be reached within half the distance
+        if (vel * vel / accel > 1.0f) vel = sqrtf(accel);
+    } else {
+        jerk = max_jerk;
+        accel = max_accel;
+        vel = max_vel;
+
+        // Peak acceleration is only reached if the velocity limit allows it
+        if (vel * jerk < accel * accel) accel = sqrtf(vel * jerk);
+
+        // Accel + decel cover vel * (vel / accel + accel / jerk); too far
+        // means no cruise, so solve for the velocity that covers exactly 1
+        if (vel * (vel / accel + accel / jerk) > 1.0f) {
+            float k = accel / jerk;
+            vel = 0.5f * accel * (sqrtf(k * k + 4.0f / accel) - k);
+            if (vel * jerk < accel * accel) {
+                // Jerk limited only: 4 jerk phases, no constant acceleration
+                t_jerk = cbrtf(0.5f / jerk);
+                accel = jerk * t_jerk;
+                vel = accel * t_jerk;
+            }
+        }
+        t_jerk = accel / jerk;
+    }
+
+    float t_accel = vel / accel - t_jerk;
+    if (t_accel < 0.0f) t_accel = 0.0f;
+    float t_ramp = 2.0f * t_jerk + t_accel;
+    float t_cruise = (1.0f - vel * t_ramp) / vel;
+    if (t_cruise < 0.0f) t_cruise = 0.0f;
+    float total = 2.0f * t_ramp + t_cruise;
+
+    // Stretch in time to the minimum duration
+    if (min_duration_s > total) {
+        float k = min_duration_s / total;
+        t_jerk *= k;
+        t_accel *= k;
+        t_cruise *= k;
+        vel /= k;
+        accel /= k * k;
+        jerk /= k * k * k;
+        total = min_duration_s;
+    }
+
+    p->t_jerk = t_jerk;
+    p->t_accel = t_accel;
+    p->t_cruise = t_cruise;
+    p->jerk = jerk;
+    p->accel = accel;
+    p->vel = vel;
+    p->total = total;
+}
+
+// Position during the acceleration phase, 0 <= t <= 2 * t_jerk + t_accel
+static float ramp_position(const motion_profile_t *p, float t) {
+    float tj = p->t_jerk;
+    if (t < tj) return p->jerk * t * t * t / 6.0f;
+
+    float s1 = p->jerk * tj * tj * tj / 6.0f;
+    float v1 = p->jerk * tj * tj / 2.0f;
+    float u = t - tj;
+    if (u < p->t_accel) return s1 + v1 * u + p->accel * u * u / 2.0f;
+
+    float s2 = s1 + v1 * p->t_accel + p->accel * p->t_accel * p->t_accel / 2.0f;
+    float v2 = v1 + p->accel * p->t_accel;
+    u -= p->t_accel;
+    return s2 + v2 * u + p->accel * u * u / 2.0f - p->jerk * u * u * u / 6.0f;
+}
+
+float motion_profile_position(const motion_profile_t *p, float t) {
+    if (t <= 0.0f) return 0.0f;
+    if (t >= p->total) return 1.0f;
+
+    float t_ramp = 2.0f * p->t_jerk + p->t_accel;
+    if (t < t_ramp) return ramp_position(p, t);
+    if (t < t_ramp + p->t_cruise) return p->vel * t_ramp / 2.0f + p->vel * (t - t_ramp);
+
+    // Deceleration mirrors acceleration
+    return 1.0f - ramp_position(p, p->total - t);
+}
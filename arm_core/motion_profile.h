@@ -0,0 +1,57 @@
+#ifndef MOTION_PROFILE_H
+#define MOTION_PROFILE_H
+
+/*
+ * VELOCITY PROFILES
+ *
+ * A profile describes one move as a normalised position 0 -> 1 over time.
+ * Every joint in a coordinated move follows the same profile scaled by its
+ * own distance, so the joints start and finish together and the move is a
+ * straight line in joint space.
+ *
+ *   LINEAR     constant speed over a fixed duration (the old 50-step ramp)
+ *   TRAPEZOID  acceleration limited: ramp up, cruise, ramp down
+ *   SCURVE     jerk limited as well: 7 phases, acceleration ramps too
+ *
+ * Trapezoid and S-curve moves are time-optimal for the tightest joint's
+ * limits. A minimum duration stretches them in time, which only lowers
+ * velocity, acceleration and jerk.
+ */
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    MOTION_PROFILE_LINEAR,
+    MOTION_PROFILE_TRAPEZOID,
+    MOTION_PROFILE_SCURVE
+} motion_profile_type_t;
+
+// Normalised (distance 1) profile, times in seconds. The acceleration phase
+// is t_jerk + t_accel + t_jerk long; deceleration mirrors it.
+typedef struct {
+    float t_jerk;   // Each jerk phase (0 for linear/trapezoid)
+    float t_accel;  // Constant acceleration phase
+    float t_cruise;
+    float jerk;
+    float accel;    // Peak acceleration
+    float vel;      // Cruise velocity
+    float total;
+} motion_profile_t;
+
+// Plans a profile for distance 1 under normalised limits (joint limit /
+// joint distance). LINEAR ignores the limits and takes min_duration_s.
+void motion_profile_plan(motion_profile_t *p, motion_profile_type_t type,
+                         float max_vel, float max_accel, float max_jerk, float min_duration_s);
+
+// Normalised position at time t, 0 before the start and 1 after the end
+float motion_profile_position(const motion_profile_t *p, float t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
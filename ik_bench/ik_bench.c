@@ -0,0 +1,396 @@
+#include "arm_hal.h"
+#include "arm_servo.h"
+#include "arm_ik.h"
+#include "arm_reach.h"
+#include "arm_joystick.h"
+#include "arm_line.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/*
+ * IK / MOTION MICROBENCHMARKS
+ *
+ * Times the hot kernels over a fixed sweep of targets and prints
+ * min/median/p99 cycles per call over USB serial. The host build
+ * (ik_bench_sim) runs the same sweep, timed with the CPU timestamp counter.
+ *
+ * Kernels:
+ *   ik_float / ik_fixed  calculate_2d_ik_float / calculate_2d_ik_fixed
+ *   ik_5dof              calculate_arm_ik, same (x, z) targets moved into the
+ *                        base frame, pointer level
+ *   ik_batch             calculate_2d_ik_batch over a workspace grid vs a
+ *                        loop of calculate_2d_ik_float, in solves/sec. Also
+ *                        checks the 3D batch (base folded, x < 0 included)
+ *                        against calculate_2d_ik_float on the folded radius
+ *   reach_check          reach_map_contains on the same targets
+ *   reach_project        reach_map_project on the same targets (a no-op
+ *                        for reachable ones)
+ *   angle_to_pulse       one angle_to_pulse call (whole degrees, table read)
+ *   servo_angle_pulse    one servo_angle_to_pulse call (1/256 degree, blend)
+ *   joystick_condition   one joystick_update on a calibrated 2-axis stick
+ *                        (filter, radial dead zone, curve) over a raw sweep
+ *   joystick_iter        one joystick loop iteration minus the sleep:
+ *                        2 captured ADC reads, joystick_update + speed
+ *                        maths, IK, 2 angle_to_pulse, 2 PWM writes
+ *   line_step            one motion executor tick of a straight-line move
+ *                        (arm_line_step: warm-started Newton step, 2
+ *                        angle_to_pulse_f), along a 100mm line
+ */
+
+#define BENCH_ROUNDS 64
+#define TARGETS_PER_CASE 4
+#define MAX_SAMPLES (BENCH_ROUNDS * TARGETS_PER_CASE)
+
+const uint SHOULDER = 14;
+const uint ELBOW = 13;
+
+typedef struct {
+    const char *name;
+    float targets[TARGETS_PER_CASE][2];  // (x, z) in mm
+} bench_case_t;
+
+static const bench_case_t cases[] = {
+    {"config1",     {{250, 50}, {300, -50}, {0, -250}, {-200, -150}}},
+    {"config2",     {{150, 200}, {50, 250}, {-50, 250}, {200, 150}}},
+    {"unreachable", {{330, 0}, {250, 250}, {0, -330}, {-300, 200}}},
+    {"too_close",   {{50, 20}, {0, 60}, {-40, -40}, {70, 0}}},
+};
+#define NUM_CASES (sizeof(cases) / sizeof(cases[0]))
+
+typedef bool (*ik_fn_t)(float x, float z, float *shoulder_angle, float *elbow_angle);
+
+static uint32_t samples[MAX_SAMPLES];
+static uint32_t timer_overhead = 0;
+
+// Keeps results live so the compiler can't drop the timed calls
+static volatile float sink_f;
+static volatile int sink_i;
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void report(const char *kernel, const char *case_name, int n) {
+    qsort(samples, n, sizeof(samples[0]), compare_u32);
+    uint32_t min = samples[0];
+    uint32_t median = samples[n / 2];
+    uint32_t p99 = samples[(n * 99) / 100];
+    float median_us = median * 1e6f / hal_cycle_hz();
+
+    printf("%-15s %-12s %5d %8lu %8lu %8lu %10.2f\n", kernel, case_name, n,
+           (unsigned long)min, (unsigned long)median, (unsigned long)p99, median_us);
+}
+
+static uint32_t elapsed(uint32_t start) {
+    uint32_t cycles = hal_cycles_between(start, hal_cycle_count());
+    return cycles > timer_overhead ? cycles - timer_overhead : 0;
+}
+
+static void measure_timer_overhead(void) {
+    for (int i = 0; i < MAX_SAMPLES; i++) {
+        uint32_t start = hal_cycle_count();
+        samples[i] = hal_cycles_between(start, hal_cycle_count());
+    }
+    qsort(samples, MAX_SAMPLES, sizeof(samples[0]), compare_u32);
+    timer_overhead = samples[0];
+}
+
+static void bench_ik(const char *kernel, ik_fn_t ik) {
+    for (unsigned c = 0; c < NUM_CASES; c++) {
+        int n = 0;
+        for (int round = 0; round < BENCH_ROUNDS; round++) {
+            for (int t = 0; t < TARGETS_PER_CASE; t++) {
+                float shoulder, elbow;
+                uint32_t start = hal_cycle_count();
+                bool ok = ik(cases[c].targets[t][0], cases[c].targets[t][1], &shoulder, &elbow);
+                samples[n++] = elapsed(start);
+                if (ok) sink_f = shoulder + elbow;
+            }
+        }
+        report(kernel, cases[c].name, n);
+    }
+}
+
+static void bench_ik_5dof(void) {
+    for (unsigned c = 0; c < NUM_CASES; c++) {
+        int n = 0;
+        for (int round = 0; round < BENCH_ROUNDS; round++) {
+            for (int t = 0; t < TARGETS_PER_CASE; t++) {
+                arm_pose_t poses[ARM_IK_MAX_SOLUTIONS];
+                float x = cases[c].targets[t][0] + SHOULDER_OFFSET;
+                float z = cases[c].targets[t][1] + BASE_HEIGHT;
+                uint32_t start = hal_cycle_count();
+                int count = calculate_arm_ik(x, 0.0f, z, 0.0f, poses);
+                samples[n++] = elapsed(start);
+                if (count > 0) sink_f = poses[0].shoulder;
+            }
+        }
+        report("ik_5dof", cases[c].name, n);
+    }
+}
+
+// Workspace sweep: a BATCH_SIDE x BATCH_SIDE grid over the whole reach
+#define BATCH_SIDE 32
+#define BATCH_SIZE (BATCH_SIDE * BATCH_SIDE)
+#define BATCH_REPEATS 8
+
+static float batch_x[BATCH_SIZE], batch_z[BATCH_SIZE];
+static float batch_y[BATCH_SIZE], batch_base[BATCH_SIZE];
+static float batch_shoulder[BATCH_SIZE], batch_elbow[BATCH_SIZE];
+static uint8_t batch_valid[BATCH_SIZE];
+
+static void report_throughput(const char *kernel, uint32_t best_cycles) {
+    float seconds = (float)best_cycles / hal_cycle_hz();
+    printf("%-15s %-12s %5d %10.0f solves/s  %6.1f cycles/solve\n", kernel, "grid", BATCH_SIZE,
+           BATCH_SIZE / seconds, (float)best_cycles / BATCH_SIZE);
+}
+
+static void bench_ik_batch(void) {
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        batch_x[i] = -330.0f + 660.0f * (i % BATCH_SIDE) / (BATCH_SIDE - 1);
+        batch_z[i] = -330.0f + 660.0f * (i / BATCH_SIDE) / (BATCH_SIDE - 1);
+    }
+
+    // Best of a few runs; one run is far longer than the timer read
+    uint32_t best_batch = UINT32_MAX, best_loop = UINT32_MAX;
+    for (int r = 0; r < BATCH_REPEATS; r++) {
+        uint32_t start = hal_cycle_count();
+        sink_i = calculate_2d_ik_batch(batch_x, NULL, batch_z, BATCH_SIZE, NULL,
+                                       batch_shoulder, batch_elbow, batch_valid);
+        uint32_t cycles = elapsed(start);
+        if (cycles < best_batch) best_batch = cycles;
+
+        start = hal_cycle_count();
+        int solved = 0;
+        for (int i = 0; i < BATCH_SIZE; i++) {
+            solved += calculate_2d_ik_float(batch_x[i], batch_z[i], &batch_shoulder[i], &batch_elbow[i]);
+        }
+        cycles = elapsed(start);
+        sink_i = solved;
+        if (cycles < best_loop) best_loop = cycles;
+    }
+
+    printf("batch ISA: %s\n", calculate_2d_ik_batch_isa());
+    report_throughput("ik_batch", best_batch);
+    report_throughput("ik_float_loop", best_loop);
+}
+
+// 3D targets all round the base, both x signs, at a few heights. n is not a
+// multiple of the SIMD width, so the scalar tail is checked too. Joint
+// angles may differ by a degree where the polynomial trig lands on the
+// other side of a truncation; validity and base may not.
+static void check_ik_batch(void) {
+    int n = BATCH_SIZE - 3;
+    for (int i = 0; i < n; i++) {
+        float yaw = 6.2831853f * (i % BATCH_SIDE) / BATCH_SIDE;
+        float r = 200.0f + 130.0f * (i / BATCH_SIDE % 4) / 3.0f;
+        batch_x[i] = r * cosf(yaw);
+        batch_y[i] = r * sinf(yaw);
+        batch_z[i] = -150.0f + 300.0f * (i / BATCH_SIDE) / (BATCH_SIDE - 1);
+    }
+    calculate_2d_ik_batch(batch_x, batch_y, batch_z, n, batch_base, batch_shoulder, batch_elbow, batch_valid);
+
+    int bad = 0, behind = 0;
+    for (int i = 0; i < n; i++) {
+        float yaw = atan2f(batch_y[i], batch_x[i]) * 57.2957795f;
+        float radial = hypotf(batch_x[i], batch_y[i]);
+        if (yaw > 90.0f || yaw < -90.0f) {
+            yaw += yaw > 0.0f ? -180.0f : 180.0f;
+            radial = -radial;
+            behind++;
+        }
+        float shoulder, elbow;
+        bool valid = calculate_2d_ik_float(radial, batch_z[i], &shoulder, &elbow);
+        bool agree = valid == (batch_valid[i] != 0) && fabsf(batch_base[i] - (90.0f + yaw)) < 0.01f &&
+                     batch_base[i] >= 0.0f && batch_base[i] <= 180.0f;
+        if (agree && valid) agree = fabsf(batch_shoulder[i] - shoulder) <= 1.0f && fabsf(batch_elbow[i] - elbow) <= 1.0f;
+        if (!agree) bad++;
+    }
+    printf("ik_batch 3D check: %d of %d targets (%d behind the base) disagree with calculate_2d_ik_float\n", bad, n,
+           behind);
+}
+
+static void bench_reach(void) {
+    for (unsigned c = 0; c < NUM_CASES; c++) {
+        int n = 0;
+        for (int round = 0; round < BENCH_ROUNDS; round++) {
+            for (int t = 0; t < TARGETS_PER_CASE; t++) {
+                uint32_t start = hal_cycle_count();
+                sink_i = reach_map_contains(&arm_reach_2d, cases[c].targets[t][0], cases[c].targets[t][1]);
+                samples[n++] = elapsed(start);
+            }
+        }
+        report("reach_check", cases[c].name, n);
+    }
+
+    for (unsigned c = 0; c < NUM_CASES; c++) {
+        int n = 0;
+        for (int round = 0; round < BENCH_ROUNDS; round++) {
+            for (int t = 0; t < TARGETS_PER_CASE; t++) {
+                float x = cases[c].targets[t][0];
+                float z = cases[c].targets[t][1];
+                uint32_t start = hal_cycle_count();
+                sink_i = reach_map_project(&arm_reach_2d, &x, &z, ARM_REACH_MARGIN);
+                samples[n++] = elapsed(start);
+                sink_f = x + z;
+            }
+        }
+        report("reach_project", cases[c].name, n);
+    }
+}
+
+static void bench_angle_to_pulse(void) {
+    int n = 0;
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        for (int t = 0; t < TARGETS_PER_CASE; t++) {
+            int servo = (round + t) % 5;
+            int angle = (round * 37 + t * 11) % 181;
+            uint32_t start = hal_cycle_count();
+            sink_i = angle_to_pulse(servo, angle);
+            samples[n++] = elapsed(start);
+        }
+    }
+    report("angle_to_pulse", "sweep", n);
+
+    n = 0;
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        for (int t = 0; t < TARGETS_PER_CASE; t++) {
+            int servo = (round + t) % 5;
+            servo_angle_t angle = ((round * 9473 + t * 2861) % (180 * SERVO_ANGLE_ONE));
+            uint32_t start = hal_cycle_count();
+            sink_i = servo_angle_to_pulse(servo, angle);
+            samples[n++] = elapsed(start);
+        }
+    }
+    report("servo_angle_pulse", "sweep", n);
+}
+
+static void bench_line_step(void) {
+    arm_pose_t poses[ARM_IK_MAX_SOLUTIONS];
+    calculate_2d_ik_branches(250, 0, poses);
+
+    arm_line_t line = {{1, 2}, 250, 0, 20, 100, IK_SHOULDER_FROM_SERVO(poses[0].shoulder),
+                       IK_ELBOW_FROM_SERVO(poses[0].elbow), 250, 0, true};
+    int n = 0;
+    for (int i = 1; i <= MAX_SAMPLES; i++) {
+        int pulses[2];
+        uint32_t start = hal_cycle_count();
+        arm_line_step(&line, (float)i / MAX_SAMPLES, pulses);
+        samples[n++] = elapsed(start);
+        sink_i = pulses[0] + pulses[1];
+    }
+    report("line_step", "config1", n);
+}
+
+static joystick_t stick;
+
+// Calibrated at mid-scale with a little noise, as at startup
+static void calibrate_stick(void) {
+    joystick_init(&stick, 2, 12, 20);
+    int16_t out[2];
+    for (int i = 0; i < JOYSTICK_CAL_PASSES; i++) {
+        uint16_t raw[] = {(uint16_t)(2046 + i % 5), (uint16_t)(2050 - i % 3)};
+        joystick_update(&stick, raw, out);
+    }
+}
+
+static void bench_joystick_condition(void) {
+    calibrate_stick();
+    int n = 0;
+    int16_t out[2];
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        for (int t = 0; t < TARGETS_PER_CASE; t++) {
+            uint16_t raw[] = {(uint16_t)((round * 521 + t * 97) % 4096), (uint16_t)((round * 131 + t * 1013) % 4096)};
+            uint32_t start = hal_cycle_count();
+            joystick_update(&stick, raw, out);
+            samples[n++] = elapsed(start);
+            sink_i = out[0] + out[1];
+        }
+    }
+    report("joystick_condition", "sweep", n);
+}
+
+// Mirrors the body of the ik_js_control loop, minus queueing and the sleep
+static void joystick_iteration(uint slice_s, uint chan_s, uint slice_e, uint chan_e, float *x, float *z) {
+    uint16_t joy_raw[] = {hal_adc_capture_read(0), hal_adc_capture_read(1)};
+    int16_t joy[2];
+    joystick_update(&stick, joy_raw, joy);
+
+    float speed = 3.0f;
+    float new_x = *x + joy[0] * (speed / JOYSTICK_ONE);
+    float new_z = *z + joy[1] * (speed / JOYSTICK_ONE);
+
+    float shoulder_angle, elbow_angle;
+    if (calculate_2d_ik(new_x, new_z, &shoulder_angle, &elbow_angle)) {
+        hal_pwm_set_chan_level(slice_s, chan_s, angle_to_pulse(1, (int)shoulder_angle));
+        hal_pwm_set_chan_level(slice_e, chan_e, angle_to_pulse(2, (int)elbow_angle));
+    }
+}
+
+static void bench_joystick_iteration(void) {
+    uint slice_s = hal_pwm_gpio_to_slice_num(SHOULDER);
+    uint chan_s = hal_pwm_gpio_to_channel(SHOULDER);
+    uint slice_e = hal_pwm_gpio_to_slice_num(ELBOW);
+    uint chan_e = hal_pwm_gpio_to_channel(ELBOW);
+
+    for (unsigned c = 0; c < NUM_CASES; c++) {
+        int n = 0;
+        for (int round = 0; round < BENCH_ROUNDS; round++) {
+            for (int t = 0; t < TARGETS_PER_CASE; t++) {
+                float x = cases[c].targets[t][0];
+                float z = cases[c].targets[t][1];
+                uint32_t start = hal_cycle_count();
+                joystick_iteration(slice_s, chan_s, slice_e, chan_e, &x, &z);
+                samples[n++] = elapsed(start);
+            }
+        }
+        report("joystick_iter", cases[c].name, n);
+    }
+}
+
+int main() {
+    const uint LED_PIN = 16;
+
+    hal_init();
+    hal_sleep_ms(2000);  // Wait for serial
+
+    hal_gpio_led_init(LED_PIN);
+    hal_gpio_put(LED_PIN, 1);
+
+    // PWM pins are left unconfigured so the arm doesn't move; the level
+    // writes in joystick_iter still hit the slice registers
+    hal_adc_init();
+    hal_adc_gpio_init(26);
+    hal_adc_gpio_init(27);
+    hal_adc_capture_start(2, 1000);
+
+    measure_timer_overhead();
+
+    printf("=== IK Benchmark ===\n");
+    printf("CPU clock: %lu Hz, timer overhead: %lu cycles (subtracted)\n",
+           (unsigned long)hal_cycle_hz(), (unsigned long)timer_overhead);
+    printf("%-15s %-12s %5s %8s %8s %8s %10s\n", "kernel", "case", "n", "min", "median", "p99", "median_us");
+
+    bench_ik("ik_float", calculate_2d_ik_float);
+    bench_ik("ik_fixed", calculate_2d_ik_fixed);
+    bench_ik_5dof();
+    bench_ik_batch();
+    check_ik_batch();
+    bench_reach();
+    bench_angle_to_pulse();
+    bench_line_step();
+    bench_joystick_condition();
+    bench_joystick_iteration();
+
+    printf("Done\n");
+    hal_gpio_put(LED_PIN, 0);
+
+    while (true) {
+        hal_sleep_ms(1000);
+    }
+    return 0;
+}
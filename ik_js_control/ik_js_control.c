@@ -1,80 +1,77 @@
-#include "pico/stdlib.h"
-#include "hardware/pwm.h"
-#include "hardware/adc.h"
+#include "arm_hal.h"
+#include "arm_servo.h"
+#include "motion_executor.h"
+#include "arm_move.h"
+#include "arm_ik.h"
+#include "arm_reach.h"
+#include "arm_telemetry.h"
+#include "arm_loop_timing.h"
+#include "arm_joystick.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 
 
 // Function declarations
-int angle_to_pulse(int servo_num, int angle);
-void set_servo_angle(uint servo_pin, int servo_num, int angle);
-void move_servo_slow(uint slice, uint channel, int start_pos, int end_pos, int duration_ms);
-bool calculate_2d_ik(float x, float z, float *shoulder_angle, float *elbow_angle);
-void move_servos_coordinated(uint servo_pins[], int servo_nums[], int target_angles[], int num_servos, int duration_ms);
+bool move_ik_joints(float shoulder_deg, float elbow_deg, motion_profile_type_t profile, int duration_ms);
+bool move_to_target(float x, float z, int duration_ms);
 
-/*
-* ARM MEASUREMENTS (mm):
-* - Base height: 97mm
-* - Shoulder offset from base axis: 14mm
-* - Link 1 (shoulder→elbow): 114mm
-* - Link 2 (elbow→wrist roll): 87mm (5mm offset)
-* - Wrist roll→pitch: 37mm
-* - Wrist pitch→pointer tip: 80mm
-* - Total Link2 for IK: 167mm (87 + 37 + 80)
-* - Max reach: ~318mm
-*/
+int current_config = 0;  // IK branch the arm is on, 0 = unknown
 
-// Link lengths in mm
-#define LINK1 114.0  // Shoulder to elbow
-#define LINK2 204.0  // Elbow to pointer tip (87 + 37 + 80)
+// Input loop period. The loop sleeps to absolute deadlines, so IK and printf
+// time doesn't stretch it; servo output runs on core 1 and never blocks it.
+#define INPUT_PERIOD_MS 50
 
-// Current positions
-int current_positions[5] = {0, 0, 0, 0, 0};
+// Joystick moves last one loop period; the executor blends each increment
+// into the next, so a held stick moves at a steady speed and the loop
+// never waits on motion
+#define JOY_MOVE_MS INPUT_PERIOD_MS
+
+// Background ADC capture rate per joystick axis. Each read averages the
+// last HAL_ADC_CAPTURE_AVERAGE samples (16ms at 1kHz)
+#define JOY_SAMPLE_HZ 1000
+
+// Joystick mode. Resolved rate (1): deflection sets the tip velocity and
+// the Jacobian turns it into joint rates, integrated every loop, so there
+// is no position solve and the elbow never flips configuration mid-move.
+// Position (0): the old per-loop position IK with boundary sliding.
+#ifndef JOY_RESOLVED_RATE
+#define JOY_RESOLVED_RATE 1
+#endif
+#define JOY_MAX_SPEED 60.0f  // mm/s at full deflection
+
+// Binary telemetry rate (see arm_telemetry.h), decoded on the host with
+// tools/telemetry_decode. 0 for the old once a second printf instead.
+#ifndef JOY_TELEMETRY_HZ
+#define JOY_TELEMETRY_HZ TELEMETRY_DEFAULT_HZ
+#endif
 
 
 int main() {
-    // Pin definitions
-    const uint LED_PIN = 16;
-    const uint BASE = 15;
-    const uint SHOULDER = 14;
-    const uint ELBOW = 13;
-    const uint WRIST_ROLL = 12;
-    const uint WRIST_PITCH = 11;
+    const uint LED_PIN = ARM_LED_PIN;
     
-    stdio_init_all();
-    sleep_ms(2000);  // Wait for serial
+    hal_init();
+    hal_sleep_ms(2000);  // Wait for serial
     
     // LED setup
-    gpio_init(LED_PIN);
-    gpio_set_dir(LED_PIN, GPIO_OUT);
+    hal_gpio_led_init(LED_PIN);
     
     // Blink confirmation
     for (int i = 0; i < 3; i++) {
-        gpio_put(LED_PIN, 1);
-        sleep_ms(200);
-        gpio_put(LED_PIN, 0);
-        sleep_ms(200);
+        hal_gpio_put(LED_PIN, 1);
+        hal_sleep_ms(200);
+        hal_gpio_put(LED_PIN, 0);
+        hal_sleep_ms(200);
     }
     
-    // PWM setup
-    uint servos[] = {BASE, SHOULDER, ELBOW, WRIST_ROLL, WRIST_PITCH};
-    for (int i = 0; i < 5; i++) {
-        gpio_set_function(servos[i], GPIO_FUNC_PWM);
-        uint slice = pwm_gpio_to_slice_num(servos[i]);
-        pwm_set_clkdiv(slice, 64.0f);
-        pwm_set_wrap(slice, 39062);
-        pwm_set_enabled(slice, true);
-    }
-    // Initialize to 90 degrees
-    for (int i = 0; i < 5; i++) {
-        current_positions[i] = angle_to_pulse(i, 90);
-    }
+    // PWM setup, positions start at 90 degrees
+    arm_servos_init();
 
     // ADC setup for joystick
-    adc_init();
-    adc_gpio_init(26);  // X-axis
-    adc_gpio_init(27);  // Y-axis
+    hal_adc_init();
+    hal_adc_gpio_init(26);  // X-axis
+    hal_adc_gpio_init(27);  // Y-axis
+    hal_adc_capture_start(2, JOY_SAMPLE_HZ);
 
     // printf("=== 2D IK Joystick Control ===\n");
     // printf("Move joystick to control arm position\n\n");
@@ -84,9 +81,9 @@ int main() {
     // printf("Example: 150 100\n\n");
     
     // Set base and wrists to neutral
-    set_servo_angle(BASE, 0, 90);
-    set_servo_angle(WRIST_ROLL, 3, 90);
-    set_servo_angle(WRIST_PITCH, 4, 145);
+    set_servo_angle(0, 90);    // Base
+    set_servo_angle(3, 90);    // Wrist roll
+    set_servo_angle(4, 145);   // Wrist pitch
     
     // Start at max reach position
 float current_x = 318.0;
@@ -95,219 +92,165 @@ float current_z = 0.0;
 // Move to starting position
 float shoulder_angle, elbow_angle;
 if (calculate_2d_ik(current_x, current_z, &shoulder_angle, &elbow_angle)) {
-    uint moving_pins[] = {SHOULDER, ELBOW};
     int moving_nums[] = {1, 2};
-    int target_angles[] = {(int)shoulder_angle, (int)elbow_angle};
-    move_servos_coordinated(moving_pins, moving_nums, target_angles, 2, 1500);
+    float target_angles[] = {shoulder_angle, elbow_angle};
+    move_servos_coordinated(moving_nums, target_angles, 2, MOTION_PROFILE_SCURVE, 0);
+    motion_executor_wait_idle();
 }
 
+#if JOY_RESOLVED_RATE
+// Joint state in IK-frame degrees, integrated from the joystick. Start from
+// the start pose, nudged off dead straight so the elbow can fold back.
+float joint_shoulder = IK_SHOULDER_FROM_SERVO(shoulder_angle);
+float joint_elbow = IK_ELBOW_FROM_SERVO(elbow_angle);
+bool elbow_up = joint_elbow >= 0;
+clamp_2link_joints(&joint_shoulder, &joint_elbow, elbow_up);
+move_ik_joints(joint_shoulder, joint_elbow, MOTION_PROFILE_SCURVE, 0);
+motion_executor_wait_idle();
+forward_2link(LINK1, LINK2, joint_shoulder, joint_elbow, &current_x, &current_z);
+#endif
+
 // printf("Starting at position (%.1f, %.1f)\n", current_x, current_z);
-sleep_ms(1000);
+hal_sleep_ms(1000);
+
+// Conditioning (see arm_joystick.h). The first passes measure the stick's
+// centre, so leave it alone for half a second after the start move
+joystick_t stick;
+joystick_init(&stick, 2, HAL_ADC_BITS, 1000 / INPUT_PERIOD_MS);
 
+#if JOY_TELEMETRY_HZ
+// Started here so the setup moves, which nothing drains during, don't
+// overflow the ring
+telemetry_start(JOY_TELEMETRY_HZ);
+#else
 uint32_t last_print_time = 0;
+#endif
+uint64_t next_input_us = hal_time_us();
 
 while (true) {
-    // Read joystick
-    adc_select_input(0);
-    int joy_x_raw = adc_read();
-    adc_select_input(1);
-    int joy_y_raw = adc_read();
-    
-    // Calculate offset from center
-    int dead_zone = 300;
-    int offset_x = joy_x_raw - 2048;
-    int offset_y = joy_y_raw - 2048;
-    
-    // Apply dead zone
-    if (abs(offset_x) < dead_zone) offset_x = 0;
-    if (abs(offset_y) < dead_zone) offset_y = 0;
+    loop_timing_begin();
+#if JOY_TELEMETRY_HZ
+    telemetry_loop_begin();
+#endif
+    // Read joystick (averaged by the background capture, no conversion wait)
+    uint16_t joy_raw[] = {hal_adc_capture_read(0), hal_adc_capture_read(1)};
+
+    // Centred, filtered, dead zone and response curve applied, Q15
+    int16_t joy[2];
+    joystick_update(&stick, joy_raw, joy);
+    loop_timing_mark(LOOP_STAGE_ADC);
     
+#if JOY_RESOLVED_RATE
+    float vx = joy[0] * (JOY_MAX_SPEED / JOYSTICK_ONE);
+    float vz = joy[1] * (JOY_MAX_SPEED / JOYSTICK_ONE);
+
+    if (vx != 0 || vz != 0) {
+        float new_shoulder = joint_shoulder;
+        float new_elbow = joint_elbow;
+        step_2link_rates(LINK1, LINK2, &new_shoulder, &new_elbow, vx, vz, INPUT_PERIOD_MS / 1000.0f, elbow_up);
+        loop_timing_mark(LOOP_STAGE_IK);
+
+        bool moved = move_ik_joints(new_shoulder, new_elbow, MOTION_PROFILE_LINEAR, JOY_MOVE_MS);
+        loop_timing_mark(LOOP_STAGE_SERVO);
+        if (moved) {
+            joint_shoulder = new_shoulder;
+            joint_elbow = new_elbow;
+            forward_2link(LINK1, LINK2, joint_shoulder, joint_elbow, &current_x, &current_z);
+            loop_timing_mark(LOOP_STAGE_IK);
+        }
+    }
+#else
     // Convert to movement speed (mm per update)
-    float speed = 15.0;  // Max 2mm per update
-    float delta_x = (offset_x / 2048.0) * speed;
-    float delta_z = (offset_y / 2048.0) * speed;
+    // 3mm per 50ms loop = 60mm/s, the same top speed as the old 15mm per blocking 250ms loop
+    float speed = 3.0;
+    float delta_x = joy[0] * (speed / JOYSTICK_ONE);
+    float delta_z = joy[1] * (speed / JOYSTICK_ONE);
         
     // Only move if joystick is being pushed
     if (delta_x != 0 || delta_z != 0) {
         float new_x = current_x + delta_x;
         float new_z = current_z + delta_z;
         
-        // Try requested movement
-        if (calculate_2d_ik(new_x, new_z, &shoulder_angle, &elbow_angle)) {
-            // Requested movement works - do it
+        // Outside the reachable set (servo limits included): slide to the
+        // nearest reachable point, then one IK solve
+        if (!reach_map_contains(&arm_reach_2d, new_x, new_z)) {
+            reach_map_project(&arm_reach_2d, &new_x, &new_z, ARM_REACH_MARGIN);
+        }
+        loop_timing_mark(LOOP_STAGE_BOUNDARY);
+
+        bool moved = move_to_target(new_x, new_z, JOY_MOVE_MS);
+        loop_timing_mark(LOOP_STAGE_SERVO);
+        if (moved) {
             current_x = new_x;
             current_z = new_z;
-            
-            uint moving_pins[] = {SHOULDER, ELBOW};
-            int moving_nums[] = {1, 2};
-            int target_angles[] = {(int)shoulder_angle, (int)elbow_angle};
-            move_servos_coordinated(moving_pins, moving_nums, target_angles, 2, 200);
-            
-            } 
-        else {
-        // Movement failed - slide along boundary at full speed
-        float distance = sqrt(new_x*new_x + new_z*new_z);
-        
-        if (distance > (LINK1 + LINK2)) {
-            // We're trying to go beyond max reach
-            // Move along the arc tangent instead
-            
-            // Current angle on circle
-            float current_angle = atan2(current_z, current_x);
-            
-            // Determine direction of movement along arc
-            float cross = current_x * delta_z - current_z * delta_x;
-            float angle_delta = (cross > 0 ? 1 : -1) * (sqrt(delta_x*delta_x + delta_z*delta_z) / (LINK1 + LINK2));
-            
-            // New position on arc
-            float new_angle = current_angle + angle_delta;
-            float boundary_x = (LINK1 + LINK2) * cos(new_angle);
-            float boundary_z = (LINK1 + LINK2) * sin(new_angle);
-            
-            if (calculate_2d_ik(boundary_x, boundary_z, &shoulder_angle, &elbow_angle)) {
-                current_x = boundary_x;
-                current_z = boundary_z;
-                
-                uint moving_pins[] = {SHOULDER, ELBOW};
-                int moving_nums[] = {1, 2};
-                int target_angles[] = {(int)shoulder_angle, (int)elbow_angle};
-                move_servos_coordinated(moving_pins, moving_nums, target_angles, 2, 200);
-            }
         }
     }
-}
+#endif
+#if JOY_TELEMETRY_HZ
+telemetry_set_target(current_x, 0, current_z);
+telemetry_record_loop(joy_raw, 2, current_positions);
+telemetry_loop_end();
+#else
 // Print position once per second
-uint32_t current_time = to_ms_since_boot(get_absolute_time());
+uint32_t current_time = hal_time_ms();
     if (current_time - last_print_time >= 1000) {
         printf("Current position: Z=%.1f mm, X=%.1f mm\n", current_x, current_z);
         last_print_time = current_time;
 }
+#endif
+loop_timing_poll();
+loop_timing_mark(LOOP_STAGE_TELEMETRY);
 
-sleep_ms(50);  // 20Hz update rate
+// 20Hz update rate. If a pass overran, skip the missed deadlines
+// rather than running the next ones back to back
+next_input_us += INPUT_PERIOD_MS * 1000;
+uint64_t now_us = hal_time_us();
+if (next_input_us < now_us) next_input_us = now_us;
+#if JOY_TELEMETRY_HZ
+telemetry_sleep_until_us(next_input_us);
+#else
+hal_sleep_until_us(next_input_us);
+#endif
 
 }
 return 0;
 }
 
-int angle_to_pulse(int servo_num, int angle) {
-    int min_pulse, max_pulse;
-    if (servo_num < 3) {
-        min_pulse = 750;
-        max_pulse = 4600;
-    } else {
-        min_pulse = 700;
-        max_pulse = 4550;
-    }
-    return min_pulse + (angle * (max_pulse - min_pulse) / 180);
-}
+// Queues shoulder/elbow IK-frame angles at sub-degree resolution
+bool move_ik_joints(float shoulder_deg, float elbow_deg, motion_profile_type_t profile, int duration_ms) {
+    int nums[] = {1, 2};
+    int pulses[] = {angle_to_pulse_f(1, SERVO_SHOULDER_FROM_IK(shoulder_deg)),
+                    angle_to_pulse_f(2, SERVO_ELBOW_FROM_IK(elbow_deg))};
 
-void set_servo_angle(uint servo_pin, int servo_num, int angle) {
-    uint slice = pwm_gpio_to_slice_num(servo_pin);
-    uint channel = pwm_gpio_to_channel(servo_pin);
-    int target_pulse = angle_to_pulse(servo_num, angle);
-    
-    move_servo_slow(slice, channel, current_positions[servo_num], target_pulse, 1000);
-    current_positions[servo_num] = target_pulse;
+    return move_servo_pulses(nums, pulses, 2, profile, duration_ms);
 }
 
-// Slow servo movement
-void move_servo_slow(uint slice, uint channel, int start_pos, int end_pos, int duration_ms) {
-    int steps = 50;
-    int delay = duration_ms / steps;
-    
-    for (int i = 0; i <= steps; i++) {
-        int current_pos = start_pos + ((end_pos - start_pos) * i / steps);
-        pwm_set_chan_level(slice, channel, current_pos);
-        sleep_ms(delay);
-    }
-}
+// Solves (x, z) on the IK branch closest to where the arm is (with
+// hysteresis) and queues a duration_ms linear step. If that branch is more
+// than a step away, e.g. the one the arm is on just ran out, the elbow
+// reconfigures with a time-optimal S-curve instead and this waits for it.
+bool move_to_target(float x, float z, int duration_ms) {
+    arm_pose_t poses[ARM_IK_MAX_SOLUTIONS];
+    int count = calculate_2d_ik_branches(x, z, poses);
 
-// 2D IK function - returns shoulder and elbow angles
-bool calculate_2d_ik(float x, float z, float *shoulder_angle, float *elbow_angle) {
-    // Calculate distance to target
-    float distance = sqrt(x*x + z*z);
-    
-    // Check reachability
-    if (distance > (LINK1 + LINK2)) {
-        // printf("Target unreachable! Distance: %.1f, Max: %.1f\n", distance, LINK1 + LINK2);
-        return false;
-    }
-    
-    if (distance < fabs(LINK1 - LINK2)) {
-        // printf("Target too close! Minimum reach: %.1f\n", fabs(LINK1 - LINK2));
-        return false;
-    }
-    
-    // Calculate base angles using law of cosines
-    float cos_elbow = (LINK1*LINK1 + LINK2*LINK2 - distance*distance) / (2.0 * LINK1 * LINK2);
-    float angle_to_target = atan2(z, x) * 180.0 / M_PI;
-    float cos_shoulder_offset = (LINK1*LINK1 + distance*distance - LINK2*LINK2) / (2.0 * LINK1 * distance);
-    float shoulder_offset = acos(cos_shoulder_offset) * 180.0 / M_PI;
-    
-    // Two possible IK solutions
-    float shoulder_ik_1 = angle_to_target + shoulder_offset;
-    float elbow_ik_1 = 180.0 - (acos(cos_elbow) * 180.0 / M_PI);  // Invert
-    
-    float shoulder_ik_2 = angle_to_target - shoulder_offset;
-    float elbow_ik_2 = -elbow_ik_1;
-    
-    // Apply mounting offset and convert to physical servo angles for both configs
-    int shoulder_physical_1 = 90 - (int)(shoulder_ik_1 + 28);
-    int elbow_physical_1 = 90 - (int)elbow_ik_1;
-    
-    int shoulder_physical_2 = 90 - (int)(shoulder_ik_2 + 28);
-    int elbow_physical_2 = 90 - (int)elbow_ik_2;
-    
-    // Check which configuration has valid servo angles
-    bool config1_valid = (shoulder_physical_1 >= 0 && shoulder_physical_1 <= 180 && elbow_physical_1 >= 0 && elbow_physical_1 <= 180);
-    bool config2_valid = (shoulder_physical_2 >= 0 && shoulder_physical_2 <= 180 && elbow_physical_2 >= 0 && elbow_physical_2 <= 180);
-    
-    // Return the valid configuration (already converted to physical angles)
-    if (config1_valid) {
-        *shoulder_angle = shoulder_physical_1;
-        *elbow_angle = elbow_physical_1;
-        // printf("IK Config 1: Target(%.1f, %.1f) -> Servos S=%d° E=%d°\n", x, z, shoulder_physical_1, elbow_physical_1);
-        return true;
-    } else if (config2_valid) {
-        *shoulder_angle = shoulder_physical_2;
-        *elbow_angle = elbow_physical_2;
-        // printf("IK Config 2: Target(%.1f, %.1f) -> Servos S=%d° E=%d°\n", x, z, shoulder_physical_2, elbow_physical_2);
-        return true;
-    } else {
-        // printf("No valid servo angles! Config1: S=%d E=%d, Config2: S=%d E=%d\n", shoulder_physical_1, elbow_physical_1, shoulder_physical_2, elbow_physical_2);
+    arm_pose_t current = {pulse_to_angle(0, current_positions[0]), pulse_to_angle(1, current_positions[1]),
+                          pulse_to_angle(2, current_positions[2]), pulse_to_angle(4, current_positions[4]),
+                          current_config};
+    int pick = arm_ik_select_branch(poses, count, &current);
+    loop_timing_mark(LOOP_STAGE_IK);
+    if (pick < 0) return false;
+
+    int moving_nums[] = {1, 2};
+    float target_angles[] = {poses[pick].shoulder, poses[pick].elbow};
+    bool reconfigure = arm_pose_travel(&poses[pick], &current) > ARM_IK_CONTINUOUS_DEG;
+    if (reconfigure) {
+        printf("Elbow reconfiguration to config %d\n", poses[pick].config);
+        if (!move_servos_coordinated(moving_nums, target_angles, 2, MOTION_PROFILE_SCURVE, 0)) return false;
+        motion_executor_wait_idle();
+    } else if (!move_servos_coordinated(moving_nums, target_angles, 2, MOTION_PROFILE_LINEAR, duration_ms)) {
         return false;
     }
-}
 
-void move_servos_coordinated(uint servo_pins[], int servo_nums[], int target_angles[], int num_servos, int duration_ms) {
-    int steps = 50;
-    int delay = duration_ms / steps;
-    
-    // Get starting pulse values for each servo
-    int start_pulses[num_servos];
-    int end_pulses[num_servos];
-    uint slices[num_servos];
-    uint channels[num_servos];
-    
-    for (int i = 0; i < num_servos; i++) {
-        start_pulses[i] = current_positions[servo_nums[i]];
-        end_pulses[i] = angle_to_pulse(servo_nums[i], target_angles[i]);
-        slices[i] = pwm_gpio_to_slice_num(servo_pins[i]);
-        channels[i] = pwm_gpio_to_channel(servo_pins[i]);
-    }
-    
-    // Move all servos together in small increments
-    for (int step = 0; step <= steps; step++) {
-        for (int i = 0; i < num_servos; i++) {
-            int current_pulse = start_pulses[i] + 
-                              ((end_pulses[i] - start_pulses[i]) * step / steps);
-            pwm_set_chan_level(slices[i], channels[i], current_pulse);
-        }
-        sleep_ms(delay);
-    }
-    
-    // Update tracked positions
-    for (int i = 0; i < num_servos; i++) {
-        current_positions[servo_nums[i]] = end_pulses[i];
-    }
-}
\ No newline at end of file
+    current_config = poses[pick].config;
+    return true;
+}
@@ -0,0 +1,181 @@
+/*
+ * Generates arduino/2d_js_control/ik_table.h, the PROGMEM lookup table the
+ * Nano uses in place of calling sqrt/atan2/acos on every joystick tick.
+ *
+ * Usage: gen_ik_table <output header>
+ * (or build the arduino_ik_table target of the sim/ CMake project)
+ *
+ * The table samples the physical shoulder/elbow servo angles on a square
+ * (x, z) grid. A cell is marked valid only if all four corners solve with
+ * the same IK configuration and bilinear interpolation stays within
+ * MAX_ERROR_DEG of the exact solution everywhere inside it. The firmware
+ * falls back to the exact solver for invalid cells, which are the ones at
+ * the workspace edges and across the config 1/config 2 border.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+#include "arm_config.h"  // LINK1, LINK2, SHOULDER_MOUNT_OFFSET
+
+#define STEP          12     // Grid pitch in mm
+#define SCALE         64     // Table units per degree
+#define MAX_ERROR_DEG 1.0    // Same as the truncation error of the int angles
+#define CHECK_POINTS  8      // Error samples per cell edge
+
+#define SEARCH_MIN -324
+#define SEARCH_MAX  324
+
+// Exact solve, returning untruncated physical angles. Config selection
+// follows the firmware, including its int truncation, so cell configs
+// agree with what the exact fallback would pick.
+static int solve(double x, double z, double *shoulder, double *elbow) {
+    double distance = sqrt(x * x + z * z);
+    if (distance > LINK1 + LINK2 || distance < fabs(LINK1 - LINK2)) return 0;
+
+    double cos_elbow = (LINK1 * LINK1 + LINK2 * LINK2 - distance * distance) / (2.0 * LINK1 * LINK2);
+    double angle_to_target = atan2(z, x) * 180.0 / M_PI;
+    double cos_shoulder_offset = (LINK1 * LINK1 + distance * distance - LINK2 * LINK2) / (2.0 * LINK1 * distance);
+    double shoulder_offset = acos(cos_shoulder_offset) * 180.0 / M_PI;
+    double elbow_ik = 180.0 - acos(cos_elbow) * 180.0 / M_PI;
+
+    double s1 = 90 - (angle_to_target + shoulder_offset + SHOULDER_MOUNT_OFFSET);
+    double e1 = 90 - elbow_ik;
+    double s2 = 90 - (angle_to_target - shoulder_offset + SHOULDER_MOUNT_OFFSET);
+    double e2 = 90 + elbow_ik;
+
+    int s1i = 90 - (int)(angle_to_target + shoulder_offset + SHOULDER_MOUNT_OFFSET);
+    int e1i = 90 - (int)elbow_ik;
+    int s2i = 90 - (int)(angle_to_target - shoulder_offset + SHOULDER_MOUNT_OFFSET);
+    int e2i = 90 - (int)(-elbow_ik);
+
+    if (s1i >= 0 && s1i <= 180 && e1i >= 0 && e1i <= 180) {
+        *shoulder = s1;
+        *elbow = e1;
+        return 1;
+    }
+    if (s2i >= 0 && s2i <= 180 && e2i >= 0 && e2i <= 180) {
+        *shoulder = s2;
+        *elbow = e2;
+        return 2;
+    }
+    return 0;
+}
+
+static bool cell_ok(int x0, int z0) {
+    double s[4], e[4];
+    int config = 0;
+
+    for (int c = 0; c < 4; c++) {
+        int cfg = solve(x0 + (c & 1) * STEP, z0 + (c >> 1) * STEP, &s[c], &e[c]);
+        if (cfg == 0 || (config && cfg != config)) return false;
+        config = cfg;
+    }
+
+    for (int i = 0; i <= CHECK_POINTS; i++) {
+        for (int j = 0; j <= CHECK_POINTS; j++) {
+            double fx = (double)i / CHECK_POINTS;
+            double fz = (double)j / CHECK_POINTS;
+            double se, ee;
+            if (solve(x0 + fx * STEP, z0 + fz * STEP, &se, &ee) != config) return false;
+
+            double si = (s[0] * (1 - fx) + s[1] * fx) * (1 - fz) + (s[2] * (1 - fx) + s[3] * fx) * fz;
+            double ei = (e[0] * (1 - fx) + e[1] * fx) * (1 - fz) + (e[2] * (1 - fx) + e[3] * fx) * fz;
+            if (fabs(si - se) > MAX_ERROR_DEG || fabs(ei - ee) > MAX_ERROR_DEG) return false;
+        }
+    }
+    return true;
+}
+
+static void write_array(FILE *f, const char *name, int x0, int z0, int cols, int rows, bool elbow) {
+    fprintf(f, "const uint16_t %s[IK_TABLE_ROWS * IK_TABLE_COLS] PROGMEM = {\n", name);
+    for (int r = 0; r < rows; r++) {
+        fprintf(f, "   ");
+        for (int c = 0; c < cols; c++) {
+            double s = 0, e = 0;
+            solve(x0 + c * STEP, z0 + r * STEP, &s, &e);
+            double v = elbow ? e : s;
+            if (v < 0) v = 0;
+            fprintf(f, " %5d,", (int)lround(v * SCALE));
+        }
+        fprintf(f, "\n");
+    }
+    fprintf(f, "};\n\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <output header>\n", argv[0]);
+        return 1;
+    }
+
+    // Find the bounding box of valid cells so empty rows/cols aren't stored
+    int n = (SEARCH_MAX - SEARCH_MIN) / STEP;
+    int min_c = n, max_c = -1, min_r = n, max_r = -1;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            if (!cell_ok(SEARCH_MIN + c * STEP, SEARCH_MIN + r * STEP)) continue;
+            if (c < min_c) min_c = c;
+            if (c > max_c) max_c = c;
+            if (r < min_r) min_r = r;
+            if (r > max_r) max_r = r;
+        }
+    }
+
+    int x0 = SEARCH_MIN + min_c * STEP;
+    int z0 = SEARCH_MIN + min_r * STEP;
+    int cell_cols = max_c - min_c + 1;
+    int cell_rows = max_r - min_r + 1;
+    int cols = cell_cols + 1;
+    int rows = cell_rows + 1;
+
+    FILE *f = fopen(argv[1], "w");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(f, "// Generated by tools/gen_ik_table.c - do not edit\n");
+    fprintf(f, "// LINK1=%.0f LINK2=%.0f, shoulder mount offset %.0f deg\n", LINK1, LINK2, (double)SHOULDER_MOUNT_OFFSET);
+    fprintf(f, "// Bilinear error inside valid cells <= %.1f deg\n\n", MAX_ERROR_DEG);
+    fprintf(f, "#ifndef IK_TABLE_H\n#define IK_TABLE_H\n\n");
+    fprintf(f, "#include <avr/pgmspace.h>\n\n");
+    fprintf(f, "#define IK_TABLE_X0    %d     // mm, first grid column\n", x0);
+    fprintf(f, "#define IK_TABLE_Z0    %d     // mm, first grid row\n", z0);
+    fprintf(f, "#define IK_TABLE_STEP  %d       // mm between grid points\n", STEP);
+    fprintf(f, "#define IK_TABLE_COLS  %d\n", cols);
+    fprintf(f, "#define IK_TABLE_ROWS  %d\n", rows);
+    fprintf(f, "#define IK_TABLE_SCALE %d       // Table units per degree\n\n", SCALE);
+
+    write_array(f, "ik_table_shoulder", x0, z0, cols, rows, false);
+    write_array(f, "ik_table_elbow", x0, z0, cols, rows, true);
+
+    // One bit per cell, row-major, LSB first
+    int cells = cell_cols * cell_rows;
+    int valid = 0;
+    fprintf(f, "// Cell (col, row) is valid if bit (row * %d + col) is set\n", cell_cols);
+    fprintf(f, "const uint8_t ik_table_cell_valid[%d] PROGMEM = {\n", (cells + 7) / 8);
+    for (int byte = 0; byte < (cells + 7) / 8; byte++) {
+        uint8_t bits = 0;
+        for (int b = 0; b < 8; b++) {
+            int cell = byte * 8 + b;
+            if (cell >= cells) break;
+            int c = cell % cell_cols;
+            int r = cell / cell_cols;
+            if (cell_ok(x0 + c * STEP, z0 + r * STEP)) {
+                bits |= 1 << b;
+                valid++;
+            }
+        }
+        fprintf(f, "%s0x%02x,%s", byte % 12 == 0 ? "    " : " ", bits, byte % 12 == 11 ? "\n" : "");
+    }
+    if (((cells + 7) / 8) % 12 != 0) fprintf(f, "\n");
+    fprintf(f, "};\n\n#endif\n");
+    fclose(f);
+
+    printf("%s: %dx%d grid, %d/%d valid cells, %d bytes\n", argv[1], cols, rows, valid, cells,
+           (int)(2 * 2 * cols * rows + (cells + 7) / 8));
+    return 0;
+}
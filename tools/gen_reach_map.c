@@ -0,0 +1,208 @@
+/*
+ * Generates arm_core/arm_reach_map.h, signed distance maps of the
+ * reachable workspace that arm_reach.c uses for O(1) reachability checks
+ * and for projecting unreachable targets onto the workspace.
+ *
+ * Usage: gen_reach_map <output header>
+ * (or build the arm_reach_map target of the sim/ CMake project)
+ *
+ * The reachable set is everything forward kinematics can reach with the
+ * joints inside the servo ranges, so it includes the servo limits and the
+ * 28 degree shoulder mount offset, not just the LINK1 + LINK2 annulus. Two
+ * maps, both in the shoulder's vertical plane:
+ *   2d:    the pointer tip for calculate_2d_ik (LINK1, LINK2)
+ *   wrist: the wrist pitch axis for calculate_arm_ik (LINK1, FOREARM_LENGTH)
+ *          with the pointer at WRIST_PITCH_DEG, so the wrist servo range is
+ *          a limit too
+ *
+ * Each grid node holds the distance to the boundary, negative inside.
+ * Boundary points come from sweeping the edges of the allowed joint region
+ * plus the straight-arm line (where the map folds over), keeping only the
+ * ones that really have unreachable space next to them.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+#include "arm_config.h"  // Link lengths, mount offset, WRIST_PITCH_STRAIGHT
+
+#define WRIST_PITCH_DEG 0.0  // Pointer level, the 2_js approach angle
+
+#define STEP        6      // Grid pitch in mm
+#define SCALE       16     // Table units per mm
+#define MARGIN      12     // mm of grid kept around the reachable set
+#define SWEEP_DEG   0.02   // Joint step when tracing the boundary
+#define PROBE_MM    0.25   // Neighbourhood checked to confirm a boundary point
+
+#define DEG (M_PI / 180.0)
+
+typedef struct {
+    const char *name;
+    double link2;
+    bool wrist;  // Apply the wrist servo range at WRIST_PITCH_DEG
+} map_spec_t;
+
+static const map_spec_t maps[] = {
+    {"2d", LINK2, false},
+    {"wrist", FOREARM_LENGTH, true},
+};
+
+// Joint limits in IK-frame degrees: shoulder above horizontal, elbow bend
+#define SHOULDER_MIN (90.0 - SHOULDER_MOUNT_OFFSET - 180.0)
+#define SHOULDER_MAX (90.0 - SHOULDER_MOUNT_OFFSET)
+#define ELBOW_MIN    -90.0
+#define ELBOW_MAX    90.0
+// Forearm angle limits from the wrist servo: 0 <= 145 - (f - pitch) <= 180
+#define FOREARM_MIN  (WRIST_PITCH_DEG + WRIST_PITCH_STRAIGHT - 180.0)
+#define FOREARM_MAX  (WRIST_PITCH_DEG + WRIST_PITCH_STRAIGHT)
+
+static bool joints_ok(const map_spec_t *m, double a, double b) {
+    const double eps = 1e-9;
+    if (a < SHOULDER_MIN - eps || a > SHOULDER_MAX + eps) return false;
+    if (b < ELBOW_MIN - eps || b > ELBOW_MAX + eps) return false;
+    if (m->wrist && (a - b < FOREARM_MIN - eps || a - b > FOREARM_MAX + eps)) return false;
+    return true;
+}
+
+static bool reachable(const map_spec_t *m, double x, double z) {
+    double d2 = x * x + z * z;
+    double d = sqrt(d2);
+    if (d > LINK1 + m->link2 || d < fabs(LINK1 - m->link2)) return false;
+
+    double c = (LINK1 * LINK1 + m->link2 * m->link2 - d2) / (2.0 * LINK1 * m->link2);
+    double bend = 180.0 - acos(fmax(-1.0, fmin(1.0, c))) / DEG;
+    double co = (LINK1 * LINK1 + d2 - m->link2 * m->link2) / (2.0 * LINK1 * d);
+    double offset = acos(fmax(-1.0, fmin(1.0, co))) / DEG;
+    double to_target = atan2(z, x) / DEG;
+
+    return joints_ok(m, to_target + offset, bend) || joints_ok(m, to_target - offset, -bend);
+}
+
+static int num_boundary = 0, cap_boundary = 0;
+static double *boundary_x, *boundary_z;
+
+static void add_candidate(const map_spec_t *m, double a, double b) {
+    if (!joints_ok(m, a, b)) return;
+
+    double x = LINK1 * cos(a * DEG) + m->link2 * cos((a - b) * DEG);
+    double z = LINK1 * sin(a * DEG) + m->link2 * sin((a - b) * DEG);
+
+    // Joint-space edges that map into the middle of the workspace aren't
+    // boundary: keep the point only if some neighbour is unreachable
+    bool outside = false;
+    for (int k = 0; k < 16 && !outside; k++) {
+        double t = k * (2.0 * M_PI / 16);
+        outside = !reachable(m, x + PROBE_MM * cos(t), z + PROBE_MM * sin(t));
+    }
+    if (!outside) return;
+
+    if (num_boundary == cap_boundary) {
+        cap_boundary = cap_boundary ? cap_boundary * 2 : 4096;
+        boundary_x = realloc(boundary_x, cap_boundary * sizeof(double));
+        boundary_z = realloc(boundary_z, cap_boundary * sizeof(double));
+    }
+    boundary_x[num_boundary] = x;
+    boundary_z[num_boundary] = z;
+    num_boundary++;
+}
+
+static void trace_boundary(const map_spec_t *m) {
+    num_boundary = 0;
+    for (double t = SHOULDER_MIN; t <= SHOULDER_MAX + 1e-9; t += SWEEP_DEG) {
+        add_candidate(m, t, ELBOW_MIN);
+        add_candidate(m, t, ELBOW_MAX);
+        add_candidate(m, t, 0.0);  // Straight arm: outer reach
+        if (m->wrist) {
+            add_candidate(m, t, t - FOREARM_MIN);
+            add_candidate(m, t, t - FOREARM_MAX);
+        }
+    }
+    for (double t = ELBOW_MIN; t <= ELBOW_MAX + 1e-9; t += SWEEP_DEG) {
+        add_candidate(m, SHOULDER_MIN, t);
+        add_candidate(m, SHOULDER_MAX, t);
+    }
+}
+
+static double signed_distance(const map_spec_t *m, double x, double z) {
+    double best = INFINITY;
+    for (int i = 0; i < num_boundary; i++) {
+        double dx = x - boundary_x[i];
+        double dz = z - boundary_z[i];
+        double d2 = dx * dx + dz * dz;
+        if (d2 < best) best = d2;
+    }
+    return reachable(m, x, z) ? -sqrt(best) : sqrt(best);
+}
+
+static void write_map(FILE *f, const map_spec_t *m) {
+    trace_boundary(m);
+
+    // Grid bounds: the boundary's bounding box plus MARGIN, on whole steps
+    double min_x = INFINITY, max_x = -INFINITY, min_z = INFINITY, max_z = -INFINITY;
+    for (int i = 0; i < num_boundary; i++) {
+        min_x = fmin(min_x, boundary_x[i]);
+        max_x = fmax(max_x, boundary_x[i]);
+        min_z = fmin(min_z, boundary_z[i]);
+        max_z = fmax(max_z, boundary_z[i]);
+    }
+    int x0 = (int)floor((min_x - MARGIN) / STEP) * STEP;
+    int z0 = (int)floor((min_z - MARGIN) / STEP) * STEP;
+    int cols = (int)ceil((max_x + MARGIN - x0) / STEP) + 1;
+    int rows = (int)ceil((max_z + MARGIN - z0) / STEP) + 1;
+
+    fprintf(f, "#define ARM_REACH_%s_X0   %d\n", m->wrist ? "WRIST" : "2D", x0);
+    fprintf(f, "#define ARM_REACH_%s_Z0   %d\n", m->wrist ? "WRIST" : "2D", z0);
+    fprintf(f, "#define ARM_REACH_%s_COLS %d\n", m->wrist ? "WRIST" : "2D", cols);
+    fprintf(f, "#define ARM_REACH_%s_ROWS %d\n\n", m->wrist ? "WRIST" : "2D", rows);
+
+    fprintf(f, "static const int16_t arm_reach_%s_sdf[%d] ARM_FLASH = {\n", m->name, cols * rows);
+
+    int inside = 0;
+    for (int r = 0; r < rows; r++) {
+        fprintf(f, "   ");
+        for (int c = 0; c < cols; c++) {
+            double d = signed_distance(m, x0 + c * STEP, z0 + r * STEP);
+            if (d < 0) inside++;
+            fprintf(f, " %d,", (int)lround(d * SCALE));
+        }
+        fprintf(f, "\n");
+    }
+    fprintf(f, "};\n\n");
+
+    printf("%s map: %dx%d nodes (%d inside), %d boundary points, %d bytes\n", m->name, cols, rows,
+           inside, num_boundary, (int)(cols * rows * sizeof(int16_t)));
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <output header>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *f = fopen(argv[1], "w");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(f, "// Generated by tools/gen_reach_map.c - do not edit\n");
+    fprintf(f, "// LINK1=%.0f LINK2=%.0f FOREARM=%.0f, shoulder mount offset %.0f deg,\n",
+            LINK1, LINK2, FOREARM_LENGTH, (double)SHOULDER_MOUNT_OFFSET);
+    fprintf(f, "// servos 0-180, wrist map at pointer pitch %.0f deg\n\n", WRIST_PITCH_DEG);
+    fprintf(f, "#ifndef ARM_REACH_MAP_H\n#define ARM_REACH_MAP_H\n\n");
+    fprintf(f, "#include <stdint.h>\n#include \"arm_board.h\"\n\n");
+    fprintf(f, "#define ARM_REACH_STEP  %d      // mm between grid nodes\n", STEP);
+    fprintf(f, "#define ARM_REACH_SCALE %d     // Table units per mm\n", SCALE);
+    fprintf(f, "#define ARM_REACH_WRIST_PITCH %.1ff  // Pointer pitch the wrist map is built for\n\n",
+            WRIST_PITCH_DEG);
+
+    for (unsigned i = 0; i < sizeof(maps) / sizeof(maps[0]); i++) {
+        write_map(f, &maps[i]);
+    }
+
+    fprintf(f, "#endif\n");
+    fclose(f);
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * Generates arm_core/arm_servo_table.h, the per-servo angle -> PWM level
+ * tables behind angle_to_pulse() and servo_angle_to_pulse().
+ *
+ * Usage: gen_servo_table <output header>
+ * (or build the arm_servo_table target of the sim/ CMake project)
+ *
+ * Each joint gets its own calibration: the Pico counts (~0.512us each) at
+ * 0 and 180 degrees, measured with servo-control/servo.c, plus a correction
+ * curve for the servo's nonlinearity. The curve is the measured error from
+ * the straight line in counts at every 22.5 degrees; it is interpolated
+ * with a Catmull-Rom spline and baked into one entry per degree, so the
+ * firmware only blends two neighbouring entries.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define CURVE_POINTS 9  // 0, 22.5, .. 180 degrees
+#define TABLE_POINTS 181
+
+typedef struct {
+    const char *joint;
+    const char *unit;
+    int pulse_0;    // Counts at 0 degrees
+    int pulse_180;  // Counts at 180 degrees
+    double correction[CURVE_POINTS];  // Counts to add to the straight line
+} servo_cal_t;
+
+// Arm servo order: base, shoulder, elbow, wrist roll, wrist pitch.
+// No correction curves have been measured yet; fill them in from a sweep
+// against a protractor and regenerate.
+static const servo_cal_t servos[] = {
+    {"base",        "MG995",    750, 4600, {0}},
+    {"shoulder",    "MG995",    750, 4600, {0}},
+    {"elbow",       "MG995",    750, 4600, {0}},
+    {"wrist roll",  "SG90 #3",  850, 4650, {0}},  // The unit that reads 150-300 high
+    {"wrist pitch", "SG90",     700, 4550, {0}},
+};
+#define NUM_SERVOS (sizeof(servos) / sizeof(servos[0]))
+
+static double catmull_rom(const double *p, double deg) {
+    double t = deg / (180.0 / (CURVE_POINTS - 1));
+    int i = (int)t;
+    if (i >= CURVE_POINTS - 1) i = CURVE_POINTS - 2;
+    t -= i;
+
+    // End points are mirrored so the curve doesn't kink at 0 and 180
+    double p0 = i > 0 ? p[i - 1] : 2 * p[0] - p[1];
+    double p1 = p[i];
+    double p2 = p[i + 1];
+    double p3 = i + 2 < CURVE_POINTS ? p[i + 2] : 2 * p[i + 1] - p[i];
+
+    return 0.5 * (2 * p1 + (p2 - p0) * t + (2 * p0 - 5 * p1 + 4 * p2 - p3) * t * t +
+                  (3 * p1 - p0 - 3 * p2 + p3) * t * t * t);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <output header>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *f = fopen(argv[1], "w");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(f, "// Generated by tools/gen_servo_table.c - do not edit\n");
+    fprintf(f, "// PWM level (Pico counts) per whole degree, calibration curve applied\n\n");
+    fprintf(f, "#ifndef ARM_SERVO_TABLE_H\n#define ARM_SERVO_TABLE_H\n\n");
+    fprintf(f, "#include <stdint.h>\n#include \"arm_board.h\"\n\n");
+    fprintf(f, "#define SERVO_TABLE_SERVOS %d\n", (int)NUM_SERVOS);
+    fprintf(f, "#define SERVO_TABLE_POINTS %d\n\n", TABLE_POINTS);
+    fprintf(f, "static const uint16_t servo_pulse_table[SERVO_TABLE_SERVOS][SERVO_TABLE_POINTS] ARM_FLASH = {\n");
+
+    for (unsigned s = 0; s < NUM_SERVOS; s++) {
+        const servo_cal_t *cal = &servos[s];
+        fprintf(f, "    // %d: %s, %s, %d-%d\n    {", s, cal->joint, cal->unit, cal->pulse_0, cal->pulse_180);
+
+        int prev = -1;
+        for (int deg = 0; deg < TABLE_POINTS; deg++) {
+            double line = cal->pulse_0 + (cal->pulse_180 - cal->pulse_0) * deg / 180.0;
+            int pulse = (int)lround(line + catmull_rom(cal->correction, deg));
+            if (pulse <= prev) {
+                fprintf(stderr, "%s: correction makes the table non-monotonic at %d deg\n", cal->joint, deg);
+                return 1;
+            }
+            prev = pulse;
+            fprintf(f, "%s%d,", deg % 16 == 0 ? "\n        " : " ", pulse);
+        }
+        fprintf(f, "\n    },\n");
+    }
+    fprintf(f, "};\n\n#endif\n");
+    fclose(f);
+
+    printf("%s: %d servos x %d entries\n", argv[1], (int)NUM_SERVOS, TABLE_POINTS);
+    return 0;
+}
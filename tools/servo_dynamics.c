@@ -0,0 +1,455 @@
+/*
+ * Offline servo dynamics: plays a sim PWM log (ARM_SIM_PWM_LOG) through a
+ * model of the arm's servos and reports how well the arm would have
+ * followed it.
+ *
+ * Usage: servo_dynamics [-o trace.csv] <pwm.csv | -> [more pwm.csv ...]
+ * (built by the sim/ CMake project)
+ *
+ *   ARM_SIM_ADC_SCRIPT=sim/scripts/push_forward_up.txt ARM_SIM_PWM_LOG=a.csv ./build-sim/ik_js_control_sim
+ *   ./build-sim/servo_dynamics a.csv b.csv        one column per run
+ *
+ * Each servo (MG995 on 0-2, SG90 on 3-4) is modelled at 1kHz:
+ *   - it only sees the PWM level at the start of each 20ms frame (the
+ *     Pico latches a new level at the wrap, the servo measures one pulse)
+ *   - it doesn't drive while within half its deadband of that target
+ *   - outside it, a proportional speed command capped at the rated speed
+ *   - gravity load on the shoulder, elbow and wrist pitch (link geometry
+ *     from arm_ik.h, masses below) slows moves against it along the
+ *     servo's torque-speed line and stretches its response lag
+ * Angles come from the calibration tables, so the model sees what the
+ * firmware meant by each level.
+ *
+ * Reported per run:
+ *   tip error        commanded tip (forward kinematics of the levels being
+ *                    written) against the modelled tip: RMS while the
+ *                    commands are moving, max, and mean once settled
+ *   settle time      from the last command change before a pause of at
+ *                    least REST_MS until every servo has stopped inside
+ *                    its deadband
+ *   latency          when a servo's command sets off from rest, from the
+ *                    command having moved LATENCY_DEG until the modelled
+ *                    servo has
+ *   peak accel       largest modelled joint acceleration per servo
+ * With -o, a per-millisecond trace of commanded and modelled angles and
+ * tip positions for the first log.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "arm_ik.h"
+#include "arm_servo.h"
+
+#define NUM_SERVOS 5
+
+// Must match the pin definitions in the apps: servo i is on gpio SERVO_PIN_FIRST - i
+#define SERVO_PIN_FIRST 15
+
+#define DT_S          0.001
+#define FRAME_MS      20     // 50Hz servo frames
+#define REST_MS       100    // Commands unchanged this long count as a pause
+#define LATENCY_DEG   0.5
+#define STOPPED_DEG_S 1.0
+#define GRAVITY       9.81
+#define DEG_TO_RAD    0.0174532925
+
+typedef struct {
+    const char *model;
+    double max_speed;     // deg/s, no load
+    double stall_torque;  // Nm
+    double deadband;      // deg
+    double gain;          // 1/s, speed command per degree of error
+    double lag;           // s, motor speed response with no load
+} servo_model_t;
+
+// Nominal datasheet values at 5V. Deadbands are 5us (MG995) and 10us
+// (SG90) at ~11us per degree.
+static const servo_model_t MG995 = {"MG995", 300.0, 0.85, 0.45, 50.0, 0.030};
+static const servo_model_t SG90 = {"SG90", 600.0, 0.18, 0.9, 80.0, 0.015};
+static const servo_model_t *servo_models[NUM_SERVOS] = {&MG995, &MG995, &MG995, &SG90, &SG90};
+
+// Masses in kg, estimated. Upper arm and elbow servo hang off the
+// shoulder; forearm, the two SG90s at the wrist and the pointer off both.
+#define UPPER_ARM_MASS 0.030  // At LINK1 / 2
+#define ELBOW_MASS     0.075  // MG995 and bracket, at the elbow
+#define FOREARM_MASS   0.030  // At FOREARM_LENGTH / 2
+#define WRIST_MASS     0.025  // At the wrist pitch axis
+#define POINTER_MASS   0.010  // At POINTER_LENGTH / 2
+
+typedef struct {
+    double pos, vel;      // Modelled angle and speed
+    double target;        // Angle sampled at the last frame
+    double peak_accel;
+} servo_state_t;
+
+typedef struct {
+    const char *path;
+    double seconds;
+    double tip_rms_moving, tip_max, tip_rest_mean;
+    int settles, unsettled;
+    double settle_median, settle_max;
+    int latencies;
+    double latency_mean, latency_max;
+    double peak_accel[NUM_SERVOS];
+} run_result_t;
+
+typedef struct {
+    uint64_t t_us;
+    int servo;
+    int level;
+} pwm_write_t;
+
+static int servo_for_gpio(int gpio) {
+    int servo = SERVO_PIN_FIRST - gpio;
+    return servo >= 0 && servo < NUM_SERVOS ? servo : -1;
+}
+
+static pwm_write_t *load_log(const char *path, int *count) {
+    FILE *f = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return NULL;
+    }
+    int capacity = 4096;
+    pwm_write_t *writes = malloc(capacity * sizeof(pwm_write_t));
+    *count = 0;
+
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long long t;
+        int gpio, level;
+        if (sscanf(line, "%llu,%d,%d", &t, &gpio, &level) != 3) continue;  // Header
+        int servo = servo_for_gpio(gpio);
+        if (servo < 0) continue;
+        if (*count == capacity) {
+            capacity *= 2;
+            writes = realloc(writes, capacity * sizeof(pwm_write_t));
+        }
+        writes[(*count)++] = (pwm_write_t){t, servo, level};
+    }
+    if (f != stdin) fclose(f);
+    return writes;
+}
+
+// Tip from servo angles, full arm (base yaw, shoulder, elbow, wrist pitch)
+static void tip_position(const double angle[NUM_SERVOS], double tip[3]) {
+    double shoulder_ik = IK_SHOULDER_FROM_SERVO(angle[1]);
+    double elbow_ik = IK_ELBOW_FROM_SERVO(angle[2]);
+    double pointer = shoulder_ik - elbow_ik - (WRIST_PITCH_STRAIGHT - angle[4]);
+
+    float u, v;
+    forward_2link(LINK1, FOREARM_LENGTH, (float)shoulder_ik, (float)elbow_ik, &u, &v);
+    double radial = SHOULDER_OFFSET + u + POINTER_LENGTH * cos(pointer * DEG_TO_RAD);
+    double yaw = (angle[0] - 90.0) * DEG_TO_RAD;
+    tip[0] = radial * cos(yaw);
+    tip[1] = radial * sin(yaw);
+    tip[2] = BASE_HEIGHT + v + POINTER_LENGTH * sin(pointer * DEG_TO_RAD);
+}
+
+// Gravity torque on each servo in its positive angle direction, Nm
+static void gravity_torque(const double angle[NUM_SERVOS], double torque[NUM_SERVOS]) {
+    double a = IK_SHOULDER_FROM_SERVO(angle[1]) * DEG_TO_RAD;
+    double f = a - IK_ELBOW_FROM_SERVO(angle[2]) * DEG_TO_RAD;
+    double p = f - (WRIST_PITCH_STRAIGHT - angle[4]) * DEG_TO_RAD;
+
+    // Horizontal lever arms in m, from the elbow and from the wrist
+    double from_wrist = POINTER_MASS * POINTER_LENGTH / 2 * cos(p);
+    double from_elbow = FOREARM_MASS * FOREARM_LENGTH / 2 * cos(f) + WRIST_MASS * FOREARM_LENGTH * cos(f) +
+                        POINTER_MASS * FOREARM_LENGTH * cos(f) + from_wrist;
+    double elbow_x = LINK1 * cos(a);
+    double from_shoulder = UPPER_ARM_MASS * elbow_x / 2 + ELBOW_MASS * elbow_x +
+                           (FOREARM_MASS + WRIST_MASS + POINTER_MASS) * elbow_x + from_elbow;
+
+    // Raising the shoulder servo angle lowers the arm; raising the elbow and
+    // wrist pitch angles lifts the forearm and pointer
+    torque[0] = 0.0;
+    torque[1] = GRAVITY * from_shoulder / 1000.0;
+    torque[2] = -GRAVITY * from_elbow / 1000.0;
+    torque[3] = 0.0;
+    torque[4] = -GRAVITY * from_wrist / 1000.0;
+}
+
+static void step_servo(servo_state_t *s, const servo_model_t *m, double torque) {
+    double err = s->target - s->pos;
+    double speed_cmd = 0.0;
+    if (fabs(err) > m->deadband / 2) {
+        speed_cmd = m->gain * err;
+        if (speed_cmd > m->max_speed) speed_cmd = m->max_speed;
+        if (speed_cmd < -m->max_speed) speed_cmd = -m->max_speed;
+    }
+
+    // Load against the move slows it and the motor's response; load with
+    // it is held back by the servo's own braking
+    double load = speed_cmd * torque < 0.0 ? fabs(torque) / m->stall_torque : 0.0;
+    if (load > 0.95) load = 0.95;
+    speed_cmd *= 1.0 - load;
+    double lag = m->lag / (1.0 - load);
+
+    double accel = (speed_cmd - s->vel) / lag;
+    if (lag < DT_S) accel = (speed_cmd - s->vel) / DT_S;
+    if (fabs(accel) > s->peak_accel) s->peak_accel = fabs(accel);
+    s->vel += accel * DT_S;
+    s->pos += s->vel * DT_S;
+}
+
+typedef struct {
+    double *times;
+    int capacity;
+} settle_log_t;
+
+static void add_settle(run_result_t *r, settle_log_t *log, double ms) {
+    if (r->settles == log->capacity) {
+        log->capacity *= 2;
+        log->times = realloc(log->times, log->capacity * sizeof(double));
+    }
+    log->times[r->settles++] = ms;
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return x < y ? -1 : x > y;
+}
+
+static bool run(const char *path, FILE *trace, run_result_t *r) {
+    int count;
+    pwm_write_t *writes = load_log(path, &count);
+    if (!writes) return false;
+    memset(r, 0, sizeof(*r));
+    r->path = path;
+
+    // Start once every servo has been written; each starts where it's sent
+    int level[NUM_SERVOS];
+    bool seen[NUM_SERVOS] = {false};
+    int num_seen = 0, w = 0;
+    while (w < count && num_seen < NUM_SERVOS) {
+        if (!seen[writes[w].servo]) num_seen++;
+        seen[writes[w].servo] = true;
+        level[writes[w].servo] = writes[w].level;
+        w++;
+    }
+    if (num_seen < NUM_SERVOS || w == count) {
+        fprintf(stderr, "%s: not every servo is driven\n", path);
+        free(writes);
+        return false;
+    }
+    uint64_t start_ms = writes[w - 1].t_us / 1000 + 1;
+    uint64_t end_ms = writes[count - 1].t_us / 1000 + 2000;  // Time to settle after the last write
+
+    servo_state_t servo[NUM_SERVOS];
+    for (int i = 0; i < NUM_SERVOS; i++) {
+        double angle = pulse_to_angle(i, level[i]);
+        servo[i] = (servo_state_t){angle, 0.0, angle, 0.0};
+    }
+
+    // Command change tracking
+    uint64_t last_change_ms = start_ms, servo_change_ms[NUM_SERVOS];
+    // Latency: armed when a servo's command leaves rest, timed from the
+    // command crossing LATENCY_DEG to the modelled servo crossing it
+    bool latency_armed[NUM_SERVOS];
+    int64_t latency_from[NUM_SERVOS];  // -1 until the command has crossed
+    double latency_cmd[NUM_SERVOS], latency_pos[NUM_SERVOS];
+    for (int i = 0; i < NUM_SERVOS; i++) {
+        servo_change_ms[i] = start_ms;
+        latency_armed[i] = false;
+    }
+    bool settled = true;        // This pause is already counted
+    int64_t settled_from = -1;  // Start of the current run of settled ticks
+    settle_log_t settle_log = {malloc(256 * sizeof(double)), 256};
+
+    double moving_sq = 0.0, rest_sum = 0.0;
+    long moving_ticks = 0, rest_ticks = 0;
+    double latency_sum = 0.0;
+
+    if (trace) {
+        fprintf(trace, "t_ms");
+        for (int i = 0; i < NUM_SERVOS; i++) fprintf(trace, ",cmd%d,act%d", i, i);
+        fprintf(trace, ",cmd_x,cmd_y,cmd_z,act_x,act_y,act_z,tip_err\n");
+    }
+
+    for (uint64_t t = start_ms; t < end_ms; t++) {
+        // Writes up to now
+        while (w < count && writes[w].t_us < t * 1000) {
+            int i = writes[w].servo;
+            if (writes[w].level != level[i]) {
+                if (t - servo_change_ms[i] >= REST_MS && !latency_armed[i]) {
+                    latency_armed[i] = true;
+                    latency_from[i] = -1;
+                    latency_cmd[i] = pulse_to_angle(i, level[i]);
+                    latency_pos[i] = servo[i].pos;
+                }
+                if (!settled && t - last_change_ms >= REST_MS) {
+                    if (settled_from >= (int64_t)last_change_ms) {
+                        add_settle(r, &settle_log, (double)((uint64_t)settled_from - last_change_ms));
+                    } else {
+                        r->unsettled++;
+                    }
+                }
+                level[i] = writes[w].level;
+                servo_change_ms[i] = t;
+                last_change_ms = t;
+                settled = false;
+            }
+            w++;
+        }
+
+        double command[NUM_SERVOS], actual[NUM_SERVOS], torque[NUM_SERVOS];
+        for (int i = 0; i < NUM_SERVOS; i++) {
+            command[i] = pulse_to_angle(i, level[i]);
+            actual[i] = servo[i].pos;
+        }
+        if ((t - start_ms) % FRAME_MS == 0) {
+            for (int i = 0; i < NUM_SERVOS; i++) servo[i].target = command[i];
+        }
+        gravity_torque(actual, torque);
+        for (int i = 0; i < NUM_SERVOS; i++) {
+            step_servo(&servo[i], servo_models[i], torque[i]);
+            actual[i] = servo[i].pos;
+        }
+
+        double tip_cmd[3], tip_act[3];
+        tip_position(command, tip_cmd);
+        tip_position(actual, tip_act);
+        double err = sqrt((tip_cmd[0] - tip_act[0]) * (tip_cmd[0] - tip_act[0]) +
+                          (tip_cmd[1] - tip_act[1]) * (tip_cmd[1] - tip_act[1]) +
+                          (tip_cmd[2] - tip_act[2]) * (tip_cmd[2] - tip_act[2]));
+        if (err > r->tip_max) r->tip_max = err;
+
+        bool resting = t - last_change_ms >= REST_MS;
+        if (!resting) {
+            moving_sq += err * err;
+            moving_ticks++;
+        }
+
+        // Settled: every servo stopped, inside its deadband of the command,
+        // and still so once the pause is long enough to count
+        if (!settled) {
+            bool now_settled = true;
+            for (int i = 0; i < NUM_SERVOS && now_settled; i++) {
+                now_settled = fabs(servo[i].vel) < STOPPED_DEG_S &&
+                              fabs(command[i] - servo[i].pos) <= servo_models[i]->deadband / 2;
+            }
+            if (!now_settled) {
+                settled_from = -1;
+            } else if (settled_from < 0 || (uint64_t)settled_from < last_change_ms) {
+                settled_from = (int64_t)t;
+            }
+            if (now_settled && resting) {
+                add_settle(r, &settle_log, (double)((uint64_t)settled_from - last_change_ms));
+                settled = true;
+            }
+        } else {
+            rest_sum += err;
+            rest_ticks++;
+        }
+
+        for (int i = 0; i < NUM_SERVOS; i++) {
+            if (!latency_armed[i]) continue;
+            if (latency_from[i] < 0) {
+                if (fabs(command[i] - latency_cmd[i]) >= LATENCY_DEG) {
+                    latency_from[i] = (int64_t)t;
+                } else if (t - servo_change_ms[i] >= REST_MS) {
+                    latency_armed[i] = false;  // Came to rest again without getting there
+                }
+            }
+            if (latency_from[i] >= 0 && fabs(servo[i].pos - latency_pos[i]) >= LATENCY_DEG) {
+                double latency = (double)(t - (uint64_t)latency_from[i]);
+                latency_sum += latency;
+                if (latency > r->latency_max) r->latency_max = latency;
+                r->latencies++;
+                latency_armed[i] = false;
+            }
+        }
+
+        if (trace) {
+            fprintf(trace, "%llu", (unsigned long long)t);
+            for (int i = 0; i < NUM_SERVOS; i++) fprintf(trace, ",%.2f,%.2f", command[i], actual[i]);
+            fprintf(trace, ",%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.3f\n", tip_cmd[0], tip_cmd[1], tip_cmd[2], tip_act[0],
+                    tip_act[1], tip_act[2], err);
+        }
+    }
+    if (!settled) r->unsettled++;
+
+    r->seconds = (end_ms - start_ms) / 1000.0;
+    r->tip_rms_moving = moving_ticks > 0 ? sqrt(moving_sq / moving_ticks) : 0.0;
+    r->tip_rest_mean = rest_ticks > 0 ? rest_sum / rest_ticks : 0.0;
+    if (r->settles > 0) {
+        qsort(settle_log.times, r->settles, sizeof(double), compare_double);
+        r->settle_median = settle_log.times[r->settles / 2];
+        r->settle_max = settle_log.times[r->settles - 1];
+    }
+    r->latency_mean = r->latencies > 0 ? latency_sum / r->latencies : 0.0;
+    for (int i = 0; i < NUM_SERVOS; i++) r->peak_accel[i] = servo[i].peak_accel;
+
+    free(settle_log.times);
+    free(writes);
+    return true;
+}
+
+static void print_row(const char *label, const run_result_t *results, int n, size_t offset, const char *format) {
+    printf("%-28s", label);
+    for (int k = 0; k < n; k++) printf(format, *(const double *)((const char *)&results[k] + offset));
+    printf("\n");
+}
+
+int main(int argc, char **argv) {
+    const char *trace_path = NULL;
+    const char *paths[argc];
+    int num_paths = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else {
+            paths[num_paths++] = argv[i];
+        }
+    }
+    if (num_paths == 0) {
+        fprintf(stderr, "usage: %s [-o trace.csv] <pwm.csv | -> [more pwm.csv ...]\n", argv[0]);
+        return 1;
+    }
+
+    run_result_t results[num_paths];
+    for (int k = 0; k < num_paths; k++) {
+        FILE *trace = NULL;
+        if (k == 0 && trace_path && !(trace = fopen(trace_path, "w"))) {
+            perror(trace_path);
+            return 1;
+        }
+        bool ok = run(paths[k], trace, &results[k]);
+        if (trace) fclose(trace);
+        if (!ok) return 1;
+    }
+
+    printf("%-28s", "");
+    for (int k = 0; k < num_paths; k++) {
+        const char *name = strrchr(paths[k], '/');
+        printf("%14.14s", name ? name + 1 : paths[k]);
+    }
+    printf("\n");
+    print_row("run (s)", results, num_paths, offsetof(run_result_t, seconds), "%14.1f");
+    print_row("tip error moving RMS (mm)", results, num_paths, offsetof(run_result_t, tip_rms_moving), "%14.2f");
+    print_row("tip error max (mm)", results, num_paths, offsetof(run_result_t, tip_max), "%14.2f");
+    print_row("tip error settled (mm)", results, num_paths, offsetof(run_result_t, tip_rest_mean), "%14.2f");
+    print_row("settle median (ms)", results, num_paths, offsetof(run_result_t, settle_median), "%14.0f");
+    print_row("settle max (ms)", results, num_paths, offsetof(run_result_t, settle_max), "%14.0f");
+    print_row("latency mean (ms)", results, num_paths, offsetof(run_result_t, latency_mean), "%14.1f");
+    print_row("latency max (ms)", results, num_paths, offsetof(run_result_t, latency_max), "%14.0f");
+    for (int i = 0; i < NUM_SERVOS; i++) {
+        char label[40];
+        snprintf(label, sizeof(label), "peak accel %d %s (deg/s^2)", i, servo_models[i]->model);
+        print_row(label, results, num_paths, offsetof(run_result_t, peak_accel) + i * sizeof(double), "%14.0f");
+    }
+
+    printf("%-28s", "pauses settled/not");
+    for (int k = 0; k < num_paths; k++) {
+        char cell[32];
+        snprintf(cell, sizeof(cell), "%d/%d", results[k].settles, results[k].unsettled);
+        printf("%14s", cell);
+    }
+    printf("\n");
+    return 0;
+}
@@ -0,0 +1,316 @@
+/*
+ * Replays a recorded joystick session through a sim build of the same
+ * firmware and diffs the servo commands it gives against a golden run.
+ *
+ * Usage: session_replay [-g golden.bin] [-o replay.bin] [-t tolerance] <sim binary> <recording.bin>
+ * (built by the sim/ CMake project)
+ *
+ * A recording is the raw telemetry stream (arm_core/arm_telemetry.h) with
+ * its loop records: the ADC values each control loop pass read and the
+ * servo pulses it left queued. Capture one on the device, attached before
+ * the loop starts so it has pass 0, or from a sim run:
+ *   telemetry_decode -r session.bin /dev/ttyACM0 > /dev/null
+ *   ARM_SIM_ADC_SCRIPT=... ARM_SIM_SERIAL_LOG=session.bin ./ik_js_control_sim
+ *
+ * The recorded ADC values become a sim ADC script aligned on the first
+ * read, each value held from halfway between its pass and the one before,
+ * so every replayed pass reads what the recorded one did even if the loop
+ * timing drifts a little. The sim runs on virtual time, so a session
+ * replays far faster than it was recorded.
+ *
+ * The golden run is the recording itself unless -g gives another (a
+ * replay saved with -o, say, when the recording came from the device).
+ * Pulses are compared pass by pass, within -t PWM levels (default 0).
+ * Exits 0 on a match, 1 on a divergence, 2 if it couldn't run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+// Must match arm_core/arm_telemetry.h
+#define TELEMETRY_FRAME_LOOP 2
+#define TELEMETRY_SERVOS     5
+#define TELEMETRY_ADC_INPUTS 3
+#define LOOP_PAYLOAD_LEN     (1 + 2 + 4 + 2 * TELEMETRY_ADC_INPUTS + 2 * TELEMETRY_SERVOS)
+
+#define CHUNK_MAX 512
+
+typedef struct {
+    uint32_t pass;  // Unwrapped
+    uint32_t t_us;
+    uint16_t adc[TELEMETRY_ADC_INPUTS];
+    uint16_t pulses[TELEMETRY_SERVOS];
+} loop_record_t;
+
+typedef struct {
+    loop_record_t *records;
+    int count;
+} session_t;
+
+static uint16_t crc16(const uint8_t *data, int len) {
+    uint16_t crc = 0xFFFF;
+    for (int i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int b = 0; b < 8; b++) {
+            crc = crc & 0x8000 ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static int cobs_decode(const uint8_t *in, int len, uint8_t *out) {
+    int i = 0, o = 0;
+    while (i < len) {
+        int code = in[i++];
+        if (code == 0 || i + code - 1 > len) return -1;
+        for (int k = 1; k < code; k++) out[o++] = in[i++];
+        if (code < 0xFF && i < len) out[o++] = 0;
+    }
+    return o;
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+static void add_record(session_t *s, const uint8_t *p, int *capacity) {
+    if (s->count == *capacity) {
+        *capacity *= 2;
+        s->records = realloc(s->records, *capacity * sizeof(loop_record_t));
+    }
+    loop_record_t *r = &s->records[s->count];
+    uint16_t pass = get_u16(p + 1);
+    r->pass = s->count == 0 ? pass : s->records[s->count - 1].pass + (uint16_t)(pass - s->records[s->count - 1].pass);
+    r->t_us = get_u16(p + 3) | (uint32_t)get_u16(p + 5) << 16;
+    const uint8_t *q = p + 7;
+    for (int i = 0; i < TELEMETRY_ADC_INPUTS; i++, q += 2) r->adc[i] = get_u16(q);
+    for (int i = 0; i < TELEMETRY_SERVOS; i++, q += 2) r->pulses[i] = get_u16(q);
+    s->count++;
+}
+
+// Everything but loop records (samples, text) is skipped
+static bool load_session(const char *path, session_t *s) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+
+    int capacity = 1024;
+    s->records = malloc(capacity * sizeof(loop_record_t));
+    s->count = 0;
+
+    uint8_t chunk[CHUNK_MAX], frame[CHUNK_MAX];
+    int chunk_len = 0;
+    int c;
+    while ((c = fgetc(f)) != EOF) {
+        if (c != 0) {
+            if (chunk_len < CHUNK_MAX) chunk[chunk_len] = (uint8_t)c;
+            chunk_len++;
+            continue;
+        }
+        int n = chunk_len <= CHUNK_MAX ? cobs_decode(chunk, chunk_len, frame) : -1;
+        chunk_len = 0;
+        if (n != LOOP_PAYLOAD_LEN + 2 || frame[0] != TELEMETRY_FRAME_LOOP) continue;
+        if (crc16(frame, n - 2) != get_u16(frame + n - 2)) continue;
+        add_record(s, frame, &capacity);
+    }
+    fclose(f);
+    return true;
+}
+
+static bool write_adc_script(const char *path, const session_t *s) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    fprintf(f, "@align first_read\n");
+    uint32_t t0 = s->records[0].t_us;
+    for (int i = 0; i < s->count; i++) {
+        const loop_record_t *r = &s->records[i];
+        uint32_t t_ms = 0;
+        if (i > 0) {
+            uint32_t prev = s->records[i - 1].t_us - t0, cur = r->t_us - t0;
+            t_ms = (prev + (cur - prev) / 2) / 1000;
+        }
+        fprintf(f, "%u %u %u %u\n", t_ms, r->adc[0], r->adc[1], r->adc[2]);
+    }
+    fclose(f);
+    return true;
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Runs the sim with its output discarded; returns the wall time taken
+static double run_sim(const char *sim, const char *script, const char *serial_log) {
+    double start = now_s();
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return -1.0;
+    }
+    if (pid == 0) {
+        setenv("ARM_SIM_ADC_SCRIPT", script, 1);
+        setenv("ARM_SIM_SERIAL_LOG", serial_log, 1);
+        unsetenv("ARM_SIM_DURATION_MS");
+        unsetenv("ARM_SIM_PWM_LOG");
+        int null_fd = open("/dev/null", O_RDWR);
+        if (null_fd >= 0) {
+            dup2(null_fd, STDIN_FILENO);
+            dup2(null_fd, STDOUT_FILENO);
+        }
+        execl(sim, sim, (char *)NULL);
+        perror(sim);
+        _exit(127);
+    }
+
+    int status;
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "%s failed\n", sim);
+        return -1.0;
+    }
+    return now_s() - start;
+}
+
+static bool copy_file(const char *from, const char *to) {
+    FILE *in = fopen(from, "rb"), *out = fopen(to, "wb");
+    if (!in || !out) {
+        perror(to);
+        if (in) fclose(in);
+        if (out) fclose(out);
+        return false;
+    }
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), in)) > 0) fwrite(buf, 1, n, out);
+    fclose(in);
+    fclose(out);
+    return true;
+}
+
+static int compare(const session_t *golden, const session_t *replay, int tolerance) {
+    int diverged = 0, input_mismatches = 0, first = -1, worst = 0;
+    int n = golden->count < replay->count ? golden->count : replay->count;
+    for (int i = 0; i < n; i++) {
+        const loop_record_t *g = &golden->records[i], *r = &replay->records[i];
+        if (g->pass != r->pass) {
+            fprintf(stderr, "pass numbers differ at record %d (%u vs %u): lost loop records?\n", i, g->pass, r->pass);
+            return 1;
+        }
+        if (memcmp(g->adc, r->adc, sizeof(g->adc)) != 0) input_mismatches++;
+
+        bool bad = false;
+        for (int k = 0; k < TELEMETRY_SERVOS; k++) {
+            int diff = abs((int)r->pulses[k] - (int)g->pulses[k]);
+            if (diff > worst) worst = diff;
+            if (diff > tolerance) bad = true;
+        }
+        if (!bad) continue;
+        diverged++;
+        if (first < 0) {
+            first = i;
+            fprintf(stderr, "first divergence at pass %u (%.3fs in):\n", g->pass,
+                    (g->t_us - golden->records[0].t_us) / 1e6);
+            for (int k = 0; k < TELEMETRY_SERVOS; k++) {
+                fprintf(stderr, "  servo %d: golden %u replay %u%s\n", k, g->pulses[k], r->pulses[k],
+                        g->pulses[k] != r->pulses[k] ? " *" : "");
+            }
+        }
+    }
+
+    if (input_mismatches > 0) {
+        fprintf(stderr, "%d passes read different ADC values than the golden run (loop timing changed?)\n",
+                input_mismatches);
+    }
+    // The replay runs on past the recording's last pass; those aren't compared
+    if (replay->count < golden->count) {
+        fprintf(stderr, "replay stopped after %d of the golden run's %d passes\n", replay->count, golden->count);
+    }
+    fprintf(stderr, "%d passes compared, %d diverged, max difference %d PWM levels\n", n, diverged, worst);
+    return diverged > 0 || replay->count < golden->count ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    const char *golden_path = NULL, *out_path = NULL, *sim = NULL, *recording_path = NULL;
+    int tolerance = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+            golden_path = argv[++i];
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            tolerance = atoi(argv[++i]);
+        } else if (!sim) {
+            sim = argv[i];
+        } else {
+            recording_path = argv[i];
+        }
+    }
+    if (!sim || !recording_path) {
+        fprintf(stderr, "usage: %s [-g golden.bin] [-o replay.bin] [-t tolerance] <sim binary> <recording.bin>\n",
+                argv[0]);
+        return 2;
+    }
+
+    session_t recording, golden, replay;
+    if (!load_session(recording_path, &recording)) return 2;
+    if (recording.count == 0) {
+        fprintf(stderr, "%s has no loop records\n", recording_path);
+        return 2;
+    }
+    if (recording.records[0].pass != 0) {
+        fprintf(stderr, "%s starts at pass %u: the replay needs the session from its first pass\n",
+                recording_path, recording.records[0].pass);
+        return 2;
+    }
+    int gaps = 0;
+    for (int i = 1; i < recording.count; i++) {
+        if (recording.records[i].pass != recording.records[i - 1].pass + 1) gaps++;
+    }
+    if (gaps > 0) {
+        fprintf(stderr, "%s has %d gaps in its loop records; their inputs are held over\n", recording_path, gaps);
+    }
+    if (golden_path) {
+        if (!load_session(golden_path, &golden)) return 2;
+    } else {
+        golden = recording;
+    }
+
+    char script[] = "/tmp/session_replay_adcXXXXXX";
+    char serial_log[] = "/tmp/session_replay_serialXXXXXX";
+    int script_fd = mkstemp(script), serial_fd = mkstemp(serial_log);
+    if (script_fd < 0 || serial_fd < 0) {
+        perror("mkstemp");
+        return 2;
+    }
+    close(script_fd);
+    close(serial_fd);
+
+    int result = 2;
+    double wall = -1.0;
+    if (write_adc_script(script, &recording)) wall = run_sim(sim, script, serial_log);
+    if (wall >= 0.0 && load_session(serial_log, &replay)) {
+        double span = (recording.records[recording.count - 1].t_us - recording.records[0].t_us) / 1e6;
+        fprintf(stderr, "%d passes (%.1fs of session) replayed in %.3fs, %.0fx real time\n", replay.count, span,
+                wall, wall > 0.0 ? span / wall : 0.0);
+        result = compare(&golden, &replay, tolerance);
+        if (out_path && !copy_file(serial_log, out_path)) result = 2;
+    }
+
+    unlink(script);
+    unlink(serial_log);
+    if (result == 0) fprintf(stderr, "match\n");
+    return result;
+}
@@ -0,0 +1,260 @@
+/*
+ * Decodes the binary telemetry stream from arm_core/arm_telemetry.c into
+ * CSV, one row per sample.
+ *
+ * Usage: telemetry_decode [-o out.csv] [-l loops.csv] [-r raw.bin] <serial device | capture file | ->
+ * (built by the sim/ CMake project)
+ *
+ *   telemetry_decode -o run.csv /dev/ttyACM0         live, until Ctrl-C
+ *   telemetry_decode -r run.bin /dev/ttyACM0 > /dev/null
+ *   telemetry_decode run.bin > run.csv               decode a capture later
+ *   ARM_SIM_SERIAL_LOG=sim.bin ./ik_js_control_sim; telemetry_decode sim.bin
+ *
+ * -r keeps the raw framed stream, the compact log (~40 bytes per sample);
+ * it decodes again later like a device, and it is the session recording
+ * tools/session_replay runs back through the sim. -l writes the loop
+ * records in it (ADC in, servo pulses out, one row per control loop pass). Text the firmware prints between
+ * frames (prompts, reconfiguration messages) goes to stderr as is. A
+ * summary of frames, CRC failures and lost samples is printed at the end.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+
+// Must match arm_core/arm_telemetry.h
+#define TELEMETRY_FRAME_SAMPLE 1
+#define TELEMETRY_FRAME_LOOP   2
+#define TELEMETRY_SERVOS       5
+#define TELEMETRY_ADC_INPUTS   3
+#define SAMPLE_PAYLOAD_LEN     (1 + 2 + 4 + 2 + 2 * TELEMETRY_SERVOS + 2 * 3 + 2 * TELEMETRY_ADC_INPUTS + 2 + 2)
+#define LOOP_PAYLOAD_LEN       (1 + 2 + 4 + 2 * TELEMETRY_ADC_INPUTS + 2 * TELEMETRY_SERVOS)
+
+#define CHUNK_MAX 512  // Longer runs without a delimiter are text or noise
+
+static volatile sig_atomic_t stop = 0;
+
+static struct {
+    unsigned long frames, loops, crc_errors, bad_frames, lost, loops_lost, device_dropped;
+} stats;
+
+static FILE *loops_csv = NULL;
+
+static void on_signal(int sig) {
+    (void)sig;
+    stop = 1;
+}
+
+static uint16_t crc16(const uint8_t *data, int len) {
+    uint16_t crc = 0xFFFF;
+    for (int i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int b = 0; b < 8; b++) {
+            crc = crc & 0x8000 ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+// Returns the decoded length, or -1 if in isn't valid COBS
+static int cobs_decode(const uint8_t *in, int len, uint8_t *out) {
+    int i = 0, o = 0;
+    while (i < len) {
+        int code = in[i++];
+        if (code == 0 || i + code - 1 > len) return -1;
+        for (int k = 1; k < code; k++) out[o++] = in[i++];
+        if (code < 0xFF && i < len) out[o++] = 0;
+    }
+    return o;
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+static bool is_text(const uint8_t *p, int len) {
+    for (int i = 0; i < len; i++) {
+        if ((p[i] < 0x20 || p[i] > 0x7E) && p[i] != '\n' && p[i] != '\r' && p[i] != '\t') return false;
+    }
+    return true;
+}
+
+static void write_sample(FILE *csv, const uint8_t *p) {
+    static bool have_seq = false;
+    static uint16_t last_seq;
+
+    uint16_t seq = get_u16(p + 1);
+    uint32_t t_us = get_u16(p + 3) | (uint32_t)get_u16(p + 5) << 16;
+    uint16_t dropped = get_u16(p + 7);
+    if (have_seq) stats.lost += (uint16_t)(seq - last_seq - 1);
+    have_seq = true;
+    last_seq = seq;
+    stats.device_dropped += dropped;
+
+    const uint8_t *q = p + 9;
+    fprintf(csv, "%u,%u,%u", seq, t_us, dropped);
+    for (int i = 0; i < TELEMETRY_SERVOS; i++, q += 2) fprintf(csv, ",%u", get_u16(q));
+    for (int i = 0; i < 3; i++, q += 2) fprintf(csv, ",%.1f", (int16_t)get_u16(q) / 10.0);
+    for (int i = 0; i < TELEMETRY_ADC_INPUTS; i++, q += 2) fprintf(csv, ",%u", get_u16(q));
+    fprintf(csv, ",%u,%u\n", get_u16(q), get_u16(q + 2));
+}
+
+static void write_loop(const uint8_t *p) {
+    static bool have_pass = false;
+    static uint16_t last_pass;
+
+    uint16_t pass = get_u16(p + 1);
+    if (have_pass) stats.loops_lost += (uint16_t)(pass - last_pass - 1);
+    have_pass = true;
+    last_pass = pass;
+    if (!loops_csv) return;
+
+    const uint8_t *q = p + 7;
+    fprintf(loops_csv, "%u,%u", pass, get_u16(p + 3) | (uint32_t)get_u16(p + 5) << 16);
+    for (int i = 0; i < TELEMETRY_ADC_INPUTS + TELEMETRY_SERVOS; i++, q += 2) fprintf(loops_csv, ",%u", get_u16(q));
+    fputc('\n', loops_csv);
+}
+
+static void handle_chunk(FILE *csv, const uint8_t *chunk, int len) {
+    if (len == 0) return;
+
+    uint8_t frame[CHUNK_MAX];
+    int n = cobs_decode(chunk, len, frame);
+    if (n >= 3) {
+        if (crc16(frame, n - 2) == get_u16(frame + n - 2)) {
+            if (frame[0] == TELEMETRY_FRAME_SAMPLE && n - 2 == SAMPLE_PAYLOAD_LEN) {
+                write_sample(csv, frame);
+                stats.frames++;
+            } else if (frame[0] == TELEMETRY_FRAME_LOOP && n - 2 == LOOP_PAYLOAD_LEN) {
+                write_loop(frame);
+                stats.loops++;
+            } else {
+                stats.bad_frames++;
+            }
+            return;
+        }
+    }
+
+    if (is_text(chunk, len)) {
+        fwrite(chunk, 1, len, stderr);
+    } else {
+        stats.crc_errors++;
+    }
+}
+
+static void make_raw(int fd) {
+    struct termios tio;
+    if (tcgetattr(fd, &tio) != 0) return;  // Not a tty: a capture file or pipe
+    cfmakeraw(&tio);
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tio);
+}
+
+int main(int argc, char **argv) {
+    const char *csv_path = NULL, *loops_path = NULL, *raw_path = NULL, *in_path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+            loops_path = argv[++i];
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            raw_path = argv[++i];
+        } else if (!in_path) {
+            in_path = argv[i];
+        } else {
+            in_path = NULL;
+            break;
+        }
+    }
+    if (!in_path) {
+        fprintf(stderr, "usage: %s [-o out.csv] [-l loops.csv] [-r raw.bin] <serial device | capture file | ->\n", argv[0]);
+        return 1;
+    }
+
+    int fd = strcmp(in_path, "-") == 0 ? STDIN_FILENO : open(in_path, O_RDONLY | O_NOCTTY);
+    if (fd < 0) {
+        perror(in_path);
+        return 1;
+    }
+    make_raw(fd);
+
+    FILE *csv = csv_path ? fopen(csv_path, "w") : stdout;
+    if (!csv) {
+        perror(csv_path);
+        return 1;
+    }
+    if (loops_path) {
+        if (!(loops_csv = fopen(loops_path, "w"))) {
+            perror(loops_path);
+            return 1;
+        }
+        fprintf(loops_csv, "pass,t_us");
+        for (int i = 0; i < TELEMETRY_ADC_INPUTS; i++) fprintf(loops_csv, ",adc%d", i);
+        for (int i = 0; i < TELEMETRY_SERVOS; i++) fprintf(loops_csv, ",pulse%d", i);
+        fputc('\n', loops_csv);
+    }
+    FILE *raw = NULL;
+    if (raw_path && !(raw = fopen(raw_path, "wb"))) {
+        perror(raw_path);
+        return 1;
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    fprintf(csv, "seq,t_us,dropped");
+    for (int i = 0; i < TELEMETRY_SERVOS; i++) fprintf(csv, ",pulse%d", i);
+    fprintf(csv, ",x_mm,y_mm,z_mm");
+    for (int i = 0; i < TELEMETRY_ADC_INPUTS; i++) fprintf(csv, ",adc%d", i);
+    fprintf(csv, ",loop_us,period_us\n");
+
+    uint8_t chunk[CHUNK_MAX];
+    int chunk_len = 0;
+    bool overflow = false;
+    uint8_t buf[4096];
+    while (!stop) {
+        ssize_t n = read(fd, buf, sizeof(buf));
+        if (n <= 0) break;
+        if (raw) fwrite(buf, 1, n, raw);
+
+        for (ssize_t i = 0; i < n; i++) {
+            if (buf[i] == 0) {
+                if (overflow) {
+                    stats.crc_errors++;
+                } else {
+                    handle_chunk(csv, chunk, chunk_len);
+                }
+                chunk_len = 0;
+                overflow = false;
+            } else if (chunk_len < CHUNK_MAX) {
+                chunk[chunk_len++] = buf[i];
+            } else {
+                // Long text runs are passed through rather than dropped
+                if (is_text(chunk, chunk_len)) {
+                    fwrite(chunk, 1, chunk_len, stderr);
+                    chunk_len = 0;
+                    chunk[chunk_len++] = buf[i];
+                } else {
+                    overflow = true;
+                }
+            }
+        }
+        if (csv == stdout) fflush(csv);
+    }
+    if (chunk_len > 0 && !overflow && is_text(chunk, chunk_len)) fwrite(chunk, 1, chunk_len, stderr);
+
+    if (raw) fclose(raw);
+    if (csv != stdout) fclose(csv);
+    if (loops_csv) fclose(loops_csv);
+    fprintf(stderr, "%lu frames, %lu CRC errors, %lu bad frames, %lu samples lost (%lu dropped on the device)\n",
+            stats.frames, stats.crc_errors, stats.bad_frames, stats.lost, stats.device_dropped);
+    fprintf(stderr, "%lu loop records, %lu lost\n", stats.loops, stats.loops_lost);
+    return 0;
+}
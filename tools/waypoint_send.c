@@ -0,0 +1,355 @@
+/*
+ * Streams a trajectory to ik_control over the binary waypoint protocol
+ * (arm_core/arm_waypoint.h), keeping within the device's credits and
+ * going back on sequence errors and timeouts.
+ *
+ * Usage: waypoint_send [-j] [-t ms] <serial device | -> [points file]
+ * (built by the sim/ CMake project)
+ *
+ * Points are read one per line, "x z" in mm, or "shoulder elbow" servo
+ * degrees with -j; '#' lines are skipped. Without a file they come from
+ * stdin. The first point runs as an S-curve from wherever the arm is, the
+ * rest as linear moves -t ms apart (default 10). A
+ * "stop" line sends a STOP there, dropping whatever the device still has
+ * queued.
+ *
+ * With "-" as the device the frames go to stdout with no flow control,
+ * for piping into the sim, which holds back reading while it is full:
+ *   waypoint_send - circle.txt | ./build-sim/ik_control_sim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <termios.h>
+
+// Must match arm_core/arm_waypoint.h and arm_frame.h
+#define WAYPOINT_CMD_HELLO     0x01
+#define WAYPOINT_CMD_CARTESIAN 0x02
+#define WAYPOINT_CMD_JOINT     0x03
+#define WAYPOINT_CMD_STOP      0x04
+#define WAYPOINT_CMD_STATUS    0x05
+#define WAYPOINT_MSG_ACK       0x81
+#define WAYPOINT_MSG_STATUS    0x82
+#define WAYPOINT_OK            0
+#define WAYPOINT_UNREACHABLE   1
+#define WAYPOINT_NO_CREDIT     2
+#define WAYPOINT_SEQUENCE      3
+#define WAYPOINT_FRAME_POINTS  16
+#define FRAME_MAX_PAYLOAD      128
+
+#define STATUS_POLL_MS 200
+#define RESEND_MS      1000
+
+typedef struct {
+    int first, count;  // count 0: a STOP
+    uint16_t duration_ms;
+} cmd_t;
+
+static float *point_a, *point_b;
+static bool *stop_before;  // STOP sent ahead of the point
+static int num_points = 0;
+static cmd_t *cmds;
+static int num_cmds = 0;
+static bool joint = false;
+static int out_fd;
+
+static uint16_t crc16(const uint8_t *data, int len) {
+    uint16_t crc = 0xFFFF;
+    for (int i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int b = 0; b < 8; b++) {
+            crc = crc & 0x8000 ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint8_t *put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+static void send_frame(const uint8_t *payload, int len) {
+    uint8_t raw[FRAME_MAX_PAYLOAD + 2];
+    memcpy(raw, payload, len);
+    put_u16(raw + len, crc16(payload, len));
+    len += 2;
+
+    uint8_t out[FRAME_MAX_PAYLOAD + 8];
+    int o = 0;
+    out[o++] = 0;
+    int code_at = o++;
+    uint8_t code = 1;
+    for (int i = 0; i < len; i++) {
+        if (raw[i] == 0) {
+            out[code_at] = code;
+            code_at = o++;
+            code = 1;
+        } else {
+            out[o++] = raw[i];
+            code++;
+        }
+    }
+    out[code_at] = code;
+    out[o++] = 0;
+
+    if (write(out_fd, out, o) != o) {
+        perror("write");
+        exit(1);
+    }
+}
+
+static void send_simple(uint8_t type, uint16_t seq) {
+    uint8_t msg[3] = {type};
+    put_u16(msg + 1, seq);
+    send_frame(msg, 3);
+}
+
+// Command k has seq k + 1; HELLO is seq 0
+static void send_cmd(int k) {
+    if (cmds[k].count == 0) {
+        send_simple(WAYPOINT_CMD_STOP, (uint16_t)(k + 1));
+        return;
+    }
+
+    uint8_t msg[FRAME_MAX_PAYLOAD];
+    uint8_t *p = msg;
+    *p++ = joint ? WAYPOINT_CMD_JOINT : WAYPOINT_CMD_CARTESIAN;
+    p = put_u16(p, (uint16_t)(k + 1));
+    p = put_u16(p, cmds[k].duration_ms);
+    *p++ = (uint8_t)cmds[k].count;
+    for (int i = cmds[k].first; i < cmds[k].first + cmds[k].count; i++) {
+        if (joint) {
+            p = put_u16(p, (uint16_t)lround(point_a[i] * 100.0));
+            p = put_u16(p, (uint16_t)lround(point_b[i] * 100.0));
+        } else {
+            p = put_u16(p, (uint16_t)(int16_t)lround(point_a[i] * 10.0));
+            p = put_u16(p, (uint16_t)(int16_t)lround(point_b[i] * 10.0));
+        }
+    }
+    send_frame(msg, (int)(p - msg));
+}
+
+static void load_points(FILE *f) {
+    int capacity = 1024;
+    point_a = malloc(capacity * sizeof(float));
+    point_b = malloc(capacity * sizeof(float));
+    stop_before = malloc(capacity * sizeof(bool));
+
+    char line[128];
+    bool stop = false;
+    while (fgets(line, sizeof(line), f)) {
+        float a, b;
+        if (strncmp(line, "stop", 4) == 0) stop = true;
+        if (line[0] == '#' || sscanf(line, "%f %f", &a, &b) != 2) continue;
+        if (num_points == capacity) {
+            capacity *= 2;
+            point_a = realloc(point_a, capacity * sizeof(float));
+            point_b = realloc(point_b, capacity * sizeof(float));
+            stop_before = realloc(stop_before, capacity * sizeof(bool));
+        }
+        point_a[num_points] = a;
+        point_b[num_points] = b;
+        stop_before[num_points] = stop;
+        stop = false;
+        num_points++;
+    }
+}
+
+static void build_cmds(uint16_t duration_ms) {
+    // Worst case a STOP and a one-point frame per point
+    cmds = malloc((2 * num_points + 1) * sizeof(cmd_t));
+    cmds[num_cmds++] = (cmd_t){0, 1, 0};
+    for (int i = 1; i < num_points;) {
+        if (stop_before[i]) cmds[num_cmds++] = (cmd_t){i, 0, 0};
+        int n = 1;
+        while (n < WAYPOINT_FRAME_POINTS && i + n < num_points && !stop_before[i + n]) n++;
+        cmds[num_cmds++] = (cmd_t){i, n, duration_ms};
+        i += n;
+    }
+}
+
+static uint64_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static int in_flight(int from, int to) {
+    int n = 0;
+    for (int k = from; k < to; k++) n += cmds[k].count;
+    return n;
+}
+
+static int stream(int fd) {
+    uint8_t chunk[FRAME_MAX_PAYLOAD * 2 + 8], msg[FRAME_MAX_PAYLOAD * 2];
+    int chunk_len = 0;
+    bool in_frame = false;
+
+    bool hello_acked = false;
+    int accepted = 0;      // Commands the device has taken
+    int next = 0;          // Next command to send
+    int credits = 0;       // From the last report, covering commands < accepted
+    bool idle = false;
+    uint64_t start = now_ms(), last_rx = start, last_poll = start;
+
+    send_simple(WAYPOINT_CMD_HELLO, 0);
+    while (!(hello_acked && accepted == num_cmds && idle)) {
+        // Send whatever the credits allow
+        if (hello_acked) {
+            int avail = credits - in_flight(accepted, next);
+            while (next < num_cmds && cmds[next].count <= avail) {
+                send_cmd(next);
+                avail -= cmds[next].count;
+                next++;
+            }
+        }
+
+        uint64_t t = now_ms();
+        if (t - last_poll >= STATUS_POLL_MS) {
+            send_simple(WAYPOINT_CMD_STATUS, 0);
+            last_poll = t;
+        }
+        if (t - last_rx >= RESEND_MS) {
+            // Lost somewhere: start over from the first unaccepted command
+            if (!hello_acked) send_simple(WAYPOINT_CMD_HELLO, 0);
+            next = accepted;
+            last_rx = t;
+        }
+
+        struct pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 20) <= 0) continue;
+        uint8_t buf[256];
+        ssize_t n = read(fd, buf, sizeof(buf));
+        if (n <= 0) {
+            fprintf(stderr, "device closed\n");
+            return 1;
+        }
+
+        for (ssize_t i = 0; i < n; i++) {
+            if (buf[i] != 0) {
+                if (in_frame && chunk_len < (int)sizeof(chunk)) chunk[chunk_len++] = buf[i];
+                else if (!in_frame) fputc(buf[i], stderr);  // Device text
+                continue;
+            }
+            if (!in_frame || chunk_len == 0) {
+                in_frame = true;
+                chunk_len = 0;
+                continue;
+            }
+            in_frame = false;
+
+            // COBS decode and CRC check
+            int c = 0, len = 0;
+            bool ok = true;
+            while (c < chunk_len && ok) {
+                int code = chunk[c++];
+                if (c + code - 1 > chunk_len) ok = false;
+                for (int k = 1; ok && k < code; k++) msg[len++] = chunk[c++];
+                if (code < 0xFF && c < chunk_len) msg[len++] = 0;
+            }
+            chunk_len = 0;
+            if (!ok || len < 3 || crc16(msg, len - 2) != get_u16(msg + len - 2)) continue;
+            last_rx = now_ms();
+
+            if (msg[0] == WAYPOINT_MSG_ACK) {
+                int seq = get_u16(msg + 1);
+                int result = msg[3];
+                if (result == WAYPOINT_OK) {
+                    if (seq == 0) {
+                        hello_acked = true;
+                    } else if (seq > accepted) {
+                        accepted = seq;
+                    }
+                    credits = get_u16(msg + 5);
+                } else if (result == WAYPOINT_SEQUENCE || result == WAYPOINT_NO_CREDIT) {
+                    next = seq - 1;  // SEQUENCE: the one it expects, NO_CREDIT: the refused one
+                    if (next < accepted) next = accepted;
+                    credits = result == WAYPOINT_NO_CREDIT ? 0 : get_u16(msg + 5);
+                } else if (result == WAYPOINT_UNREACHABLE) {
+                    int point = cmds[seq - 1].first + msg[4];
+                    fprintf(stderr, "point %d (%.1f %.1f) is unreachable\n", point + 1, point_a[point],
+                            point_b[point]);
+                    return 1;
+                } else {
+                    fprintf(stderr, "command %d refused (%d)\n", seq, result);
+                    return 1;
+                }
+            } else if (msg[0] == WAYPOINT_MSG_STATUS) {
+                int next_seq = get_u16(msg + 1);
+                if (hello_acked && next_seq - 1 > accepted) accepted = next_seq - 1;
+                credits = get_u16(msg + 3);
+                idle = msg[11] != 0 && accepted == num_cmds;
+            }
+        }
+    }
+
+    double seconds = (now_ms() - start) / 1000.0;
+    fprintf(stderr, "%d points in %.2fs, %.0f points/s\n", num_points, seconds, num_points / seconds);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    int duration_ms = 10;
+    const char *device = NULL, *points_path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-j") == 0) {
+            joint = true;
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            duration_ms = atoi(argv[++i]);
+        } else if (!device) {
+            device = argv[i];
+        } else {
+            points_path = argv[i];
+        }
+    }
+    if (!device || duration_ms < 1 || duration_ms > 65535) {
+        fprintf(stderr, "usage: %s [-j] [-t ms] <serial device | -> [points file]\n", argv[0]);
+        return 1;
+    }
+
+    FILE *f = points_path ? fopen(points_path, "r") : stdin;
+    if (!f) {
+        perror(points_path);
+        return 1;
+    }
+    load_points(f);
+    if (num_points == 0) {
+        fprintf(stderr, "no points\n");
+        return 1;
+    }
+    build_cmds((uint16_t)duration_ms);
+
+    if (strcmp(device, "-") == 0) {
+        out_fd = STDOUT_FILENO;
+        send_simple(WAYPOINT_CMD_HELLO, 0);
+        for (int k = 0; k < num_cmds; k++) send_cmd(k);
+        return 0;
+    }
+
+    int fd = open(device, O_RDWR | O_NOCTTY);
+    if (fd < 0) {
+        perror(device);
+        return 1;
+    }
+    struct termios tio;
+    if (tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+    out_fd = fd;
+    return stream(fd);
+}